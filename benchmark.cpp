@@ -0,0 +1,442 @@
+/**
+ * @file benchmark.cpp
+ * @brief Banc de mesure des performances de chaque etape du codec JPEG
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ *
+ * Mesure, apres echauffement et sur plusieurs repetitions, le temps par bloc
+ * (ns/bloc) et le debit (MPix/s) de chaque etape : DCT, IDCT, quantification,
+ * RLE, codage/decodage de Huffman, compression et decompression completes
+ * (par fichier, puis en memoire avec un cContexteCodec reutilise, puis par
+ * lots d'images avec le cCodecAsynchrone).
+ *
+ * Usage : benchmark [--format csv|json] [--sortie fichier] [--repetitions N]
+ *                   [--etiquette nom]
+ */
+
+#include "cCompression.h"
+#include "cDecompression.h"
+#include "cHuffman.h"
+#include "cContexteCodec.h"
+#include "cCodecAsynchrone.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <iomanip>
+
+using namespace std;
+using namespace chrono;
+
+namespace {
+
+/**
+ * @struct sResultat
+ * @brief Resultat d'une mesure pour une etape, une taille et une qualite
+ */
+struct sResultat {
+    string etape;               ///< Nom de l'etape mesuree
+    unsigned int largeur;       ///< Largeur de l'image
+    unsigned int hauteur;       ///< Hauteur de l'image
+    unsigned int qualite;       ///< Qualite de compression
+    unsigned int blocs;         ///< Nombre de blocs 8x8 traites par repetition
+    unsigned int repetitions;   ///< Nombre de repetitions mesurees
+    double nsParBlocMedian;     ///< Temps median par bloc (ns)
+    double nsParBlocMin;        ///< Temps minimal par bloc (ns)
+    double mpixParSeconde;      ///< Debit en megapixels par seconde (median)
+};
+
+const unsigned int TAILLES[] = {64, 256, 512};
+const unsigned int QUALITES[] = {25, 50, 90};
+const unsigned int ECHAUFFEMENT = 1;
+
+/**
+ * @brief Mesure une fonction sur plusieurs repetitions apres echauffement
+ * @param fonction Travail a mesurer (une repetition)
+ * @param repetitions Nombre de repetitions mesurees
+ * @return Durees de chaque repetition en nanosecondes
+ */
+template <typename F>
+vector<double> mesurer(F fonction, unsigned int repetitions) {
+    for (unsigned int i = 0; i < ECHAUFFEMENT; i++) {
+        fonction();
+    }
+
+    vector<double> durees;
+    for (unsigned int i = 0; i < repetitions; i++) {
+        auto debut = steady_clock::now();
+        fonction();
+        auto fin = steady_clock::now();
+        durees.push_back(static_cast<double>(duration_cast<nanoseconds>(fin - debut).count()));
+    }
+    return durees;
+}
+
+/**
+ * @brief Construit un resultat a partir des durees mesurees
+ */
+sResultat resumer(const string& etape, unsigned int taille, unsigned int qualite,
+                  unsigned int blocs, vector<double> durees) {
+    sort(durees.begin(), durees.end());
+    double median = durees[durees.size() / 2];
+
+    sResultat r;
+    r.etape = etape;
+    r.largeur = taille;
+    r.hauteur = taille;
+    r.qualite = qualite;
+    r.blocs = blocs;
+    r.repetitions = static_cast<unsigned int>(durees.size());
+    r.nsParBlocMedian = median / blocs;
+    r.nsParBlocMin = durees[0] / blocs;
+    r.mpixParSeconde = (median > 0) ? (blocs * 64.0) / (median / 1e9) / 1e6 : 0.0;
+    return r;
+}
+
+/**
+ * @brief Remplit une image de test de taille donnee en repetant Lenna
+ *
+ * Les tuiles sont inversees en miroir pour eviter des discontinuites
+ * artificielles. Si Lenna est absente, un degrade texture est utilise.
+ */
+void preparerImage(cCompression& comp, unsigned int taille, const vector<unsigned char>& lenna) {
+    comp.allocBuffer(taille, taille);
+    unsigned char** buffer = comp.getBuffer();
+
+    for (unsigned int i = 0; i < taille; i++) {
+        for (unsigned int j = 0; j < taille; j++) {
+            if (!lenna.empty()) {
+                unsigned int y = i % 256;
+                unsigned int x = j % 256;
+                if ((i / 256) % 2) y = 255 - y;
+                if ((j / 256) % 2) x = 255 - x;
+                buffer[i][j] = lenna[y * 256 + x];
+            } else {
+                buffer[i][j] = static_cast<unsigned char>((i * 3 + j * 5 + (i * j) % 17) & 0xFF);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Mesure toutes les etapes pour une taille et une qualite
+ */
+void mesurerEtapes(unsigned int taille, unsigned int qualite, unsigned int repetitions,
+                   const vector<unsigned char>& lenna, vector<sResultat>& resultats) {
+    cCompression comp;
+    preparerImage(comp, taille, lenna);
+    comp.setQualite(qualite);
+
+    unsigned int nbBlocs = (taille / 8) * (taille / 8);
+    unsigned char** buffer = comp.getBuffer();
+
+    // Donnees intermediaires de chaque etape, bloc par bloc
+    vector<char> blocsPixels(nbBlocs * 64);
+    vector<double> blocsDCT(nbBlocs * 64);
+    vector<double> blocsDequant(nbBlocs * 64);
+    vector<int> blocsQuant(nbBlocs * 64);
+    vector<char> blocsIDCT(nbBlocs * 64);
+
+    for (unsigned int b = 0; b < nbBlocs; b++) {
+        unsigned int bx = b % (taille / 8);
+        unsigned int by = b / (taille / 8);
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                blocsPixels[b * 64 + i * 8 + j] =
+                    static_cast<char>(buffer[by * 8 + i][bx * 8 + j] - 128);
+            }
+        }
+    }
+
+    // Pointeurs de lignes vers le bloc b de chaque tableau
+    auto lignes = [](auto* base, unsigned int b, auto** ptrs) {
+        for (int i = 0; i < 8; i++) {
+            ptrs[i] = base + b * 64 + i * 8;
+        }
+    };
+
+    char* charPtrs[8];
+    double* doublePtrs[8];
+    int* intPtrs[8];
+
+    // Preparer les entrees de chaque etape (une passe hors mesure)
+    for (unsigned int b = 0; b < nbBlocs; b++) {
+        lignes(blocsPixels.data(), b, charPtrs);
+        lignes(blocsDCT.data(), b, doublePtrs);
+        comp.Calcul_DCT_Block(charPtrs, doublePtrs);
+
+        lignes(blocsQuant.data(), b, intPtrs);
+        comp.quant_JPEG(doublePtrs, intPtrs);
+
+        lignes(blocsDequant.data(), b, doublePtrs);
+        comp.dequant_JPEG(intPtrs, doublePtrs);
+    }
+
+    // 1. DCT
+    resultats.push_back(resumer("dct", taille, qualite, nbBlocs, mesurer([&]() {
+        char* c[8];
+        double* d[8];
+        for (unsigned int b = 0; b < nbBlocs; b++) {
+            lignes(blocsPixels.data(), b, c);
+            lignes(blocsDCT.data(), b, d);
+            comp.Calcul_DCT_Block(c, d);
+        }
+    }, repetitions)));
+
+    // 2. IDCT (sur les coefficients dequantifies)
+    resultats.push_back(resumer("idct", taille, qualite, nbBlocs, mesurer([&]() {
+        double* d[8];
+        char* c[8];
+        for (unsigned int b = 0; b < nbBlocs; b++) {
+            lignes(blocsDequant.data(), b, d);
+            lignes(blocsIDCT.data(), b, c);
+            comp.Calcul_IDCT(d, c);
+        }
+    }, repetitions)));
+
+    // 3. Quantification
+    resultats.push_back(resumer("quant", taille, qualite, nbBlocs, mesurer([&]() {
+        double* d[8];
+        int* q[8];
+        for (unsigned int b = 0; b < nbBlocs; b++) {
+            lignes(blocsDCT.data(), b, d);
+            lignes(blocsQuant.data(), b, q);
+            comp.quant_JPEG(d, q);
+        }
+    }, repetitions)));
+
+    // 4. RLE bloc par bloc
+    vector<char> trame(nbBlocs * 128);
+    unsigned int longueurTrame = 0;
+    resultats.push_back(resumer("rle", taille, qualite, nbBlocs, mesurer([&]() {
+        int* q[8];
+        int DC_precedent = 0;
+        longueurTrame = 0;
+        for (unsigned int b = 0; b < nbBlocs; b++) {
+            lignes(blocsQuant.data(), b, q);
+            longueurTrame += comp.RLE_Block(q, DC_precedent, &trame[longueurTrame]);
+            DC_precedent = q[0][0];
+        }
+    }, repetitions)));
+
+    // 5. Huffman sur la trame RLE
+    vector<char> donnees(256);
+    vector<double> frequences(256);
+    unsigned int nbSymboles = cHuffman::Histogramme(trame.data(), longueurTrame,
+                                                    donnees.data(), frequences.data());
+    cHuffman huffman;
+    huffman.HuffmanCodes(donnees.data(), frequences.data(), nbSymboles);
+
+    vector<bool> bits;
+    resultats.push_back(resumer("huffman_encodeur", taille, qualite, nbBlocs, mesurer([&]() {
+        huffman.encoder(trame.data(), longueurTrame, bits);
+    }, repetitions)));
+
+    vector<uint64_t> mots;
+    resultats.push_back(resumer("huffman_encodeur_parallele", taille, qualite, nbBlocs, mesurer([&]() {
+        huffman.encoderParallele(trame.data(), longueurTrame, mots);
+    }, repetitions)));
+
+    vector<char> trameDecodee(longueurTrame + 1);
+    unsigned int nbBits = static_cast<unsigned int>(bits.size());
+    resultats.push_back(resumer("huffman_decodeur", taille, qualite, nbBlocs, mesurer([&]() {
+        huffman.decoder(bits, nbBits, trameDecodee.data());
+    }, repetitions)));
+
+    // 6. Compression et decompression completes (journaux desactives)
+    string fichier = "benchmark_" + to_string(taille) + "_q" + to_string(qualite) + ".dat";
+
+    cout.setstate(ios_base::failbit);
+    vector<double> dureesCompression = mesurer([&]() {
+        comp.compresser(fichier.c_str());
+    }, repetitions);
+
+    vector<double> dureesDecompression = mesurer([&]() {
+        cDecompression decomp;
+        char** image = decomp.Decompression_JPEG(fichier.c_str());
+        if (image) {
+            for (unsigned int i = 0; i < taille; i++) {
+                delete[] image[i];
+            }
+            delete[] image;
+        }
+    }, repetitions);
+    cout.clear();
+
+    remove(fichier.c_str());
+
+    resultats.push_back(resumer("compression", taille, qualite, nbBlocs, dureesCompression));
+    resultats.push_back(resumer("decompression", taille, qualite, nbBlocs, dureesDecompression));
+
+    // 7. Memes etapes en memoire, avec un contexte reutilise (sans allocation)
+    vector<unsigned char> pixels(static_cast<size_t>(taille) * taille);
+    for (unsigned int i = 0; i < taille; i++) {
+        memcpy(&pixels[static_cast<size_t>(i) * taille], buffer[i], taille);
+    }
+    cContexteCodec contexte;
+    resultats.push_back(resumer("compression_contexte", taille, qualite, nbBlocs, mesurer([&]() {
+        contexte.compresserMemoire(pixels.data(), taille, taille, qualite);
+    }, repetitions)));
+    resultats.push_back(resumer("decompression_contexte", taille, qualite, nbBlocs, mesurer([&]() {
+        contexte.decompresserMemoire(contexte.getFlux(), contexte.getTailleFlux());
+    }, repetitions)));
+
+    // 8. Lots d'images codees puis decodees par le codec asynchrone (pool interne)
+    const unsigned int nbImages = 4;
+    cCodecAsynchrone codec(0, nbImages);
+    vector<unsigned char> flux(contexte.getFlux(), contexte.getFlux() + contexte.getTailleFlux());
+    resultats.push_back(resumer("aller_retour_asynchrone", taille, qualite, nbBlocs * nbImages, mesurer([&]() {
+        vector<future<sResultatCodec>> taches;
+        for (unsigned int n = 0; n < nbImages; n++) {
+            taches.push_back(codec.compresserAsync(pixels, taille, taille, qualite));
+        }
+        for (unsigned int n = 0; n < nbImages; n++) {
+            taches[n].wait();
+            taches[n] = codec.decompresserAsync(flux);
+        }
+        for (future<sResultatCodec>& tache : taches) {
+            tache.wait();
+        }
+    }, repetitions)));
+}
+
+/**
+ * @brief Ecrit les resultats au format CSV
+ */
+void ecrireCSV(ostream& sortie, const vector<sResultat>& resultats, const string& etiquette) {
+    sortie << "etiquette,etape,largeur,hauteur,qualite,blocs,repetitions,"
+           << "ns_par_bloc_median,ns_par_bloc_min,mpix_par_s" << "\n";
+    for (const sResultat& r : resultats) {
+        sortie << etiquette << "," << r.etape << "," << r.largeur << "," << r.hauteur << ","
+               << r.qualite << "," << r.blocs << "," << r.repetitions << ","
+               << fixed << setprecision(1) << r.nsParBlocMedian << ","
+               << r.nsParBlocMin << ","
+               << setprecision(3) << r.mpixParSeconde << "\n";
+    }
+}
+
+/**
+ * @brief Ecrit les resultats au format JSON
+ */
+void ecrireJSON(ostream& sortie, const vector<sResultat>& resultats, const string& etiquette) {
+    sortie << "{\n  \"etiquette\": \"" << etiquette << "\",\n"
+           << "  \"compilateur\": \"" << __VERSION__ << "\",\n"
+           << "  \"resultats\": [\n";
+    for (size_t i = 0; i < resultats.size(); i++) {
+        const sResultat& r = resultats[i];
+        sortie << "    {\"etape\": \"" << r.etape << "\", \"largeur\": " << r.largeur
+               << ", \"hauteur\": " << r.hauteur << ", \"qualite\": " << r.qualite
+               << ", \"blocs\": " << r.blocs << ", \"repetitions\": " << r.repetitions
+               << fixed << setprecision(1)
+               << ", \"ns_par_bloc_median\": " << r.nsParBlocMedian
+               << ", \"ns_par_bloc_min\": " << r.nsParBlocMin
+               << setprecision(3)
+               << ", \"mpix_par_s\": " << r.mpixParSeconde << "}"
+               << (i + 1 < resultats.size() ? "," : "") << "\n";
+    }
+    sortie << "  ]\n}\n";
+}
+
+/**
+ * @brief Charge Lenna (256x256) si disponible
+ */
+vector<unsigned char> chargerLenna() {
+    vector<unsigned char> pixels;
+    ifstream fichier("lenna.img.txt");
+    if (!fichier) {
+        return pixels;
+    }
+
+    pixels.resize(256 * 256);
+    for (unsigned int i = 0; i < 256 * 256; i++) {
+        int valeur = 0;
+        fichier >> valeur;
+        if (valeur < 0) valeur = 0;
+        if (valeur > 255) valeur = 255;
+        pixels[i] = static_cast<unsigned char>(valeur);
+    }
+    return pixels;
+}
+
+} // namespace
+
+/**
+ * @brief Point d'entree du banc de mesure
+ */
+int main(int argc, char** argv) {
+    string format = "csv";
+    string nomSortie;
+    string etiquette = "defaut";
+    unsigned int repetitions = 5;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--format") && i + 1 < argc) {
+            format = argv[++i];
+        } else if (!strcmp(argv[i], "--sortie") && i + 1 < argc) {
+            nomSortie = argv[++i];
+        } else if (!strcmp(argv[i], "--repetitions") && i + 1 < argc) {
+            repetitions = static_cast<unsigned int>(max(1, atoi(argv[++i])));
+        } else if (!strcmp(argv[i], "--etiquette") && i + 1 < argc) {
+            etiquette = argv[++i];
+        } else {
+            cerr << "Usage: " << argv[0]
+                 << " [--format csv|json] [--sortie fichier] [--repetitions N] [--etiquette nom]"
+                 << endl;
+            return 1;
+        }
+    }
+
+    if (format != "csv" && format != "json") {
+        cerr << "Erreur: format inconnu " << format << endl;
+        return 1;
+    }
+
+    vector<unsigned char> lenna = chargerLenna();
+    if (lenna.empty()) {
+        cerr << "Attention: lenna.img.txt introuvable, image synthetique utilisee" << endl;
+    }
+
+    vector<sResultat> resultats;
+    for (unsigned int taille : TAILLES) {
+        for (unsigned int qualite : QUALITES) {
+            cerr << "Mesure " << taille << "x" << taille << " q" << qualite << "..." << endl;
+            mesurerEtapes(taille, qualite, repetitions, lenna, resultats);
+        }
+    }
+
+    // Resume lisible sur la sortie d'erreur, donnees sur la sortie choisie
+    cerr << "\nEtape            | Taille  | Q  | ns/bloc (med) | MPix/s" << endl;
+    cerr << "-----------------+---------+----+---------------+--------" << endl;
+    for (const sResultat& r : resultats) {
+        cerr << left << setw(16) << r.etape << " | " << right
+             << setw(3) << r.largeur << "x" << left << setw(3) << r.hauteur << right << " | "
+             << setw(2) << r.qualite << " | "
+             << setw(13) << fixed << setprecision(1) << r.nsParBlocMedian << " | "
+             << setw(6) << setprecision(2) << r.mpixParSeconde << endl;
+    }
+
+    ofstream fichier;
+    if (!nomSortie.empty()) {
+        fichier.open(nomSortie.c_str());
+        if (!fichier) {
+            cerr << "Erreur: Impossible d'ouvrir " << nomSortie << endl;
+            return 1;
+        }
+    }
+    ostream& sortie = nomSortie.empty() ? cout : fichier;
+
+    if (format == "json") {
+        ecrireJSON(sortie, resultats, etiquette);
+    } else {
+        ecrireCSV(sortie, resultats, etiquette);
+    }
+
+    return 0;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file cCodecAsynchrone.cpp
+ * @brief Implémentation de la classe cCodecAsynchrone
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "cCodecAsynchrone.h"
+#include <exception>
+#include <iostream>
+
+using namespace std;
+
+cCodecAsynchrone::cCodecAsynchrone(unsigned int nbThreads, unsigned int maxEnCours)
+    : mPool(new cPoolThreads(nbThreads)), mExecuteur(mPool), mMaxEnCours(maxEnCours),
+      mEnCours(0), mGeneration(0), mNbContextes(0) {
+    if (mMaxEnCours == 0) {
+        mMaxEnCours = 2 * mPool->getNbThreads();
+    }
+    mContextes.reserve(mMaxEnCours);
+}
+
+cCodecAsynchrone::cCodecAsynchrone(cExecuteur& executeur, unsigned int maxEnCours)
+    : mPool(nullptr), mExecuteur(&executeur), mMaxEnCours(maxEnCours > 0 ? maxEnCours : 1),
+      mEnCours(0), mGeneration(0), mNbContextes(0) {
+    mContextes.reserve(mMaxEnCours);
+}
+
+cCodecAsynchrone::~cCodecAsynchrone() {
+    // Les tâches encore dans la file de l'exécuteur référencent l'instance :
+    // elles sont annulées, mais il faut attendre qu'elles aient été dépilées
+    annulerTout();
+    attendre();
+
+    delete mPool;
+    for (cContexteCodec* contexte : mContextes) {
+        delete contexte;
+    }
+}
+
+tJetonAnnulation cCodecAsynchrone::creerJeton() {
+    return make_shared<atomic<bool>>(false);
+}
+
+future<sResultatCodec> cCodecAsynchrone::compresserAsync(vector<unsigned char> pixels, unsigned int largeur,
+                                                         unsigned int hauteur, unsigned int qualite,
+                                                         tJetonAnnulation jeton) {
+    auto travail = [pixels = move(pixels), largeur, hauteur, qualite](cContexteCodec& contexte,
+                                                                     sResultatCodec& resultat) {
+        if (pixels.size() < static_cast<size_t>(largeur) * hauteur) {
+            cerr << "Erreur: Image plus petite que " << largeur << "x" << hauteur << endl;
+            return;
+        }
+        if (!contexte.compresserMemoire(pixels.data(), largeur, hauteur, qualite)) {
+            return;
+        }
+        resultat.donnees.assign(contexte.getFlux(), contexte.getFlux() + contexte.getTailleFlux());
+        resultat.largeur = largeur;
+        resultat.hauteur = hauteur;
+        resultat.statut = TACHE_REUSSIE;
+    };
+    return soumettre(move(travail), move(jeton));
+}
+
+future<sResultatCodec> cCodecAsynchrone::decompresserAsync(vector<unsigned char> flux, tJetonAnnulation jeton) {
+    auto travail = [flux = move(flux)](cContexteCodec& contexte, sResultatCodec& resultat) {
+        if (!contexte.decompresserMemoire(flux.data(), flux.size())) {
+            return;
+        }
+        unsigned int largeur = contexte.getLargeur();
+        unsigned int hauteur = contexte.getHauteur();
+        unsigned char** buffer = contexte.getBuffer();
+        resultat.donnees.resize(static_cast<size_t>(largeur) * hauteur);
+        for (unsigned int i = 0; i < hauteur; i++) {
+            copy(buffer[i], buffer[i] + largeur, resultat.donnees.begin() + static_cast<size_t>(i) * largeur);
+        }
+        resultat.largeur = largeur;
+        resultat.hauteur = hauteur;
+        resultat.statut = TACHE_REUSSIE;
+    };
+    return soumettre(move(travail), move(jeton));
+}
+
+future<sResultatCodec> cCodecAsynchrone::soumettre(function<void(cContexteCodec&, sResultatCodec&)> travail,
+                                                   tJetonAnnulation jeton) {
+    shared_ptr<promise<sResultatCodec>> promesse = make_shared<promise<sResultatCodec>>();
+    future<sResultatCodec> resultat = promesse->get_future();
+
+    // 1. Contre-pression : refus immédiat plutôt que blocage de l'appelant
+    unsigned long long generation;
+    {
+        lock_guard<mutex> verrou(mVerrou);
+        if (mEnCours >= mMaxEnCours) {
+            sResultatCodec refus;
+            refus.statut = TACHE_REFUSEE;
+            promesse->set_value(move(refus));
+            return resultat;
+        }
+        mEnCours++;
+        generation = mGeneration;
+    }
+
+    // 2. Tâche : annulée si demandé avant son début, sinon exécutée avec un contexte emprunté
+    try {
+        mExecuteur->executer([this, promesse, travail = move(travail), jeton = move(jeton), generation]() {
+            sResultatCodec sortie;
+            bool annulee;
+            {
+                lock_guard<mutex> verrou(mVerrou);
+                annulee = generation != mGeneration;
+            }
+            annulee = annulee || (jeton && jeton->load());
+
+            cContexteCodec* contexte = nullptr;
+            exception_ptr erreur;
+            try {
+                if (annulee) {
+                    sortie.statut = TACHE_ANNULEE;
+                } else {
+                    contexte = emprunterContexte();
+                    travail(*contexte, sortie);
+                }
+            } catch (...) {
+                // bad_alloc... : l'erreur est rendue par le future, et le contexte,
+                // peut-être à moitié agrandi, n'est pas remis dans la réserve
+                erreur = current_exception();
+                if (contexte) {
+                    delete contexte;
+                    contexte = nullptr;
+                    lock_guard<mutex> verrou(mVerrou);
+                    mNbContextes--;
+                }
+            }
+
+            // L'instance n'est plus utilisée après terminer() : elle peut être détruite
+            terminer(contexte);
+            if (erreur) {
+                promesse->set_exception(erreur);
+            } else {
+                promesse->set_value(move(sortie));
+            }
+        });
+    } catch (...) {
+        // Tâche non acceptée (bad_alloc, exécuteur plein...) : elle ne sera
+        // jamais exécutée, elle est donc terminée ici et l'erreur rendue par le future
+        terminer(nullptr);
+        promesse->set_exception(current_exception());
+    }
+
+    return resultat;
+}
+
+cContexteCodec* cCodecAsynchrone::emprunterContexte() {
+    lock_guard<mutex> verrou(mVerrou);
+    if (mContextes.empty()) {
+        cContexteCodec* contexte = new cContexteCodec();
+        mNbContextes++;
+        return contexte;
+    }
+    cContexteCodec* contexte = mContextes.back();
+    mContextes.pop_back();
+    return contexte;
+}
+
+void cCodecAsynchrone::terminer(cContexteCodec* contexte) {
+    // Signal sous le verrou : le destructeur, réveillé par mEnCours == 0, ne
+    // peut pas détruire mTermine avant la fin de notify_all()
+    lock_guard<mutex> verrou(mVerrou);
+    if (contexte) {
+        mContextes.push_back(contexte);
+    }
+    mEnCours--;
+    mTermine.notify_all();
+}
+
+void cCodecAsynchrone::annulerTout() {
+    lock_guard<mutex> verrou(mVerrou);
+    mGeneration++;
+}
+
+void cCodecAsynchrone::attendre() {
+    unique_lock<mutex> verrou(mVerrou);
+    mTermine.wait(verrou, [this] { return mEnCours == 0; });
+}
+
+unsigned int cCodecAsynchrone::getEnCours() {
+    lock_guard<mutex> verrou(mVerrou);
+    return mEnCours;
+}
+
+unsigned int cCodecAsynchrone::getNbContextes() {
+    lock_guard<mutex> verrou(mVerrou);
+    return mNbContextes;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file cCodecAsynchrone.h
+ * @brief Déclaration de la classe cCodecAsynchrone (codage et décodage en tâche de fond)
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef CCODECASYNCHRONE_H
+#define CCODECASYNCHRONE_H
+
+#include "cContexteCodec.h"
+#include "cPoolThreads.h"
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @enum eStatutTache
+ * @brief Issue d'une tâche du codec asynchrone
+ */
+enum eStatutTache {
+    TACHE_REUSSIE = 0,  ///< Résultat disponible
+    TACHE_ECHEC,        ///< Entrée invalide (image ou flux)
+    TACHE_ANNULEE,      ///< Annulée avant son exécution
+    TACHE_REFUSEE       ///< Refusée à la soumission : trop de tâches en cours
+};
+
+/**
+ * @struct sResultatCodec
+ * @brief Résultat d'une tâche du codec asynchrone
+ */
+struct sResultatCodec {
+    eStatutTache statut;                ///< Issue de la tâche
+    unsigned int largeur;               ///< Largeur de l'image
+    unsigned int hauteur;               ///< Hauteur de l'image
+    std::vector<unsigned char> donnees; ///< Flux .dat (codage) ou pixels ligne par ligne (décodage)
+
+    sResultatCodec() : statut(TACHE_ECHEC), largeur(0), hauteur(0) {}
+};
+
+/// Jeton d'annulation partagé entre l'appelant et une tâche
+typedef std::shared_ptr<std::atomic<bool>> tJetonAnnulation;
+
+/**
+ * @class cCodecAsynchrone
+ * @brief Codage et décodage d'images en niveaux de gris sans bloquer l'appelant
+ *
+ * compresserAsync() et decompresserAsync() rendent immédiatement un
+ * std::future ; le travail est fait sur un exécuteur, le pool interne ou
+ * celui fourni par l'application. Chaque tâche emprunte un cContexteCodec à
+ * une réserve : une fois chauffés, les contextes ne font plus d'allocation
+ * pour le codec lui-même.
+ *
+ * Contre-pression : au-delà de getMaxEnCours() tâches soumises et non
+ * terminées, une soumission est refusée (future déjà prêt, statut
+ * TACHE_REFUSEE) au lieu de bloquer l'appelant. Le nombre de contextes, et
+ * donc la mémoire, est borné par la même limite.
+ *
+ * Annulation : une tâche dont le jeton passe à true, ou soumise avant un
+ * appel à annulerTout(), se termine avec TACHE_ANNULEE sans rien calculer si
+ * elle n'a pas encore commencé. Une tâche commencée va à son terme.
+ *
+ * Une exception levée pendant le travail (bad_alloc...) est rendue par
+ * le future ; la tâche compte comme terminée et son contexte est détruit.
+ * Il en va de même si l'exécuteur lève une exception au lieu d'accepter la
+ * tâche : attendre() et le destructeur ne l'attendent pas.
+ */
+class cCodecAsynchrone {
+private:
+    cPoolThreads* mPool;                        ///< Pool interne (nullptr si exécuteur fourni)
+    cExecuteur* mExecuteur;                     ///< Exécuteur des tâches
+    unsigned int mMaxEnCours;                   ///< Nombre maximal de tâches en cours
+    unsigned int mEnCours;                      ///< Tâches soumises et non terminées
+    unsigned long long mGeneration;             ///< Incrémentée par annulerTout()
+    std::vector<cContexteCodec*> mContextes;    ///< Contextes libres
+    unsigned int mNbContextes;                  ///< Contextes créés
+    std::mutex mVerrou;                         ///< Protège les membres ci-dessus
+    std::condition_variable mTermine;           ///< Signale la fin d'une tâche
+
+public:
+    /**
+     * @brief Constructeur avec pool interne
+     * @param nbThreads Nombre de threads du pool (0 = nombre de cœurs)
+     * @param maxEnCours Nombre maximal de tâches en cours (0 = deux par thread)
+     */
+    explicit cCodecAsynchrone(unsigned int nbThreads = 0, unsigned int maxEnCours = 0);
+
+    /**
+     * @brief Constructeur avec exécuteur fourni
+     *
+     * L'exécuteur doit rester valide et continuer d'exécuter les tâches
+     * jusqu'à la destruction du codec.
+     * @param executeur Exécuteur des tâches
+     * @param maxEnCours Nombre maximal de tâches en cours (au moins 1)
+     */
+    cCodecAsynchrone(cExecuteur& executeur, unsigned int maxEnCours);
+
+    /**
+     * @brief Destructeur : annule les tâches non commencées et attend les autres
+     */
+    ~cCodecAsynchrone();
+
+    // Non copiable : les tâches en cours référencent l'instance
+    cCodecAsynchrone(const cCodecAsynchrone&) = delete;
+    cCodecAsynchrone& operator=(const cCodecAsynchrone&) = delete;
+
+    /**
+     * @brief Compresse une image en tâche de fond
+     * @param pixels Pixels de l'image (hauteur lignes de largeur octets)
+     * @param largeur Largeur de l'image
+     * @param hauteur Hauteur de l'image
+     * @param qualite Qualité de compression (0-100)
+     * @param jeton Jeton d'annulation (optionnel)
+     * @return Future du flux .dat séquentiel
+     */
+    std::future<sResultatCodec> compresserAsync(std::vector<unsigned char> pixels, unsigned int largeur,
+                                                unsigned int hauteur, unsigned int qualite,
+                                                tJetonAnnulation jeton = tJetonAnnulation());
+
+    /**
+     * @brief Décompresse un flux séquentiel en tâche de fond
+     * @param flux Flux compressé (format .dat séquentiel)
+     * @param jeton Jeton d'annulation (optionnel)
+     * @return Future de l'image décodée
+     */
+    std::future<sResultatCodec> decompresserAsync(std::vector<unsigned char> flux,
+                                                  tJetonAnnulation jeton = tJetonAnnulation());
+
+    /**
+     * @brief Annule toutes les tâches soumises qui n'ont pas encore commencé
+     */
+    void annulerTout();
+
+    /**
+     * @brief Attend la fin de toutes les tâches soumises
+     */
+    void attendre();
+
+    /**
+     * @brief Crée un jeton d'annulation (à false)
+     */
+    static tJetonAnnulation creerJeton();
+
+    unsigned int getMaxEnCours() const { return mMaxEnCours; }
+    unsigned int getEnCours();
+    unsigned int getNbContextes();
+
+private:
+    /**
+     * @brief Soumet une tâche à l'exécuteur si la limite le permet
+     * @param travail Codage ou décodage à faire avec un contexte emprunté
+     * @param jeton Jeton d'annulation (peut être vide)
+     * @return Future du résultat (déjà prêt avec TACHE_REFUSEE si la limite est atteinte)
+     */
+    std::future<sResultatCodec> soumettre(std::function<void(cContexteCodec&, sResultatCodec&)> travail,
+                                          tJetonAnnulation jeton);
+
+    /**
+     * @brief Emprunte un contexte libre (ou en crée un)
+     */
+    cContexteCodec* emprunterContexte();
+
+    /**
+     * @brief Rend un contexte et signale la fin de la tâche
+     */
+    void terminer(cContexteCodec* contexte);
+};
+
+#endif // CCODECASYNCHRONE_H
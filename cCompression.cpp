@@ -1,487 +1,1371 @@
-/**
- * @file cCompression.cpp
- * @brief Implmentation de la classe cCompression
- * @author EL KILI Rim
- * @date 2025
- * @version 1.0
- */
-
-#define _USE_MATH_DEFINES  // Pour M_PI sous Windows
-#include "cCompression.h"
-#include <cmath>
-#include <fstream>
-#include <iostream>
-#include <cstring>
-
-using namespace std;
-
-// Table de quantification JPEG standard pour la luminance
-const int cCompression::TABLE_QUANT[8][8] = {
-    {16, 11, 10, 16, 24, 40, 51, 61},
-    {12, 12, 14, 19, 26, 58, 60, 55},
-    {14, 13, 16, 24, 40, 57, 69, 56},
-    {14, 17, 22, 29, 51, 87, 80, 62},
-    {18, 22, 37, 56, 68, 109, 103, 77},
-    {24, 35, 55, 64, 81, 104, 113, 92},
-    {49, 64, 78, 87, 103, 121, 120, 101},
-    {72, 92, 95, 98, 112, 100, 103, 99}
-};
-
-// Coefficients C(u) et C(v) pour la DCT
-namespace {
-    const double C[8] = {
-        1.0 / sqrt(2.0), 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
-    };
-}
-
-// ========== CONSTRUCTEURS ET DESTRUCTEUR ==========
-
-cCompression::cCompression()
-    : mLargeur(0), mHauteur(0), mBuffer(nullptr), mQualite(50) {
-}
-
-cCompression::cCompression(unsigned int largeur, unsigned int hauteur, unsigned int qualite)
-    : mLargeur(largeur), mHauteur(hauteur), mQualite(qualite), mBuffer(nullptr) {
-
-    // Allocation du buffer
-    allocBuffer(largeur, hauteur);
-}
-
-cCompression::~cCompression() {
-    if (mBuffer) {
-        for (unsigned int i = 0; i < mHauteur; i++) {
-            delete[] mBuffer[i];
-        }
-        delete[] mBuffer;
-    }
-}
-
-// ========== ACCESS ET MUTATEURS ==========
-
-unsigned int cCompression::getLargeur() const { return mLargeur; }
-unsigned int cCompression::getHauteur() const { return mHauteur; }
-unsigned int cCompression::getQualite() const { return mQualite; }
-unsigned char** cCompression::getBuffer() const { return mBuffer; }
-
-void cCompression::setLargeur(unsigned int largeur) { mLargeur = largeur; }
-void cCompression::setHauteur(unsigned int hauteur) { mHauteur = hauteur; }
-void cCompression::setQualite(unsigned int qualite) {
-    if (qualite <= 100) mQualite = qualite;
-}
-
-void cCompression::setBuffer(unsigned char** buffer) { mBuffer = buffer; }
-
-void cCompression::allocBuffer(unsigned int largeur, unsigned int hauteur) {
-    // Librer l'ancien buffer si existe
-    if (mBuffer) {
-        for (unsigned int i = 0; i < mHauteur; i++) {
-            delete[] mBuffer[i];
-        }
-        delete[] mBuffer;
-    }
-
-    // Allouer le nouveau buffer
-    mLargeur = largeur;
-    mHauteur = hauteur;
-    mBuffer = new unsigned char*[mHauteur];
-    for (unsigned int i = 0; i < mHauteur; i++) {
-        mBuffer[i] = new unsigned char[mLargeur];
-        memset(mBuffer[i], 0, mLargeur);
-    }
-}
-
-// ========== FONCTIONS DE BASE DCT/IDCT ==========
-
-void cCompression::Calcul_DCT_Block(char** Block8, double** DCT_Img) {
-    // Initialisation de la matrice de sortie
-    for (int u = 0; u < 8; u++) {
-        for (int v = 0; v < 8; v++) {
-            DCT_Img[u][v] = 0.0;
-        }
-    }
-
-    // Calcul de la DCT
-    for (int u = 0; u < 8; u++) {
-        for (int v = 0; v < 8; v++) {
-            double sum = 0.0;
-
-            for (int x = 0; x < 8; x++) {
-                for (int y = 0; y < 8; y++) {
-                    double cos1 = cos((2 * x + 1) * u * M_PI / 16.0);
-                    double cos2 = cos((2 * y + 1) * v * M_PI / 16.0);
-                    sum += Block8[x][y] * cos1 * cos2;
-                }
-            }
-
-            DCT_Img[u][v] = 0.25 * C[u] * C[v] * sum;
-        }
-    }
-}
-
-void cCompression::Calcul_IDCT(double** DCT_Img, char** Block8) {
-    // Initialisation du bloc de sortie
-    for (int x = 0; x < 8; x++) {
-        for (int y = 0; y < 8; y++) {
-            Block8[x][y] = 0;
-        }
-    }
-
-    // Calcul de la DCT inverse
-    for (int x = 0; x < 8; x++) {
-        for (int y = 0; y < 8; y++) {
-            double sum = 0.0;
-
-            for (int u = 0; u < 8; u++) {
-                for (int v = 0; v < 8; v++) {
-                    double cos1 = cos((2 * x + 1) * u * M_PI / 16.0);
-                    double cos2 = cos((2 * y + 1) * v * M_PI / 16.0);
-                    sum += DCT_Img[u][v] * C[u] * C[v] * cos1 * cos2;
-                }
-            }
-
-            Block8[x][y] = static_cast<char>(round(0.25 * sum));
-        }
-    }
-}
-
-// ========== FONCTIONS DE QUANTIFICATION ==========
-
-void cCompression::calculerTableQuantification(int qualite, int table[8][8]) {
-    double lambda;
-
-    if (qualite < 50) {
-        lambda = 5000.0 / qualite;
-    } else {
-        lambda = 200.0 - 2.0 * qualite;
-    }
-
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            double valeur = (TABLE_QUANT[i][j] * lambda + 50.0) / 100.0;
-
-            // Application des bornes
-            if (valeur < 1.0) {
-                table[i][j] = 1;
-            } else if (valeur > 255.0) {
-                table[i][j] = 255;
-            } else {
-                table[i][j] = static_cast<int>(round(valeur));
-            }
-        }
-    }
-}
-
-void cCompression::quant_JPEG(double** img_DCT, int** Img_Quant) {
-    int table[8][8];
-    calculerTableQuantification(mQualite, table);
-
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            Img_Quant[i][j] = static_cast<int>(round(img_DCT[i][j] / table[i][j]));
-        }
-    }
-}
-
-void cCompression::dequant_JPEG(int** Img_Quant, double** img_DCT) {
-    int table[8][8];
-    calculerTableQuantification(mQualite, table);
-
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            img_DCT[i][j] = Img_Quant[i][j] * table[i][j];
-        }
-    }
-}
-
-// ========== FONCTIONS DE MTRIQUES ==========
-
-double cCompression::EQM(int** Bloc8x8) {
-    // Implmentation simplifie
-    return 0.0;
-}
-
-double cCompression::Taux_Compression(int** Bloc8x8) {
-    int coefficientsNonNuls = 0;
-
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            if (Bloc8x8[i][j] != 0) {
-                coefficientsNonNuls++;
-            }
-        }
-    }
-
-    double taux = (1.0 - static_cast<double>(coefficientsNonNuls) / 64.0) * 100.0;
-    return taux;
-}
-
-// ========== FONCTIONS RLE ==========
-
-int cCompression::RLE_Block(int** Img_Quant, int DC_precedent, char* Trame) {
-    int index = 0;
-
-    // 1. Encoder le coefficient DC (diffrence avec le prcdent)
-    int DC = Img_Quant[0][0];
-    int DC_diff = DC - DC_precedent;
-    Trame[index++] = static_cast<char>(DC_diff);
-
-    // 2. Parcours en zigzag des coefficients AC
-    int zigzag[64][2] = {
-        {0,0}, {0,1}, {1,0}, {2,0}, {1,1}, {0,2}, {0,3}, {1,2},
-        {2,1}, {3,0}, {4,0}, {3,1}, {2,2}, {1,3}, {0,4}, {0,5},
-        {1,4}, {2,3}, {3,2}, {4,1}, {5,0}, {6,0}, {5,1}, {4,2},
-        {3,3}, {2,4}, {1,5}, {0,6}, {0,7}, {1,6}, {2,5}, {3,4},
-        {4,3}, {5,2}, {6,1}, {7,0}, {7,1}, {6,2}, {5,3}, {4,4},
-        {3,5}, {2,6}, {1,7}, {2,7}, {3,6}, {4,5}, {5,4}, {6,3},
-        {7,2}, {7,3}, {6,4}, {5,5}, {4,6}, {3,7}, {4,7}, {5,6},
-        {6,5}, {7,4}, {7,5}, {6,6}, {5,7}, {6,7}, {7,6}, {7,7}
-    };
-
-    int runlength = 0;
-    bool finBloc = false;
-
-    // Parcourir du 2me au 64me coefficient
-    for (int i = 1; i < 64; i++) {
-        int x = zigzag[i][0];
-        int y = zigzag[i][1];
-        int coeff = Img_Quant[x][y];
-
-        if (coeff == 0) {
-            runlength++;
-            // Si c'est le dernier coefficient
-            if (i == 63) {
-                Trame[index++] = static_cast<char>(runlength);
-                Trame[index++] = 0;
-                finBloc = true;
-            }
-        } else {
-            Trame[index++] = static_cast<char>(runlength);
-            Trame[index++] = static_cast<char>(coeff);
-            runlength = 0;
-        }
-    }
-
-    if (!finBloc) {
-        Trame[index++] = 0; // runlength
-        Trame[index++] = 0; // amplitude (fin de bloc)
-    }
-
-    return index;
-}
-
-int cCompression::RLE(int* Trame) {
-    if (!mBuffer || mLargeur == 0 || mHauteur == 0) {
-        return 0;
-    }
-
-    int totalBlocsX = mLargeur / 8;
-    int totalBlocsY = mHauteur / 8;
-    int indexTotal = 0;
-    int DC_precedent = 0;
-
-    // Allocation temporaire pour les blocs
-    unsigned char blocData[8][8];
-    char blocChar[8][8];
-    double dct[8][8];
-    int quant[8][8];
-    char* charPtrs[8];
-    double* doublePtrs[8];
-    int* intPtrs[8];
-
-    for (int i = 0; i < 8; i++) {
-        charPtrs[i] = blocChar[i];
-        doublePtrs[i] = dct[i];
-        intPtrs[i] = quant[i];
-    }
-
-    char trameBloc[128];
-
-    for (int by = 0; by < totalBlocsY; by++) {
-        for (int bx = 0; bx < totalBlocsX; bx++) {
-            // 1. Lire le bloc
-            lireBloc(bx * 8, by * 8, blocData);
-
-            // 2. Conversion en char (-128  127)
-            for (int i = 0; i < 8; i++) {
-                for (int j = 0; j < 8; j++) {
-                    blocChar[i][j] = static_cast<char>(blocData[i][j] - 128);
-                }
-            }
-
-            // 3. Calculer DCT
-            Calcul_DCT_Block(charPtrs, doublePtrs);
-
-            // 4. Quantifier
-            quant_JPEG(doublePtrs, intPtrs);
-
-            // 5. RLE sur le bloc
-            int longueurBloc = RLE_Block(intPtrs, DC_precedent, trameBloc);
-
-            // 6. Mettre  jour DC prcdent
-            DC_precedent = quant[0][0];
-
-            // 7. Copier dans la trame totale
-            for (int i = 0; i < longueurBloc; i++) {
-                Trame[indexTotal++] = trameBloc[i];
-            }
-        }
-    }
-
-    return indexTotal;
-}
-
-// ========== FONCTIONS AUXILIAIRES ==========
-
-void cCompression::decalageNiveau(char** bloc) {
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            bloc[i][j] = static_cast<char>(bloc[i][j] - 128);
-        }
-    }
-}
-
-void cCompression::decalageNiveauInverse(char** bloc) {
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            bloc[i][j] = static_cast<char>(bloc[i][j] + 128);
-        }
-    }
-}
-
-void cCompression::lireBloc(unsigned int x, unsigned int y, unsigned char bloc[8][8]) {
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            unsigned int px = x + j;
-            unsigned int py = y + i;
-
-            if (px < mLargeur && py < mHauteur && mBuffer) {
-                bloc[i][j] = mBuffer[py][px];
-            } else {
-                bloc[i][j] = 0;
-            }
-        }
-    }
-}
-
-void cCompression::ecrireBloc(unsigned int x, unsigned int y, unsigned char bloc[8][8]) {
-    if (!mBuffer) return;
-
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            unsigned int px = x + j;
-            unsigned int py = y + i;
-
-            if (px < mLargeur && py < mHauteur) {
-                mBuffer[py][px] = bloc[i][j];
-            }
-        }
-    }
-}
-
-bool cCompression::chargerImage(const char* nomFichier) {
-    ifstream fichier(nomFichier, ios::binary);
-    if (!fichier) {
-        cerr << "Erreur: Impossible d'ouvrir le fichier " << nomFichier << endl;
-        return false;
-    }
-
-    // Pour l'exemple, on suppose une image 256x256
-    mLargeur = 256;
-    mHauteur = 256;
-    allocBuffer(mLargeur, mHauteur);
-
-    for (unsigned int i = 0; i < mHauteur; i++) {
-        fichier.read(reinterpret_cast<char*>(mBuffer[i]), mLargeur);
-    }
-
-    fichier.close();
-    return true;
-}
-
-bool cCompression::chargerImageTexte(const char* nomFichier, unsigned int largeur, unsigned int hauteur) {
-    ifstream fichier(nomFichier);
-    if (!fichier) {
-        cerr << "Erreur: Impossible d'ouvrir " << nomFichier << endl;
-        return false;
-    }
-
-    // Allouer le buffer
-    allocBuffer(largeur, hauteur);
-
-    // Lecture des valeurs
-    for (unsigned int i = 0; i < hauteur; i++) {
-        for (unsigned int j = 0; j < largeur; j++) {
-            int valeur;
-            fichier >> valeur;
-
-            // Saturation
-            if (valeur < 0) valeur = 0;
-            if (valeur > 255) valeur = 255;
-
-            mBuffer[i][j] = static_cast<unsigned char>(valeur);
-        }
-    }
-
-    fichier.close();
-
-    cout << "Image texte charge: " << nomFichier << " ("
-         << largeur << "x" << hauteur << ")" << endl;
-
-    return true;
-}
-
-bool cCompression::compresser(const char* nomFichierSortie) {
-    if (!mBuffer) {
-        cerr << "Erreur: Aucune image charge" << endl;
-        return false;
-    }
-
-    // 1. Prparer la trame RLE
-    int tailleMaxTrame = (mLargeur / 8) * (mHauteur / 8) * 128;
-    int* trame = new int[tailleMaxTrame];
-
-    // 2. Calculer la trame RLE
-    int longueurTrame = RLE(trame);
-
-    // 3. Sauvegarder
-    ofstream fichier(nomFichierSortie, ios::binary);
-    if (!fichier) {
-        delete[] trame;
-        return false;
-    }
-
-    // crire l'en-tte simplifi
-    fichier.write(reinterpret_cast<const char*>(&mLargeur), sizeof(mLargeur));
-    fichier.write(reinterpret_cast<const char*>(&mHauteur), sizeof(mHauteur));
-    fichier.write(reinterpret_cast<const char*>(&mQualite), sizeof(mQualite));
-    fichier.write(reinterpret_cast<const char*>(&longueurTrame), sizeof(longueurTrame));
-
-    // crire la trame
-    fichier.write(reinterpret_cast<const char*>(trame), longueurTrame * sizeof(int));
-
-    fichier.close();
-    delete[] trame;
-
-    cout << "Compression termine: " << nomFichierSortie << endl;
-    cout << "Taille trame: " << longueurTrame << " entiers" << endl;
-
-    return true;
-}
-
-bool cCompression::sauvegarderImage(const char* nomFichier) {
-    if (!mBuffer) {
-        return false;
-    }
-
-    ofstream fichier(nomFichier, ios::binary);
-    if (!fichier) {
-        return false;
-    }
-
-    for (unsigned int i = 0; i < mHauteur; i++) {
-        fichier.write(reinterpret_cast<const char*>(mBuffer[i]), mLargeur);
-    }
-
-    fichier.close();
-    return true;
-}
+/**
+ * @file cCompression.cpp
+ * @brief Implémentation de la classe cCompression
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "cCompression.h"
+#include "cTablesDCT.h"
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <cstring>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define JPEG_RLE_SSE2
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+// Tables de quantification JPEG standard (valeurs dans cCompression.h)
+constexpr int cCompression::TABLE_QUANT[8][8];
+constexpr int cCompression::TABLE_QUANT_CHROMINANCE[8][8];
+
+// Ordre de parcours zigzag des coefficients d'un bloc 8x8
+const int cCompression::ZIGZAG[64][2] = {
+    {0,0}, {0,1}, {1,0}, {2,0}, {1,1}, {0,2}, {0,3}, {1,2},
+    {2,1}, {3,0}, {4,0}, {3,1}, {2,2}, {1,3}, {0,4}, {0,5},
+    {1,4}, {2,3}, {3,2}, {4,1}, {5,0}, {6,0}, {5,1}, {4,2},
+    {3,3}, {2,4}, {1,5}, {0,6}, {0,7}, {1,6}, {2,5}, {3,4},
+    {4,3}, {5,2}, {6,1}, {7,0}, {7,1}, {6,2}, {5,3}, {4,4},
+    {3,5}, {2,6}, {1,7}, {2,7}, {3,6}, {4,5}, {5,4}, {6,3},
+    {7,2}, {7,3}, {6,4}, {5,5}, {4,6}, {3,7}, {4,7}, {5,6},
+    {6,5}, {7,4}, {7,5}, {6,6}, {5,7}, {6,7}, {7,6}, {7,7}
+};
+
+// Position en ordre naturel (ligne x 8 + colonne) du k-ième coefficient zigzag
+const int cCompression::ORDRE_NATUREL[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10,
+    17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34,
+    27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36,
+    29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46,
+    53, 60, 61, 54, 47, 55, 62, 63
+};
+
+// Passes du mode progressif : DC, puis AC basses, moyennes et hautes fréquences
+const int cCompression::BANDES_PROGRESSIF[cCompression::NB_PASSES_PROGRESSIF][2] = {
+    {0, 0}, {1, 5}, {6, 20}, {21, 63}
+};
+
+// Coefficients C(u) et C(v) pour la DCT
+namespace {
+    constexpr double C[8] = {
+        RACINE_DEMI, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0
+    };
+
+    // Matrice de la DCT 1D en simple précision : A[u][x] = C(u) / 2 x cos((2x + 1) u pi / 16)
+    struct MatriceDCTFloat {
+        float A[8][8];
+        constexpr MatriceDCTFloat() : A() {
+            for (int u = 0; u < 8; u++) {
+                for (int x = 0; x < 8; x++) {
+                    A[u][x] = static_cast<float>(0.5 * C[u] * TABLE_COSINUS<8>.c[u][x]);
+                }
+            }
+        }
+    };
+    constexpr MatriceDCTFloat DCT_FLOAT;
+
+    // Tables de quantification des qualités courantes, calculées à la compilation
+    // avec la même formule que calculerTableQuantification
+    struct TableQuantPreset {
+        int qualite;
+        bool chrominance;
+        int valeurs[8][8];
+
+        constexpr TableQuantPreset(int q, const int (&base)[8][8], bool chroma)
+            : qualite(q), chrominance(chroma), valeurs() {
+            double lambda = q < 50 ? 5000.0 / q : 200.0 - 2.0 * q;
+            for (int i = 0; i < 8; i++) {
+                for (int j = 0; j < 8; j++) {
+                    double valeur = (base[i][j] * lambda + 50.0) / 100.0;
+                    valeurs[i][j] = valeur < 1.0 ? 1 : valeur > 255.0 ? 255 : static_cast<int>(valeur + 0.5);
+                }
+            }
+        }
+    };
+
+    // Bit k à 1 si le k-ième coefficient est non nul (comparaisons SSE2, 4 par 4)
+    unsigned long long masqueNonNuls(const int* coefficients) {
+        unsigned long long masque = 0;
+#ifdef JPEG_RLE_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        for (int k = 0; k < 64; k += 4) {
+            __m128i valeurs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(coefficients + k));
+            int nuls = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(valeurs, zero)));
+            masque |= static_cast<unsigned long long>(~nuls & 0xF) << k;
+        }
+#else
+        for (int k = 0; k < 64; k++) {
+            masque |= static_cast<unsigned long long>(coefficients[k] != 0) << k;
+        }
+#endif
+        return masque;
+    }
+
+    // Position du bit à 1 de poids le plus faible (masque non nul)
+    int premierBit(unsigned long long masque) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(masque);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long position;
+        _BitScanForward64(&position, masque);
+        return static_cast<int>(position);
+#else
+        int position = 0;
+        while (!(masque & 1)) {
+            masque >>= 1;
+            position++;
+        }
+        return position;
+#endif
+    }
+
+    // Trame RLE d'un bloc en ordre zigzag : chaque paire est produite en
+    // sautant directement au coefficient non nul suivant du masque
+    template <typename T>
+    int coderRLEMasque(const int* coefficientsZigzag, int DC_precedent, T* Trame) {
+        int index = 0;
+        Trame[index++] = static_cast<T>(coefficientsZigzag[0] - DC_precedent);
+
+        unsigned long long masque = masqueNonNuls(coefficientsZigzag) & ~1ULL;
+        int precedent = 0;
+        while (masque) {
+            int k = premierBit(masque);
+            Trame[index++] = static_cast<T>(k - precedent - 1);
+            Trame[index++] = static_cast<T>(coefficientsZigzag[k]);
+            precedent = k;
+            masque &= masque - 1;
+        }
+
+        // Fin de bloc : (zéros restants, 0), soit (0,0) si le dernier est non nul
+        Trame[index++] = static_cast<T>(63 - precedent);
+        Trame[index++] = 0;
+        return index;
+    }
+}
+
+// ========== CONSTRUCTEURS ET DESTRUCTEUR ==========
+
+cCompression::cCompression()
+    : mLargeur(0), mHauteur(0), mBuffer(nullptr), mQualite(50), mPrecisionSimple(false) {
+}
+
+cCompression::cCompression(unsigned int largeur, unsigned int hauteur, unsigned int qualite)
+    : mLargeur(largeur), mHauteur(hauteur), mQualite(qualite), mBuffer(nullptr), mPrecisionSimple(false) {
+
+    // Allocation du buffer
+    allocBuffer(largeur, hauteur);
+}
+
+cCompression::~cCompression() {
+    libererBuffer();
+}
+
+// ========== ACCESS ET MUTATEURS ==========
+
+unsigned int cCompression::getLargeur() const { return mLargeur; }
+unsigned int cCompression::getHauteur() const { return mHauteur; }
+unsigned int cCompression::getQualite() const { return mQualite; }
+unsigned char** cCompression::getBuffer() const { return mBuffer; }
+
+void cCompression::setLargeur(unsigned int largeur) { mLargeur = largeur; }
+void cCompression::setHauteur(unsigned int hauteur) { mHauteur = hauteur; }
+void cCompression::setQualite(unsigned int qualite) {
+    if ((qualite & ~QUALITE_TABLE_TRANSPOSEE) <= 100) mQualite = qualite;
+}
+
+void cCompression::setBuffer(unsigned char** buffer) {
+    mBuffer = buffer;
+    mCoefficientsDCT.clear();
+}
+
+#ifdef JPEG_INSTRUMENTATION
+cInstrumentation& cCompression::getInstrumentation() { return mInstrumentation; }
+const cInstrumentation& cCompression::getInstrumentation() const { return mInstrumentation; }
+#endif
+
+void cCompression::libererBuffer() {
+    if (mBuffer) {
+        for (unsigned int i = 0; i < mHauteur; i++) {
+            delete[] mBuffer[i];
+        }
+        delete[] mBuffer;
+        mBuffer = nullptr;
+    }
+}
+
+void cCompression::allocBuffer(unsigned int largeur, unsigned int hauteur) {
+    // Libérer l'ancien buffer si existe
+    libererBuffer();
+
+    // Allouer le nouveau buffer (lignes à nullptr d'abord : l'objet reste
+    // destructible si une allocation échoue)
+    mCoefficientsDCT.clear();
+    mLargeur = largeur;
+    mHauteur = hauteur;
+    mBuffer = new unsigned char*[mHauteur]();
+    for (unsigned int i = 0; i < mHauteur; i++) {
+        mBuffer[i] = new unsigned char[mLargeur];
+        memset(mBuffer[i], 0, mLargeur);
+    }
+    JPEG_INSTR(mInstrumentation.compterAllocation(mHauteur + 1));
+}
+
+// ========== FONCTIONS DE BASE DCT/IDCT ==========
+
+void cCompression::Calcul_DCT_Block(char** Block8, double** DCT_Img) {
+    // Cosinus lus dans la table construite à la compilation
+    dctDirecte<8>(Block8, DCT_Img);
+}
+
+void cCompression::Calcul_IDCT(double** DCT_Img, char** Block8) {
+    idctDirecte<8>(DCT_Img, Block8);
+}
+
+void cCompression::Calcul_DCT_Block_Float(char** Block8, float** DCT_Img) {
+    // 1. DCT 1D des colonnes : T[u][y] = somme sur x de A[u][x] x bloc[x][y]
+    float T[8][8] = {};
+    for (int u = 0; u < 8; u++) {
+        for (int x = 0; x < 8; x++) {
+            float a = DCT_FLOAT.A[u][x];
+            for (int y = 0; y < 8; y++) {
+                T[u][y] += a * Block8[x][y];
+            }
+        }
+    }
+
+    // 2. DCT 1D des lignes : F[u][v] = somme sur y de T[u][y] x A[v][y]
+    for (int u = 0; u < 8; u++) {
+        for (int v = 0; v < 8; v++) {
+            float somme = 0.0f;
+            for (int y = 0; y < 8; y++) {
+                somme += T[u][y] * DCT_FLOAT.A[v][y];
+            }
+            DCT_Img[u][v] = somme;
+        }
+    }
+}
+
+void cCompression::Calcul_DCT_Quant_Lot(const float lot[64][TAILLE_LOT], const int table[8][8],
+                                        int coefficientsZigzag[][64]) {
+    // 1. DCT 1D des colonnes de tous les blocs : T[u][y][b] = somme sur x de A[u][x] x lot[x][y][b]
+    float T[64][TAILLE_LOT] = {};
+    for (int u = 0; u < 8; u++) {
+        for (int x = 0; x < 8; x++) {
+            float a = DCT_FLOAT.A[u][x];
+            for (int y = 0; y < 8; y++) {
+                float* t = T[u * 8 + y];
+                const float* pixels = lot[x * 8 + y];
+                for (int b = 0; b < TAILLE_LOT; b++) {
+                    t[b] += a * pixels[b];
+                }
+            }
+        }
+    }
+
+    // 2. DCT 1D des lignes et quantification, coefficient par coefficient en ordre zigzag
+    for (int k = 0; k < 64; k++) {
+        int u = ORDRE_NATUREL[k] / 8;
+        int v = ORDRE_NATUREL[k] % 8;
+
+        float somme[TAILLE_LOT] = {};
+        for (int y = 0; y < 8; y++) {
+            float a = DCT_FLOAT.A[v][y];
+            const float* t = T[u * 8 + y];
+            for (int b = 0; b < TAILLE_LOT; b++) {
+                somme[b] += t[b] * a;
+            }
+        }
+
+        float pas = static_cast<float>(table[u][v]);
+        for (int b = 0; b < TAILLE_LOT; b++) {
+            coefficientsZigzag[b][k] = static_cast<int>(round(somme[b] / pas));
+        }
+    }
+}
+
+void cCompression::Calcul_IDCT_Float(float** DCT_Img, char** Block8) {
+    // 1. IDCT 1D des colonnes : T[x][v] = somme sur u de A[u][x] x F[u][v]
+    float T[8][8] = {};
+    for (int x = 0; x < 8; x++) {
+        for (int u = 0; u < 8; u++) {
+            float a = DCT_FLOAT.A[u][x];
+            for (int v = 0; v < 8; v++) {
+                T[x][v] += a * DCT_Img[u][v];
+            }
+        }
+    }
+
+    // 2. IDCT 1D des lignes : bloc[x][y] = somme sur v de T[x][v] x A[v][y]
+    for (int x = 0; x < 8; x++) {
+        float ligne[8] = {};
+        for (int v = 0; v < 8; v++) {
+            float t = T[x][v];
+            for (int y = 0; y < 8; y++) {
+                ligne[y] += t * DCT_FLOAT.A[v][y];
+            }
+        }
+        for (int y = 0; y < 8; y++) {
+            Block8[x][y] = static_cast<char>(round(ligne[y]));
+        }
+    }
+}
+
+void cCompression::Calcul_IDCT_Reduite(double** DCT_Img, char** Block, int taille) {
+    if (taille >= 8) {
+        Calcul_IDCT(DCT_Img, Block);
+        return;
+    }
+
+    // Bloc 1x1 : seul le coefficient DC intervient
+    if (taille <= 1) {
+        Block[0][0] = static_cast<char>(round(DCT_Img[0][0] / 8.0));
+        return;
+    }
+
+    // IDCT sur taille points avec les mêmes facteurs de normalisation
+    if (taille == 4) {
+        idctDirecte<4, 8>(DCT_Img, Block);
+    } else {
+        idctDirecte<2, 8>(DCT_Img, Block);
+    }
+}
+
+void cCompression::Calcul_IDCT_DC(double DC, char** Block, int taille) {
+    // Même expression que le terme (0,0) de Calcul_IDCT (cosinus égaux à 1)
+    char valeur;
+    if (taille <= 1) {
+        valeur = static_cast<char>(round(DC / 8.0));
+        taille = 1;
+    } else {
+        valeur = static_cast<char>(round(0.25 * (DC * C[0] * C[0])));
+    }
+
+    for (int x = 0; x < taille; x++) {
+        for (int y = 0; y < taille; y++) {
+            Block[x][y] = valeur;
+        }
+    }
+}
+
+bool cCompression::estBlocUniforme(char** Block8, int pasMinimal, double& DC) {
+    int minimum = Block8[0][0];
+    int maximum = Block8[0][0];
+    int somme = 0;
+    for (int x = 0; x < 8; x++) {
+        for (int y = 0; y < 8; y++) {
+            int valeur = Block8[x][y];
+            minimum = min(minimum, valeur);
+            maximum = max(maximum, valeur);
+            somme += valeur;
+        }
+    }
+
+    // |AC| <= 0.25 x (max - min) / 2 x (C(u) x somme des |cos|)^2 <= 4 x (max - min)
+    if (8 * (maximum - minimum) >= pasMinimal) {
+        return false;
+    }
+
+    DC = 0.25 * C[0] * C[0] * somme;
+    return true;
+}
+
+// ========== FONCTIONS DE QUANTIFICATION ==========
+
+int cCompression::pasMinimalAC(const int table[8][8]) {
+    int pas = table[0][1];
+    for (int i = 0; i < 8; i++) {
+        for (int j = (i == 0 ? 1 : 0); j < 8; j++) {
+            pas = min(pas, table[i][j]);
+        }
+    }
+    return pas;
+}
+
+void cCompression::calculerTableQuantification(int qualite, int table[8][8], bool chrominance) {
+    bool transposee = (qualite & QUALITE_TABLE_TRANSPOSEE) != 0;
+    qualite &= ~QUALITE_TABLE_TRANSPOSEE;
+
+    double lambda;
+
+    if (qualite < 50) {
+        lambda = 5000.0 / qualite;
+    } else {
+        lambda = 200.0 - 2.0 * qualite;
+    }
+
+    // Qualités courantes : table calculée à la compilation
+    static constexpr TableQuantPreset PRESETS[] = {
+        TableQuantPreset(25, TABLE_QUANT, false), TableQuantPreset(25, TABLE_QUANT_CHROMINANCE, true),
+        TableQuantPreset(50, TABLE_QUANT, false), TableQuantPreset(50, TABLE_QUANT_CHROMINANCE, true),
+        TableQuantPreset(75, TABLE_QUANT, false), TableQuantPreset(75, TABLE_QUANT_CHROMINANCE, true),
+        TableQuantPreset(90, TABLE_QUANT, false), TableQuantPreset(90, TABLE_QUANT_CHROMINANCE, true)
+    };
+
+    const TableQuantPreset* preset = nullptr;
+    for (const TableQuantPreset& candidat : PRESETS) {
+        if (candidat.qualite == qualite && candidat.chrominance == chrominance) {
+            preset = &candidat;
+        }
+    }
+
+    const int (*base)[8] = chrominance ? TABLE_QUANT_CHROMINANCE : TABLE_QUANT;
+
+    if (preset) {
+        memcpy(table, preset->valeurs, sizeof(preset->valeurs));
+    }
+
+    for (int i = 0; i < 8 && !preset; i++) {
+        for (int j = 0; j < 8; j++) {
+            double valeur = (base[i][j] * lambda + 50.0) / 100.0;
+
+            // Application des bornes
+            if (valeur < 1.0) {
+                table[i][j] = 1;
+            } else if (valeur > 255.0) {
+                table[i][j] = 255;
+            } else {
+                table[i][j] = static_cast<int>(round(valeur));
+            }
+        }
+    }
+
+    if (transposee) {
+        for (int i = 0; i < 8; i++) {
+            for (int j = i + 1; j < 8; j++) {
+                int temp = table[i][j];
+                table[i][j] = table[j][i];
+                table[j][i] = temp;
+            }
+        }
+    }
+}
+
+void cCompression::quant_JPEG(double** img_DCT, int** Img_Quant) {
+    int table[8][8];
+    calculerTableQuantification(mQualite, table);
+
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            Img_Quant[i][j] = static_cast<int>(round(img_DCT[i][j] / table[i][j]));
+        }
+    }
+}
+
+void cCompression::dequant_JPEG(int** Img_Quant, double** img_DCT) {
+    int table[8][8];
+    calculerTableQuantification(mQualite, table);
+
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            img_DCT[i][j] = Img_Quant[i][j] * table[i][j];
+        }
+    }
+}
+
+void cCompression::quant_JPEG_Float(float** img_DCT, int** Img_Quant) {
+    int table[8][8];
+    calculerTableQuantification(mQualite, table);
+
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            Img_Quant[i][j] = static_cast<int>(round(img_DCT[i][j] / table[i][j]));
+        }
+    }
+}
+
+void cCompression::dequant_JPEG_Float(int** Img_Quant, float** img_DCT) {
+    int table[8][8];
+    calculerTableQuantification(mQualite, table);
+
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            img_DCT[i][j] = static_cast<float>(Img_Quant[i][j] * table[i][j]);
+        }
+    }
+}
+
+// ========== FONCTIONS DE MÉTRIQUES ==========
+
+double cCompression::EQM(int** Bloc8x8) {
+    // Implémentation simplifiée
+    return 0.0;
+}
+
+double cCompression::Taux_Compression(int** Bloc8x8) {
+    int coefficientsNonNuls = 0;
+
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            if (Bloc8x8[i][j] != 0) {
+                coefficientsNonNuls++;
+            }
+        }
+    }
+
+    double taux = (1.0 - static_cast<double>(coefficientsNonNuls) / 64.0) * 100.0;
+    return taux;
+}
+
+// ========== FONCTIONS RLE ==========
+
+int cCompression::RLE_Block(int** Img_Quant, int DC_precedent, char* Trame) {
+    // Mise en ordre zigzag, puis codage des seuls coefficients non nuls
+    int coefficientsZigzag[64];
+    for (int k = 0; k < 64; k++) {
+        coefficientsZigzag[k] = Img_Quant[ZIGZAG[k][0]][ZIGZAG[k][1]];
+    }
+
+    return coderRLEMasque(coefficientsZigzag, DC_precedent, Trame);
+}
+
+int cCompression::RLE_Zigzag(const int* coefficientsZigzag, int DC_precedent, int* Trame) {
+    return coderRLEMasque(coefficientsZigzag, DC_precedent, Trame);
+}
+
+int cCompression::RLE(int* Trame) {
+    if (!mBuffer || mLargeur == 0 || mHauteur == 0) {
+        return 0;
+    }
+
+    int totalBlocsX = mLargeur / 8;
+    int totalBlocsY = mHauteur / 8;
+    int indexTotal = 0;
+    int DC_precedent = 0;
+
+    // Allocation temporaire pour les blocs
+    unsigned char blocData[8][8];
+    char blocChar[8][8];
+    double dct[8][8];
+    int quant[8][8];
+    char* charPtrs[8];
+    double* doublePtrs[8];
+    int* intPtrs[8];
+
+    for (int i = 0; i < 8; i++) {
+        charPtrs[i] = blocChar[i];
+        doublePtrs[i] = dct[i];
+        intPtrs[i] = quant[i];
+    }
+
+    // Simple précision : les blocs d'une ligne sont transformés par lots
+    float lot[64][TAILLE_LOT];
+    int coefficientsLot[TAILLE_LOT][64];
+    bool uniforme[TAILLE_LOT];
+    int tailleLot = mPrecisionSimple ? TAILLE_LOT : 1;
+
+    int trameBloc[130];
+
+    // Table et seuil des blocs uniformes, communs à tous les blocs
+    int table[8][8];
+    calculerTableQuantification(mQualite, table);
+    int pasMinimal = pasMinimalAC(table);
+
+    for (int by = 0; by < totalBlocsY; by++) {
+        for (int bx0 = 0; bx0 < totalBlocsX; bx0 += tailleLot) {
+            int nbBlocs = min(tailleLot, totalBlocsX - bx0);
+
+            for (int b = 0; b < nbBlocs; b++) {
+                int* coefficients = coefficientsLot[b];
+                {
+                    JPEG_CHRONO(mInstrumentation, ETAPE_DECALAGE);
+
+                    // 1. Lire le bloc
+                    lireBloc((bx0 + b) * 8, by * 8, blocData);
+
+                    // 2. Conversion en char (-128 à 127)
+                    for (int i = 0; i < 8; i++) {
+                        for (int j = 0; j < 8; j++) {
+                            blocChar[i][j] = static_cast<char>(blocData[i][j] - 128);
+                        }
+                    }
+                }
+
+                // 3-4. Bloc uniforme : DC seul, sans DCT ni quantification des AC
+                double DC;
+                uniforme[b] = estBlocUniforme(charPtrs, pasMinimal, DC);
+                if (uniforme[b]) {
+                    JPEG_CHRONO(mInstrumentation, ETAPE_QUANTIFICATION);
+                    memset(coefficients, 0, 64 * sizeof(int));
+                    coefficients[0] = static_cast<int>(round(DC / table[0][0]));
+                } else if (mPrecisionSimple) {
+                    // Rangement du bloc dans la colonne b du lot
+                    for (int p = 0; p < 64; p++) {
+                        lot[p][b] = blocChar[p / 8][p % 8];
+                    }
+                } else {
+                    // 3. Calculer DCT
+                    {
+                        JPEG_CHRONO(mInstrumentation, ETAPE_DCT);
+                        Calcul_DCT_Block(charPtrs, doublePtrs);
+                    }
+
+                    // 4. Quantifier, puis ordonner en zigzag
+                    {
+                        JPEG_CHRONO(mInstrumentation, ETAPE_QUANTIFICATION);
+                        quant_JPEG(doublePtrs, intPtrs);
+                        const int* naturel = &quant[0][0];
+                        for (int k = 0; k < 64; k++) {
+                            coefficients[k] = naturel[ORDRE_NATUREL[k]];
+                        }
+                    }
+                }
+            }
+
+            // 3-4. DCT et quantification du lot (colonnes inutilisées à zéro)
+            if (mPrecisionSimple) {
+                JPEG_CHRONO(mInstrumentation, ETAPE_DCT);
+                for (int p = 0; p < 64; p++) {
+                    for (int b = nbBlocs; b < TAILLE_LOT; b++) {
+                        lot[p][b] = 0.0f;
+                    }
+                }
+                int coefficientsCalcules[TAILLE_LOT][64];
+                Calcul_DCT_Quant_Lot(lot, table, coefficientsCalcules);
+                for (int b = 0; b < nbBlocs; b++) {
+                    if (!uniforme[b]) {
+                        memcpy(coefficientsLot[b], coefficientsCalcules[b], sizeof(coefficientsLot[b]));
+                    }
+                }
+            }
+
+            for (int b = 0; b < nbBlocs; b++) {
+                // 5. RLE sur le bloc, copiée dans la trame totale (pas de codage
+                //    entropique sur ce chemin : ETAPE_ENTROPIE n'est pas comptée)
+                int longueurBloc;
+                {
+                    JPEG_CHRONO(mInstrumentation, ETAPE_RLE);
+                    longueurBloc = RLE_Zigzag(coefficientsLot[b], DC_precedent, trameBloc);
+                    memcpy(Trame + indexTotal, trameBloc, longueurBloc * sizeof(int));
+                    indexTotal += longueurBloc;
+                }
+
+                // 6. Mettre à jour DC précédent
+                DC_precedent = coefficientsLot[b][0];
+
+                // Les blocs uniformes ne passent pas par la DCT
+                JPEG_INSTR(
+                    mInstrumentation.ajouterOctets(ETAPE_DECALAGE, sizeof(blocChar));
+                    if (!uniforme[b]) mInstrumentation.ajouterOctets(ETAPE_DCT, sizeof(dct));
+                    mInstrumentation.ajouterOctets(ETAPE_QUANTIFICATION, sizeof(quant));
+                    mInstrumentation.ajouterOctets(ETAPE_RLE, longueurBloc * sizeof(int));
+                    mInstrumentation.enregistrerBloc(cInstrumentation::positionEOB(trameBloc, longueurBloc))
+                );
+            }
+        }
+    }
+
+    return indexTotal;
+}
+
+// ========== FONCTIONS AUXILIAIRES ==========
+
+void cCompression::decalageNiveau(char** bloc) {
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            bloc[i][j] = static_cast<char>(bloc[i][j] - 128);
+        }
+    }
+}
+
+void cCompression::decalageNiveauInverse(char** bloc) {
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            bloc[i][j] = static_cast<char>(bloc[i][j] + 128);
+        }
+    }
+}
+
+void cCompression::lireBloc(unsigned int x, unsigned int y, unsigned char bloc[8][8]) {
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            unsigned int px = x + j;
+            unsigned int py = y + i;
+
+            if (px < mLargeur && py < mHauteur && mBuffer) {
+                bloc[i][j] = mBuffer[py][px];
+            } else {
+                bloc[i][j] = 0;
+            }
+        }
+    }
+}
+
+void cCompression::ecrireBloc(unsigned int x, unsigned int y, unsigned char bloc[8][8]) {
+    if (!mBuffer) return;
+
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            unsigned int px = x + j;
+            unsigned int py = y + i;
+
+            if (px < mLargeur && py < mHauteur) {
+                mBuffer[py][px] = bloc[i][j];
+            }
+        }
+    }
+}
+
+bool cCompression::chargerImage(const char* nomFichier) {
+    JPEG_CHRONO(mInstrumentation, ETAPE_CHARGEMENT);
+
+    ifstream fichier(nomFichier, ios::binary);
+    if (!fichier) {
+        cerr << "Erreur: Impossible d'ouvrir le fichier " << nomFichier << endl;
+        return false;
+    }
+
+    // Pour l'exemple, on suppose une image 256x256
+    mLargeur = 256;
+    mHauteur = 256;
+    allocBuffer(mLargeur, mHauteur);
+
+    for (unsigned int i = 0; i < mHauteur; i++) {
+        fichier.read(reinterpret_cast<char*>(mBuffer[i]), mLargeur);
+    }
+    JPEG_INSTR(mInstrumentation.ajouterOctets(ETAPE_CHARGEMENT, mLargeur * mHauteur));
+
+    fichier.close();
+    return true;
+}
+
+bool cCompression::chargerImageTexte(const char* nomFichier, unsigned int largeur, unsigned int hauteur) {
+    JPEG_CHRONO(mInstrumentation, ETAPE_CHARGEMENT);
+
+    ifstream fichier(nomFichier);
+    if (!fichier) {
+        cerr << "Erreur: Impossible d'ouvrir " << nomFichier << endl;
+        return false;
+    }
+
+    // Allouer le buffer
+    allocBuffer(largeur, hauteur);
+
+    // Lecture des valeurs
+    for (unsigned int i = 0; i < hauteur; i++) {
+        for (unsigned int j = 0; j < largeur; j++) {
+            int valeur;
+            fichier >> valeur;
+
+            // Saturation
+            if (valeur < 0) valeur = 0;
+            if (valeur > 255) valeur = 255;
+
+            mBuffer[i][j] = static_cast<unsigned char>(valeur);
+        }
+    }
+
+    fichier.close();
+    JPEG_INSTR(mInstrumentation.ajouterOctets(ETAPE_CHARGEMENT, largeur * hauteur));
+
+    cout << "Image texte chargée: " << nomFichier << " ("
+         << largeur << "x" << hauteur << ")" << endl;
+
+    return true;
+}
+
+bool cCompression::compresser(const char* nomFichierSortie) {
+    if (!mBuffer) {
+        cerr << "Erreur: Aucune image chargée" << endl;
+        return false;
+    }
+
+    // 1. Préparer la trame RLE
+    int tailleMaxTrame = (mLargeur / 8) * (mHauteur / 8) * 129;  // au plus 129 symboles par bloc
+    int* trame = new int[tailleMaxTrame];
+    JPEG_INSTR(mInstrumentation.compterAllocation());
+
+    // 2. Calculer la trame RLE
+    int longueurTrame = RLE(trame);
+
+    // 3. Sauvegarder
+    bool ok = ecrireFichierCompresse(nomFichierSortie, mLargeur, mHauteur, mQualite, trame, longueurTrame);
+    delete[] trame;
+    if (!ok) {
+        return false;
+    }
+
+    cout << "Compression terminée: " << nomFichierSortie << endl;
+    cout << "Taille trame: " << longueurTrame << " entiers" << endl;
+
+    return true;
+}
+
+bool cCompression::ecrireFichierCompresse(const char* nomFichier, unsigned int largeur, unsigned int hauteur,
+                                          unsigned int qualite, const int* trame, int longueurTrame) {
+    JPEG_CHRONO(mInstrumentation, ETAPE_ECRITURE);
+
+    ofstream fichier(nomFichier, ios::binary);
+    if (!fichier) {
+        return false;
+    }
+
+    // Écrire l'en-tête simplifié
+    fichier.write(reinterpret_cast<const char*>(&largeur), sizeof(largeur));
+    fichier.write(reinterpret_cast<const char*>(&hauteur), sizeof(hauteur));
+    fichier.write(reinterpret_cast<const char*>(&qualite), sizeof(qualite));
+    fichier.write(reinterpret_cast<const char*>(&longueurTrame), sizeof(longueurTrame));
+
+    // Écrire la trame
+    fichier.write(reinterpret_cast<const char*>(trame), longueurTrame * sizeof(int));
+
+    fichier.close();
+    JPEG_INSTR(mInstrumentation.ajouterOctets(ETAPE_ECRITURE, 4 * sizeof(int) + longueurTrame * sizeof(int)));
+
+    return true;
+}
+
+// ========== COMPRESSION MULTI-QUALITÉ ==========
+
+void cCompression::calculerCoefficientsDCT() {
+    mCoefficientsDCT.clear();
+    if (!mBuffer || mLargeur == 0 || mHauteur == 0) {
+        return;
+    }
+
+    int totalBlocsX = mLargeur / 8;
+    int totalBlocsY = mHauteur / 8;
+    mCoefficientsDCT.resize(static_cast<size_t>(totalBlocsX) * totalBlocsY * 64);
+
+    unsigned char blocData[8][8];
+    char blocChar[8][8];
+    char* charPtrs[8];
+    double* doublePtrs[8];
+
+    for (int i = 0; i < 8; i++) {
+        charPtrs[i] = blocChar[i];
+    }
+
+    for (int by = 0; by < totalBlocsY; by++) {
+        for (int bx = 0; bx < totalBlocsX; bx++) {
+            double* coefficients = &mCoefficientsDCT[(static_cast<size_t>(by) * totalBlocsX + bx) * 64];
+
+            {
+                JPEG_CHRONO(mInstrumentation, ETAPE_DECALAGE);
+                lireBloc(bx * 8, by * 8, blocData);
+
+                for (int i = 0; i < 8; i++) {
+                    for (int j = 0; j < 8; j++) {
+                        blocChar[i][j] = static_cast<char>(blocData[i][j] - 128);
+                    }
+                }
+            }
+
+            // La DCT écrit directement dans le plan de coefficients
+            for (int i = 0; i < 8; i++) {
+                doublePtrs[i] = coefficients + i * 8;
+            }
+
+            // Bloc constant : DC exact, AC nuls
+            double DC;
+            if (estBlocUniforme(charPtrs, 1, DC)) {
+                fill(coefficients, coefficients + 64, 0.0);
+                coefficients[0] = DC;
+                continue;
+            }
+
+            {
+                JPEG_CHRONO(mInstrumentation, ETAPE_DCT);
+                Calcul_DCT_Block(charPtrs, doublePtrs);
+            }
+        }
+    }
+    JPEG_INSTR(mInstrumentation.compterAllocation());
+}
+
+const std::vector<double>& cCompression::getCoefficientsDCT() const { return mCoefficientsDCT; }
+
+int cCompression::RLE_Coefficients(const double* coefficients, unsigned int qualite, int* Trame) {
+    if (!coefficients || mLargeur == 0 || mHauteur == 0) {
+        return 0;
+    }
+
+    int totalBlocs = (mLargeur / 8) * (mHauteur / 8);
+    int indexTotal = 0;
+    int DC_precedent = 0;
+
+    // Table calculée une seule fois pour tous les blocs
+    int table[8][8];
+    calculerTableQuantification(qualite, table);
+
+    int quant[64];
+    int trameBloc[130];
+
+    for (int b = 0; b < totalBlocs; b++) {
+        const double* bloc = coefficients + static_cast<size_t>(b) * 64;
+
+        // 1. Quantifier (même arrondi que quant_JPEG), en ordre zigzag
+        {
+            JPEG_CHRONO(mInstrumentation, ETAPE_QUANTIFICATION);
+            for (int k = 0; k < 64; k++) {
+                int p = ORDRE_NATUREL[k];
+                quant[k] = static_cast<int>(round(bloc[p] / table[p / 8][p % 8]));
+            }
+        }
+
+        // 2. RLE sur le bloc, copiée dans la trame totale
+        int longueurBloc;
+        {
+            JPEG_CHRONO(mInstrumentation, ETAPE_RLE);
+            longueurBloc = RLE_Zigzag(quant, DC_precedent, trameBloc);
+            memcpy(Trame + indexTotal, trameBloc, longueurBloc * sizeof(int));
+            indexTotal += longueurBloc;
+        }
+        DC_precedent = quant[0];
+
+        JPEG_INSTR(
+            mInstrumentation.ajouterOctets(ETAPE_QUANTIFICATION, sizeof(quant));
+            mInstrumentation.ajouterOctets(ETAPE_RLE, longueurBloc * sizeof(int));
+            mInstrumentation.enregistrerBloc(cInstrumentation::positionEOB(trameBloc, longueurBloc))
+        );
+    }
+
+    return indexTotal;
+}
+
+bool cCompression::compresserMultiQualite(const std::vector<unsigned int>& qualites,
+                                          const std::vector<std::string>& nomsFichiers) {
+    if (!mBuffer) {
+        cerr << "Erreur: Aucune image chargée" << endl;
+        return false;
+    }
+
+    if (qualites.size() != nomsFichiers.size()) {
+        cerr << "Erreur: Une sortie par qualité est attendue" << endl;
+        return false;
+    }
+
+    // 1. Une seule DCT pour toutes les qualités
+    if (mCoefficientsDCT.empty()) {
+        calculerCoefficientsDCT();
+    }
+
+    // 2. Une trame réutilisée pour chaque qualité
+    int tailleMaxTrame = (mLargeur / 8) * (mHauteur / 8) * 129;  // au plus 129 symboles par bloc
+    int* trame = new int[tailleMaxTrame];
+    JPEG_INSTR(mInstrumentation.compterAllocation());
+
+    bool ok = true;
+    for (size_t q = 0; q < qualites.size(); q++) {
+        if (qualites[q] > 100) {
+            cerr << "Erreur: Qualité invalide " << qualites[q] << endl;
+            ok = false;
+            continue;
+        }
+
+        int longueurTrame = RLE_Coefficients(mCoefficientsDCT.data(), qualites[q], trame);
+
+        if (!ecrireFichierCompresse(nomsFichiers[q].c_str(), mLargeur, mHauteur, qualites[q], trame, longueurTrame)) {
+            cerr << "Erreur: Impossible d'écrire " << nomsFichiers[q] << endl;
+            ok = false;
+            continue;
+        }
+
+        cout << "Compression terminée: " << nomsFichiers[q]
+             << " (qualité " << qualites[q] << "%, " << longueurTrame << " entiers)" << endl;
+    }
+
+    delete[] trame;
+    return ok;
+}
+
+// ========== RÉGULATION DE DÉBIT ==========
+
+int cCompression::compresserCoefficients(const char* nomFichier, unsigned int qualite) {
+    int tailleMaxTrame = (mLargeur / 8) * (mHauteur / 8) * 129;  // au plus 129 symboles par bloc
+    int* trame = new int[tailleMaxTrame];
+    JPEG_INSTR(mInstrumentation.compterAllocation());
+
+    int longueurTrame = RLE_Coefficients(mCoefficientsDCT.data(), qualite, trame);
+    bool ok = ecrireFichierCompresse(nomFichier, mLargeur, mHauteur, qualite, trame, longueurTrame);
+    delete[] trame;
+
+    return ok ? longueurTrame : -1;
+}
+
+unsigned int cCompression::estimerTaille(unsigned int qualite) {
+    if (mCoefficientsDCT.empty()) {
+        calculerCoefficientsDCT();
+    }
+
+    int table[8][8];
+    calculerTableQuantification(qualite, table);
+
+    // Chaque bloc produit : DC + une paire par AC non nul + une paire de fin
+    size_t totalBlocs = mCoefficientsDCT.size() / 64;
+    unsigned long long symboles = 0;
+
+    for (size_t b = 0; b < totalBlocs; b++) {
+        const double* bloc = &mCoefficientsDCT[b * 64];
+        int nonNuls = 0;
+
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                if ((i || j) && round(bloc[i * 8 + j] / table[i][j]) != 0.0) {
+                    nonNuls++;
+                }
+            }
+        }
+        symboles += 3 + 2 * nonNuls;
+    }
+
+    return static_cast<unsigned int>(4 * sizeof(int) + symboles * sizeof(int));
+}
+
+double cCompression::estimerPSNR(unsigned int qualite) {
+    if (mCoefficientsDCT.empty()) {
+        calculerCoefficientsDCT();
+    }
+    if (mCoefficientsDCT.empty()) {
+        return 0.0;
+    }
+
+    int table[8][8];
+    calculerTableQuantification(qualite, table);
+
+    double erreurTotale = 0.0;
+    size_t totalBlocs = mCoefficientsDCT.size() / 64;
+
+    for (size_t b = 0; b < totalBlocs; b++) {
+        const double* bloc = &mCoefficientsDCT[b * 64];
+
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                double c = bloc[i * 8 + j];
+                double diff = c - round(c / table[i][j]) * table[i][j];
+                erreurTotale += diff * diff;
+            }
+        }
+    }
+
+    double eqm = erreurTotale / mCoefficientsDCT.size();
+    return (eqm > 0) ? 10 * log10(255.0 * 255.0 / eqm) : 99.99;
+}
+
+bool cCompression::compresserTailleCible(const char* nomFichierSortie, unsigned int tailleCible,
+                                         unsigned int* qualiteChoisie) {
+    if (!mBuffer) {
+        cerr << "Erreur: Aucune image chargée" << endl;
+        return false;
+    }
+
+    if (mCoefficientsDCT.empty()) {
+        calculerCoefficientsDCT();
+    }
+
+    // La taille croît avec la qualité : plus haute qualité dans le budget
+    unsigned int bas = 1;
+    unsigned int haut = 100;
+    unsigned int meilleure = 0;
+
+    while (bas <= haut) {
+        unsigned int milieu = (bas + haut) / 2;
+        if (estimerTaille(milieu) <= tailleCible) {
+            meilleure = milieu;
+            bas = milieu + 1;
+        } else {
+            haut = milieu - 1;
+        }
+    }
+
+    bool cibleAtteinte = (meilleure != 0);
+    setQualite(cibleAtteinte ? meilleure : 1);
+
+    if (qualiteChoisie) {
+        *qualiteChoisie = mQualite;
+    }
+
+    int longueurTrame = compresserCoefficients(nomFichierSortie, mQualite);
+    if (longueurTrame < 0) {
+        return false;
+    }
+
+    cout << "Compression taille cible " << tailleCible << " octets: qualité "
+         << mQualite << "%, " << (4 + longueurTrame) * sizeof(int) << " octets" << endl;
+
+    return cibleAtteinte;
+}
+
+bool cCompression::compresserPSNRCible(const char* nomFichierSortie, double psnrCible,
+                                       unsigned int* qualiteChoisie) {
+    if (!mBuffer) {
+        cerr << "Erreur: Aucune image chargée" << endl;
+        return false;
+    }
+
+    if (mCoefficientsDCT.empty()) {
+        calculerCoefficientsDCT();
+    }
+
+    // Le PSNR croît avec la qualité : plus basse qualité atteignant la cible
+    unsigned int bas = 1;
+    unsigned int haut = 100;
+    unsigned int meilleure = 0;
+
+    while (bas <= haut) {
+        unsigned int milieu = (bas + haut) / 2;
+        if (estimerPSNR(milieu) >= psnrCible) {
+            meilleure = milieu;
+            haut = milieu - 1;
+        } else {
+            bas = milieu + 1;
+        }
+    }
+
+    bool cibleAtteinte = (meilleure != 0);
+    setQualite(cibleAtteinte ? meilleure : 100);
+
+    if (qualiteChoisie) {
+        *qualiteChoisie = mQualite;
+    }
+
+    int longueurTrame = compresserCoefficients(nomFichierSortie, mQualite);
+    if (longueurTrame < 0) {
+        return false;
+    }
+
+    cout << "Compression PSNR cible " << psnrCible << " dB: qualité "
+         << mQualite << "%, PSNR estimé " << estimerPSNR(mQualite) << " dB" << endl;
+
+    return cibleAtteinte;
+}
+
+// ========== MODES PROGRESSIF ET TUILES ==========
+
+void cCompression::quantifierCoefficientsZigzag(unsigned int qualite, vector<int>& coefficients) {
+    if (mCoefficientsDCT.empty()) {
+        calculerCoefficientsDCT();
+    }
+
+    int totalBlocs = static_cast<int>(mCoefficientsDCT.size() / 64);
+    coefficients.resize(mCoefficientsDCT.size());
+
+    int table[8][8];
+    calculerTableQuantification(qualite, table);
+
+    JPEG_CHRONO(mInstrumentation, ETAPE_QUANTIFICATION);
+    for (int b = 0; b < totalBlocs; b++) {
+        const double* bloc = &mCoefficientsDCT[static_cast<size_t>(b) * 64];
+        for (int k = 0; k < 64; k++) {
+            int u = ZIGZAG[k][0];
+            int v = ZIGZAG[k][1];
+            coefficients[b * 64 + k] = static_cast<int>(round(bloc[u * 8 + v] / table[u][v]));
+        }
+    }
+}
+
+int cCompression::coderBandeProgressive(const int* coefficientsZigzag, int totalBlocs, int debut, int fin, int* Trame) {
+    int index = 0;
+
+    // Passe DC : chaîne des différences
+    if (debut == 0) {
+        int DC_precedent = 0;
+        for (int b = 0; b < totalBlocs; b++) {
+            Trame[index++] = coefficientsZigzag[b * 64] - DC_precedent;
+            DC_precedent = coefficientsZigzag[b * 64];
+        }
+        return index;
+    }
+
+    // Passe AC : la fin d'un bloc est regroupée avec les blocs vides qui le suivent
+    int blocsTermines = 0;
+    for (int b = 0; b < totalBlocs; b++) {
+        const int* bloc = coefficientsZigzag + b * 64;
+
+        int dernier = fin;
+        while (dernier >= debut && bloc[dernier] == 0) {
+            dernier--;
+        }
+
+        if (dernier < debut) {
+            blocsTermines++;
+            continue;
+        }
+
+        if (blocsTermines > 0) {
+            Trame[index++] = blocsTermines;
+            Trame[index++] = 0;
+        }
+
+        int runlength = 0;
+        for (int k = debut; k <= dernier; k++) {
+            if (bloc[k] == 0) {
+                runlength++;
+            } else {
+                Trame[index++] = runlength;
+                Trame[index++] = bloc[k];
+                runlength = 0;
+            }
+        }
+        blocsTermines = 1;
+    }
+
+    if (blocsTermines > 0) {
+        Trame[index++] = blocsTermines;
+        Trame[index++] = 0;
+    }
+
+    return index;
+}
+
+bool cCompression::compresserProgressif(const char* nomFichierSortie) {
+    if (!mBuffer) {
+        cerr << "Erreur: Aucune image chargée" << endl;
+        return false;
+    }
+
+    // 1. Quantifier tous les blocs avant de les répartir en passes. Codeur
+    //    ponctuel comme compresser() : la DCT est recalculée, les pixels ont pu
+    //    être modifiés par getBuffer() depuis le dernier calcul
+    vector<int> coefficients;
+    calculerCoefficientsDCT();
+    quantifierCoefficientsZigzag(mQualite, coefficients);
+    int totalBlocs = static_cast<int>(coefficients.size() / 64);
+
+    // 2. Écrire l'en-tête puis chaque passe
+    ofstream fichier(nomFichierSortie, ios::binary);
+    if (!fichier) {
+        cerr << "Erreur: Impossible de créer " << nomFichierSortie << endl;
+        return false;
+    }
+
+    unsigned int entete[5] = {SIGNATURE_PROGRESSIF, mLargeur, mHauteur, mQualite,
+                              static_cast<unsigned int>(NB_PASSES_PROGRESSIF)};
+    fichier.write(reinterpret_cast<const char*>(entete), sizeof(entete));
+
+    vector<int> trame(static_cast<size_t>(totalBlocs) * 129);
+    unsigned long long octets = sizeof(entete);
+
+    for (int p = 0; p < NB_PASSES_PROGRESSIF; p++) {
+        int longueur;
+        {
+            JPEG_CHRONO(mInstrumentation, ETAPE_RLE);
+            longueur = coderBandeProgressive(coefficients.data(), totalBlocs, BANDES_PROGRESSIF[p][0],
+                                             BANDES_PROGRESSIF[p][1], trame.data());
+        }
+
+        JPEG_CHRONO(mInstrumentation, ETAPE_ECRITURE);
+        unsigned int descripteur[3] = {static_cast<unsigned int>(BANDES_PROGRESSIF[p][0]),
+                                       static_cast<unsigned int>(BANDES_PROGRESSIF[p][1]),
+                                       static_cast<unsigned int>(longueur)};
+        fichier.write(reinterpret_cast<const char*>(descripteur), sizeof(descripteur));
+        fichier.write(reinterpret_cast<const char*>(trame.data()), longueur * sizeof(int));
+        octets += sizeof(descripteur) + longueur * sizeof(int);
+    }
+
+    JPEG_INSTR(mInstrumentation.ajouterOctets(ETAPE_ECRITURE, octets));
+
+    if (!fichier) {
+        cerr << "Erreur: Écriture incomplète de " << nomFichierSortie << endl;
+        return false;
+    }
+
+    cout << "Compression progressive terminée: " << nomFichierSortie << " (" << NB_PASSES_PROGRESSIF
+         << " passes, " << octets << " octets)" << endl;
+    return true;
+}
+
+bool cCompression::compresserTuiles(const char* nomFichierSortie, unsigned int tailleTuile) {
+    if (!mBuffer) {
+        cerr << "Erreur: Aucune image chargée" << endl;
+        return false;
+    }
+
+    if (tailleTuile == 0 || tailleTuile % 8 != 0) {
+        cerr << "Erreur: Taille de tuile " << tailleTuile << " non multiple de 8" << endl;
+        return false;
+    }
+
+    // 1. Quantifier tous les blocs (DCT recalculée, comme compresserProgressif)
+    vector<int> coefficients;
+    calculerCoefficientsDCT();
+    quantifierCoefficientsZigzag(mQualite, coefficients);
+
+    unsigned int nbBlocsX = mLargeur / 8;
+    unsigned int nbBlocsY = mHauteur / 8;
+    unsigned int blocsParTuile = tailleTuile / 8;
+    unsigned int nbTuilesX = (nbBlocsX + blocsParTuile - 1) / blocsParTuile;
+    unsigned int nbTuilesY = (nbBlocsY + blocsParTuile - 1) / blocsParTuile;
+
+    // 2. Coder chaque tuile avec sa propre chaîne DC et noter sa position
+    vector<int> trame(static_cast<size_t>(nbBlocsX) * nbBlocsY * 129);
+    vector<unsigned long long> index;
+    index.reserve(nbTuilesX * nbTuilesY + 1);
+    size_t longueurTrame = 0;
+
+    for (unsigned int ty = 0; ty < nbTuilesY; ty++) {
+        for (unsigned int tx = 0; tx < nbTuilesX; tx++) {
+            index.push_back(longueurTrame);
+
+            unsigned int bx1 = min((tx + 1) * blocsParTuile, nbBlocsX);
+            unsigned int by1 = min((ty + 1) * blocsParTuile, nbBlocsY);
+            int DC_precedent = 0;
+
+            JPEG_CHRONO(mInstrumentation, ETAPE_RLE);
+            for (unsigned int by = ty * blocsParTuile; by < by1; by++) {
+                for (unsigned int bx = tx * blocsParTuile; bx < bx1; bx++) {
+                    const int* bloc = &coefficients[(static_cast<size_t>(by) * nbBlocsX + bx) * 64];
+                    longueurTrame += RLE_Zigzag(bloc, DC_precedent, &trame[longueurTrame]);
+                    DC_precedent = bloc[0];
+                }
+            }
+        }
+    }
+    index.push_back(longueurTrame);
+
+    // 3. Écrire l'en-tête, la table d'index puis la trame
+    JPEG_CHRONO(mInstrumentation, ETAPE_ECRITURE);
+
+    ofstream fichier(nomFichierSortie, ios::binary);
+    if (!fichier) {
+        cerr << "Erreur: Impossible de créer " << nomFichierSortie << endl;
+        return false;
+    }
+
+    unsigned int entete[7] = {SIGNATURE_TUILES, mLargeur, mHauteur, mQualite, tailleTuile, nbTuilesX, nbTuilesY};
+    fichier.write(reinterpret_cast<const char*>(entete), sizeof(entete));
+    fichier.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(unsigned long long));
+    fichier.write(reinterpret_cast<const char*>(trame.data()), longueurTrame * sizeof(int));
+
+    unsigned long long octets = sizeof(entete) + index.size() * sizeof(unsigned long long)
+                                + longueurTrame * sizeof(int);
+    JPEG_INSTR(mInstrumentation.ajouterOctets(ETAPE_ECRITURE, octets));
+
+    if (!fichier) {
+        cerr << "Erreur: Écriture incomplète de " << nomFichierSortie << endl;
+        return false;
+    }
+
+    cout << "Compression en tuiles terminée: " << nomFichierSortie << " (" << nbTuilesX << "x" << nbTuilesY
+         << " tuiles de " << tailleTuile << " pixels, " << octets << " octets)" << endl;
+    return true;
+}
+
+bool cCompression::sauvegarderImage(const char* nomFichier) {
+    if (!mBuffer) {
+        return false;
+    }
+
+    ofstream fichier(nomFichier, ios::binary);
+    if (!fichier) {
+        return false;
+    }
+
+    for (unsigned int i = 0; i < mHauteur; i++) {
+        fichier.write(reinterpret_cast<const char*>(mBuffer[i]), mLargeur);
+    }
+
+    fichier.close();
+    return true;
+}
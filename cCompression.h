@@ -1,198 +1,566 @@
-/**
- * @file cCompression.h
- * @brief Dclaration de la classe cCompression pour la compression JPEG
- * @author EL KILI Rim
- * @date 2025
- * @version 1.0
- */
-
-#ifndef CCOMPRESSION_H
-#define CCOMPRESSION_H
-
-#include <vector>
-
-/**
- * @class cCompression
- * @brief Classe principale pour la compression JPEG d'images en niveaux de gris
- *
- * Cette classe implmente les tapes principales de la compression JPEG :
- * - Transformation DCT
- * - Quantification
- * - Encodage RLE
- * - Calcul des mtriques de compression
- */
-class cCompression {
-private:
-    unsigned int mLargeur;        ///< Largeur de l'image en pixels
-    unsigned int mHauteur;        ///< Hauteur de l'image en pixels
-    unsigned char** mBuffer;      ///< Buffer contenant les donnes de l'image
-    unsigned int mQualite;        ///< Qualit de compression (0-100)
-
-    /**
-     * @brief Table de quantification JPEG standard pour la luminance
-     */
-    static const int TABLE_QUANT[8][8];
-
-public:
-    /**
-     * @brief Constructeur par dfaut
-     */
-    cCompression();
-
-    /**
-     * @brief Constructeur avec paramtres
-     * @param largeur Largeur de l'image
-     * @param hauteur Hauteur de l'image
-     * @param qualite Qualit de compression (0-100, dfaut=50)
-     */
-    cCompression(unsigned int largeur, unsigned int hauteur, unsigned int qualite = 50);
-
-    /**
-     * @brief Destructeur
-     */
-    ~cCompression();
-
-    // Accesseurs et mutateurs
-    unsigned int getLargeur() const;
-    unsigned int getHauteur() const;
-    unsigned int getQualite() const;
-    unsigned char** getBuffer() const;  // NOUVEAU: Accs au buffer
-
-    void setLargeur(unsigned int largeur);
-    void setHauteur(unsigned int hauteur);
-    void setQualite(unsigned int qualite);
-    void setBuffer(unsigned char** buffer);
-
-    /**
-     * @brief Alloue le buffer pour l'image
-     * @param largeur Largeur de l'image
-     * @param hauteur Hauteur de l'image
-     */
-    void allocBuffer(unsigned int largeur, unsigned int hauteur);  // NOUVEAU
-
-    /**
-     * @brief Calcule la DCT d'un bloc 8x8
-     * @param Block8 Bloc d'entre 8x8 (valeurs entre -128 et 127)
-     * @param DCT_Img Matrice de sortie pour les coefficients DCT
-     */
-    void Calcul_DCT_Block(char** Block8, double** DCT_Img);
-
-    /**
-     * @brief Calcule la DCT inverse d'un bloc 8x8
-     * @param DCT_Img Coefficients DCT d'entre
-     * @param Block8 Bloc de sortie 8x8
-     */
-    void Calcul_IDCT(double** DCT_Img, char** Block8);
-
-    /**
-     * @brief Quantifie une matrice DCT selon la norme JPEG
-     * @param img_DCT Matrice DCT d'entre
-     * @param Img_Quant Matrice quantifie de sortie
-     */
-    void quant_JPEG(double** img_DCT, int** Img_Quant);
-
-    /**
-     * @brief Dquantifie une matrice selon la norme JPEG
-     * @param Img_Quant Matrice quantifie d'entre
-     * @param img_DCT Matrice dquantifie de sortie
-     */
-    void dequant_JPEG(int** Img_Quant, double** img_DCT);
-
-    /**
-     * @brief Calcule l'cart quadratique moyen (EQM) d'un bloc
-     * @param Bloc8x8 Bloc quantifi
-     * @return L'EQM entre le bloc original et reconstruit
-     */
-    double EQM(int** Bloc8x8);
-
-    /**
-     * @brief Calcule le taux de compression d'un bloc
-     * @param Bloc8x8 Bloc quantifi
-     * @return Taux de compression en pourcentage
-     */
-    double Taux_Compression(int** Bloc8x8);
-
-    /**
-     * @brief Encode un bloc quantifi avec RLE
-     * @param Img_Quant Bloc quantifi d'entre
-     * @param DC_precedent Valeur DC du bloc prcdent
-     * @param Trame Tableau de sortie pour la trame RLE
-     * @return Longueur de la trame gnre
-     */
-    int RLE_Block(int** Img_Quant, int DC_precedent, char* Trame);
-
-    /**
-     * @brief Encode toute l'image avec RLE
-     * @param Trame Tableau de sortie pour la trame complte
-     * @return Longueur totale de la trame
-     */
-    int RLE(int* Trame);
-
-    /**
-     * @brief Charge une image depuis un fichier
-     * @param nomFichier Chemin du fichier image
-     * @return true si chargement russi, false sinon
-     */
-    bool chargerImage(const char* nomFichier);
-
-    /**
-     * @brief Charge une image depuis un fichier texte (comme lenna.img.txt)
-     * @param nomFichier Chemin du fichier texte
-     * @param largeur Largeur de l'image
-     * @param hauteur Hauteur de l'image
-     * @return true si chargement russi
-     */
-    bool chargerImageTexte(const char* nomFichier, unsigned int largeur = 256, unsigned int hauteur = 256);  // NOUVEAU
-
-    /**
-     * @brief Sauvegarde l'image compresse
-     * @param nomFichier Chemin du fichier de sortie
-     * @return true si sauvegarde russie, false sinon
-     */
-    bool sauvegarderImage(const char* nomFichier);
-
-    /**
-     * @brief Compresse l'image complte
-     * @param nomFichierSortie Chemin du fichier compress
-     * @return true si compression russie
-     */
-    bool compresser(const char* nomFichierSortie);
-
-private:
-    /**
-     * @brief Calcule la table de quantification en fonction de la qualit
-     * @param qualite Qualit souhaite (0-100)
-     * @param table Table de sortie 8x8
-     */
-    void calculerTableQuantification(int qualite, int table[8][8]);
-
-    /**
-     * @brief Effectue le dcalage de niveau (0-255 vers -128-127)
-     * @param bloc Bloc  traiter
-     */
-    void decalageNiveau(char** bloc);
-
-    /**
-     * @brief Effectue l'opration inverse du dcalage de niveau
-     * @param bloc Bloc  traiter
-     */
-    void decalageNiveauInverse(char** bloc);
-
-    /**
-     * @brief Lit un bloc 8x8 depuis l'image
-     * @param x Position X du bloc
-     * @param y Position Y du bloc
-     * @param bloc Bloc de sortie
-     */
-    void lireBloc(unsigned int x, unsigned int y, unsigned char bloc[8][8]);
-
-    /**
-     * @brief crit un bloc 8x8 dans l'image
-     * @param x Position X du bloc
-     * @param y Position Y du bloc
-     * @param bloc Bloc d'entre
-     */
-    void ecrireBloc(unsigned int x, unsigned int y, unsigned char bloc[8][8]);
-};
-
-#endif // CCOMPRESSION_H
+/**
+ * @file cCompression.h
+ * @brief Déclaration de la classe cCompression pour la compression JPEG
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef CCOMPRESSION_H
+#define CCOMPRESSION_H
+
+#include <vector>
+#include <string>
+#include "cInstrumentation.h"
+
+/**
+ * @class cCompression
+ * @brief Classe principale pour la compression JPEG d'images en niveaux de gris
+ *
+ * Cette classe implémente les étapes principales de la compression JPEG :
+ * - Transformation DCT
+ * - Quantification
+ * - Encodage RLE
+ * - Calcul des métriques de compression
+ */
+class cCompression {
+private:
+    unsigned int mLargeur;        ///< Largeur de l'image en pixels
+    unsigned int mHauteur;        ///< Hauteur de l'image en pixels
+    unsigned char** mBuffer;      ///< Buffer contenant les données de l'image
+    unsigned int mQualite;        ///< Qualité de compression (0-100)
+#ifdef JPEG_INSTRUMENTATION
+    cInstrumentation mInstrumentation;  ///< Compteurs par étape (absent si l'instrumentation n'est pas compilée)
+#endif
+    std::vector<double> mCoefficientsDCT;  ///< Plan des coefficients DCT (64 par bloc, vide si non calculé)
+    bool mPrecisionSimple;        ///< Transformées et (dé)quantification en float (voir setPrecisionSimple)
+
+    /**
+     * @brief Table de quantification JPEG standard pour la luminance
+     */
+    static constexpr int TABLE_QUANT[8][8] = {
+        {16, 11, 10, 16, 24, 40, 51, 61},
+        {12, 12, 14, 19, 26, 58, 60, 55},
+        {14, 13, 16, 24, 40, 57, 69, 56},
+        {14, 17, 22, 29, 51, 87, 80, 62},
+        {18, 22, 37, 56, 68, 109, 103, 77},
+        {24, 35, 55, 64, 81, 104, 113, 92},
+        {49, 64, 78, 87, 103, 121, 120, 101},
+        {72, 92, 95, 98, 112, 100, 103, 99}
+    };
+
+    /**
+     * @brief Table de quantification JPEG standard pour la chrominance
+     */
+    static constexpr int TABLE_QUANT_CHROMINANCE[8][8] = {
+        {17, 18, 24, 47, 99, 99, 99, 99},
+        {18, 21, 26, 66, 99, 99, 99, 99},
+        {24, 26, 56, 99, 99, 99, 99, 99},
+        {47, 66, 99, 99, 99, 99, 99, 99},
+        {99, 99, 99, 99, 99, 99, 99, 99},
+        {99, 99, 99, 99, 99, 99, 99, 99},
+        {99, 99, 99, 99, 99, 99, 99, 99},
+        {99, 99, 99, 99, 99, 99, 99, 99}
+    };
+
+public:
+    /**
+     * @brief Indicateur ajouté à la qualité : table de quantification transposée
+     *
+     * Positionné par les rotations et transpositions sans perte (voir
+     * cDecompression::transformer) pour que chaque coefficient transposé
+     * reste associé à son pas de quantification d'origine.
+     */
+    static const unsigned int QUALITE_TABLE_TRANSPOSEE = 0x100;
+
+    /**
+     * @brief Signature placée en tête des fichiers progressifs ("JPRG")
+     */
+    static const unsigned int SIGNATURE_PROGRESSIF = 0x4752504A;
+
+    /**
+     * @brief Nombre de passes d'un fichier progressif
+     */
+    static const int NB_PASSES_PROGRESSIF = 4;
+
+    /**
+     * @brief Bandes de coefficients (indices zigzag de début et de fin) de chaque passe
+     */
+    static const int BANDES_PROGRESSIF[NB_PASSES_PROGRESSIF][2];
+
+    /**
+     * @brief Signature placée en tête des fichiers en tuiles ("JTIL")
+     */
+    static const unsigned int SIGNATURE_TUILES = 0x4C49544A;
+
+    /**
+     * @brief Constructeur par défaut
+     */
+    cCompression();
+
+    /**
+     * @brief Constructeur avec paramètres
+     * @param largeur Largeur de l'image
+     * @param hauteur Hauteur de l'image
+     * @param qualite Qualité de compression (0-100, défaut=50)
+     */
+    cCompression(unsigned int largeur, unsigned int hauteur, unsigned int qualite = 50);
+
+    /**
+     * @brief Destructeur
+     */
+    ~cCompression();
+
+    // Accesseurs et mutateurs
+    unsigned int getLargeur() const;
+    unsigned int getHauteur() const;
+    unsigned int getQualite() const;
+    unsigned char** getBuffer() const;  // NOUVEAU: Accès au buffer
+
+    void setLargeur(unsigned int largeur);
+    void setHauteur(unsigned int hauteur);
+    void setQualite(unsigned int qualite);
+    void setBuffer(unsigned char** buffer);
+
+    /**
+     * @brief Choisit la précision des transformées et de la (dé)quantification
+     *
+     * En simple précision, la DCT, l'IDCT, la quantification et la
+     * déquantification travaillent en float avec une DCT séparable (tables de
+     * cosinus précalculées) : deux fois plus de valeurs par registre vectoriel.
+     * Concerne le codeur et le décodeur en niveaux de gris ; les blocs
+     * uniformes et le décodage à échelle réduite restent en double.
+     * @param active true pour le mode float (défaut : double)
+     */
+    void setPrecisionSimple(bool active) { mPrecisionSimple = active; }
+    bool getPrecisionSimple() const { return mPrecisionSimple; }
+
+#ifdef JPEG_INSTRUMENTATION
+    /**
+     * @brief Accès aux compteurs d'instrumentation du codeur/décodeur
+     *
+     * N'existe que si le programme est compilé avec -DJPEG_INSTRUMENTATION :
+     * sans cette option, les instances ne portent aucun compteur.
+     * @return Compteurs cumulés depuis la dernière réinitialisation
+     */
+    cInstrumentation& getInstrumentation();
+    const cInstrumentation& getInstrumentation() const;
+#endif
+
+    /**
+     * @brief Alloue le buffer pour l'image
+     * @param largeur Largeur de l'image
+     * @param hauteur Hauteur de l'image
+     */
+    void allocBuffer(unsigned int largeur, unsigned int hauteur);  // NOUVEAU
+
+    /**
+     * @brief Libère le buffer de l'image (à faire avant de changer la hauteur sans réallouer)
+     */
+    void libererBuffer();
+
+    /**
+     * @brief Calcule la DCT d'un bloc 8x8
+     * @param Block8 Bloc d'entrée 8x8 (valeurs entre -128 et 127)
+     * @param DCT_Img Matrice de sortie pour les coefficients DCT
+     */
+    void Calcul_DCT_Block(char** Block8, double** DCT_Img);
+
+    /**
+     * @brief Calcule la DCT inverse d'un bloc 8x8
+     * @param DCT_Img Coefficients DCT d'entrée
+     * @param Block8 Bloc de sortie 8x8
+     */
+    void Calcul_IDCT(double** DCT_Img, char** Block8);
+
+    /**
+     * @brief Calcule une DCT inverse réduite (décodage à échelle réduite)
+     *
+     * Seuls les taille x taille coefficients de basse fréquence sont utilisés
+     * pour reconstruire un bloc taille x taille, qui approche la moyenne des
+     * pixels du bloc 8x8 complet. Pour taille = 1, le bloc vaut DC / 8.
+     * @param DCT_Img Coefficients DCT d'entrée (bloc 8x8)
+     * @param Block Bloc de sortie taille x taille
+     * @param taille Taille du bloc de sortie (1, 2, 4 ou 8)
+     */
+    void Calcul_IDCT_Reduite(double** DCT_Img, char** Block, int taille);
+
+    /**
+     * @brief DCT inverse d'un bloc sans coefficient AC : remplissage uniforme
+     *
+     * Donne le même bloc que Calcul_IDCT / Calcul_IDCT_Reduite lorsque seul
+     * le coefficient DC est non nul, sans aucun calcul de cosinus.
+     * @param DC Coefficient DC déquantifié
+     * @param Block Bloc de sortie taille x taille
+     * @param taille Taille du bloc de sortie (1, 2, 4 ou 8, défaut=8)
+     */
+    void Calcul_IDCT_DC(double DC, char** Block, int taille = 8);
+
+    /**
+     * @brief DCT d'un bloc 8x8 en simple précision
+     *
+     * DCT séparable (lignes puis colonnes) avec une matrice de cosinus
+     * précalculée ; les boucles internes portent sur 8 float contigus.
+     * @param Block8 Bloc d'entrée 8x8 (valeurs entre -128 et 127)
+     * @param DCT_Img Matrice de sortie pour les coefficients DCT
+     */
+    void Calcul_DCT_Block_Float(char** Block8, float** DCT_Img);
+
+    /**
+     * @brief Nombre de blocs traités ensemble par Calcul_DCT_Quant_Lot
+     *
+     * Un registre de float : 16 avec AVX-512, 8 sinon (AVX2 ; deux registres SSE).
+     */
+#if defined(__AVX512F__)
+    static const int TAILLE_LOT = 16;
+#else
+    static const int TAILLE_LOT = 8;
+#endif
+
+    /**
+     * @brief DCT et quantification simultanées de TAILLE_LOT blocs (simple précision)
+     *
+     * Les blocs sont rangés en structure de tableaux : lot[p][b] est le pixel
+     * p (ligne x 8 + colonne, déjà décalé de -128) du bloc b. Chaque étape de
+     * la DCT séparable s'applique ainsi aux TAILLE_LOT blocs d'un même vecteur.
+     * Les résultats sont identiques à Calcul_DCT_Block_Float puis
+     * quant_JPEG_Float sur chaque bloc.
+     * @param lot Pixels des blocs (64 x TAILLE_LOT)
+     * @param table Table de quantification
+     * @param coefficientsZigzag Coefficients quantifiés de chaque bloc, en ordre zigzag (sortie)
+     */
+    void Calcul_DCT_Quant_Lot(const float lot[64][TAILLE_LOT], const int table[8][8],
+                              int coefficientsZigzag[][64]);
+
+    /**
+     * @brief DCT inverse d'un bloc 8x8 en simple précision (voir Calcul_DCT_Block_Float)
+     * @param DCT_Img Coefficients DCT d'entrée
+     * @param Block8 Bloc de sortie 8x8
+     */
+    void Calcul_IDCT_Float(float** DCT_Img, char** Block8);
+
+    /**
+     * @brief Quantifie une matrice DCT selon la norme JPEG
+     * @param img_DCT Matrice DCT d'entrée
+     * @param Img_Quant Matrice quantifiée de sortie
+     */
+    void quant_JPEG(double** img_DCT, int** Img_Quant);
+
+    /**
+     * @brief Déquantifie une matrice selon la norme JPEG
+     * @param Img_Quant Matrice quantifiée d'entrée
+     * @param img_DCT Matrice déquantifiée de sortie
+     */
+    void dequant_JPEG(int** Img_Quant, double** img_DCT);
+
+    /**
+     * @brief Quantification et déquantification en simple précision
+     */
+    void quant_JPEG_Float(float** img_DCT, int** Img_Quant);
+    void dequant_JPEG_Float(int** Img_Quant, float** img_DCT);
+
+    /**
+     * @brief Calcule l'écart quadratique moyen (EQM) d'un bloc
+     * @param Bloc8x8 Bloc quantifié
+     * @return L'EQM entre le bloc original et reconstruit
+     */
+    double EQM(int** Bloc8x8);
+
+    /**
+     * @brief Calcule le taux de compression d'un bloc
+     * @param Bloc8x8 Bloc quantifié
+     * @return Taux de compression en pourcentage
+     */
+    double Taux_Compression(int** Bloc8x8);
+
+    /**
+     * @brief Encode un bloc quantifié avec RLE
+     *
+     * Un masque de 64 bits des coefficients non nuls (comparaisons SSE2) est
+     * parcouru bit à bit : les longueurs de plage se déduisent des positions
+     * successives, sans test par coefficient.
+     * @param Img_Quant Bloc quantifié d'entrée
+     * @param DC_precedent Valeur DC du bloc précédent
+     * @param Trame Tableau de sortie pour la trame RLE
+     * @return Longueur de la trame générée
+     */
+    int RLE_Block(int** Img_Quant, int DC_precedent, char* Trame);
+
+    /**
+     * @brief Encode avec RLE un bloc déjà ordonné en zigzag
+     *
+     * Produit les mêmes symboles que RLE_Block, sans réduction des valeurs
+     * sur 8 bits (la trame est en entiers).
+     * @param coefficientsZigzag 64 coefficients quantifiés en ordre zigzag
+     * @param DC_precedent Valeur DC du bloc précédent
+     * @param Trame Tableau de sortie (au plus 129 symboles)
+     * @return Longueur de la trame générée
+     */
+    int RLE_Zigzag(const int* coefficientsZigzag, int DC_precedent, int* Trame);
+
+    /**
+     * @brief Encode toute l'image avec RLE
+     *
+     * En simple précision, chaque ligne de blocs est transformée par lots de
+     * TAILLE_LOT blocs (voir Calcul_DCT_Quant_Lot).
+     * @param Trame Tableau de sortie pour la trame complète
+     * @return Longueur totale de la trame
+     */
+    int RLE(int* Trame);
+
+    /**
+     * @brief Charge une image depuis un fichier
+     * @param nomFichier Chemin du fichier image
+     * @return true si chargement réussi, false sinon
+     */
+    bool chargerImage(const char* nomFichier);
+
+    /**
+     * @brief Charge une image depuis un fichier texte (comme lenna.img.txt)
+     * @param nomFichier Chemin du fichier texte
+     * @param largeur Largeur de l'image
+     * @param hauteur Hauteur de l'image
+     * @return true si chargement réussi
+     */
+    bool chargerImageTexte(const char* nomFichier, unsigned int largeur = 256, unsigned int hauteur = 256);  // NOUVEAU
+
+    /**
+     * @brief Sauvegarde l'image compressée
+     * @param nomFichier Chemin du fichier de sortie
+     * @return true si sauvegarde réussie, false sinon
+     */
+    bool sauvegarderImage(const char* nomFichier);
+
+    /**
+     * @brief Compresse l'image complète
+     * @param nomFichierSortie Chemin du fichier compressé
+     * @return true si compression réussie
+     */
+    bool compresser(const char* nomFichierSortie);
+
+    /**
+     * @brief Calcule et conserve les coefficients DCT de toute l'image
+     *
+     * Les coefficients ne dépendent pas de la qualité : ils sont réutilisés
+     * par toutes les compressions multi-qualité tant que l'image n'est pas
+     * rechargée. Si les pixels sont modifiés directement via getBuffer(),
+     * cette fonction doit être rappelée.
+     */
+    void calculerCoefficientsDCT();
+
+    /**
+     * @brief Accès au plan des coefficients DCT
+     * @return Coefficients des blocs dans l'ordre de balayage (vide si non calculé)
+     */
+    const std::vector<double>& getCoefficientsDCT() const;
+
+    /**
+     * @brief Quantifie et encode en RLE un plan de coefficients DCT
+     * @param coefficients Plan de coefficients (64 par bloc, ordre ligne par ligne)
+     * @param qualite Qualité de quantification (0-100)
+     * @param Trame Tableau de sortie pour la trame complète
+     * @return Longueur totale de la trame
+     */
+    int RLE_Coefficients(const double* coefficients, unsigned int qualite, int* Trame);
+
+    /**
+     * @brief Compresse l'image en plusieurs qualités avec une seule passe DCT
+     * @param qualites Qualités à produire
+     * @param nomsFichiers Fichier de sortie pour chaque qualité
+     * @return true si toutes les compressions ont réussi
+     */
+    bool compresserMultiQualite(const std::vector<unsigned int>& qualites,
+                                const std::vector<std::string>& nomsFichiers);
+
+    /**
+     * @brief Estime la taille du fichier compressé pour une qualité donnée
+     *
+     * La taille est déduite du nombre de symboles RLE (DC, paires non nulles
+     * et fin de bloc) calculé sur le plan DCT en cache, sans produire de trame.
+     * @param qualite Qualité de quantification (0-100)
+     * @return Taille estimée en octets (en-tête compris)
+     */
+    unsigned int estimerTaille(unsigned int qualite);
+
+    /**
+     * @brief Estime le PSNR de la reconstruction pour une qualité donnée
+     *
+     * La DCT étant orthonormée, l'erreur quadratique sur les pixels est égale
+     * à l'erreur de quantification sur les coefficients (Parseval) : aucune
+     * IDCT n'est nécessaire. L'arrondi final des pixels est ignoré.
+     * @param qualite Qualité de quantification (0-100)
+     * @return PSNR estimé en dB
+     */
+    double estimerPSNR(unsigned int qualite);
+
+    /**
+     * @brief Compresse avec la plus haute qualité respectant une taille cible
+     *
+     * La qualité est recherchée par dichotomie sur le plan DCT en cache ;
+     * le fichier n'est écrit qu'une fois, avec la qualité retenue.
+     * @param nomFichierSortie Chemin du fichier compressé
+     * @param tailleCible Taille maximale du fichier en octets
+     * @param qualiteChoisie Qualité retenue (sortie, optionnelle)
+     * @return true si la cible est respectée (sinon le fichier est écrit à la qualité 1)
+     */
+    bool compresserTailleCible(const char* nomFichierSortie, unsigned int tailleCible,
+                               unsigned int* qualiteChoisie = nullptr);
+
+    /**
+     * @brief Compresse avec la plus basse qualité atteignant un PSNR cible
+     * @param nomFichierSortie Chemin du fichier compressé
+     * @param psnrCible PSNR minimal en dB
+     * @param qualiteChoisie Qualité retenue (sortie, optionnelle)
+     * @return true si la cible est atteinte (sinon le fichier est écrit à la qualité 100)
+     */
+    bool compresserPSNRCible(const char* nomFichierSortie, double psnrCible,
+                             unsigned int* qualiteChoisie = nullptr);
+
+    /**
+     * @brief Compresse l'image en mode progressif (sélection spectrale)
+     *
+     * Le fichier contient une passe par bande de BANDES_PROGRESSIF : d'abord
+     * les DC de tous les blocs, puis les bandes de coefficients AC. Un
+     * décodeur peut afficher l'image dès la fin de la première passe puis
+     * l'affiner à chaque passe reçue (voir cDecompression::Decompression_Progressive).
+     *
+     * Format : SIGNATURE_PROGRESSIF, largeur, hauteur, qualité, nombre de
+     * passes (uint32), puis pour chaque passe début, fin et longueur de trame
+     * (uint32) suivis de la trame (int32).
+     * @param nomFichierSortie Chemin du fichier compressé
+     * @return true si compression réussie
+     */
+    bool compresserProgressif(const char* nomFichierSortie);
+
+    /**
+     * @brief Compresse l'image en tuiles indépendantes avec une table d'index
+     *
+     * Chaque tuile est codée comme une petite image (blocs dans l'ordre de
+     * balayage de la tuile, chaîne DC propre à la tuile). La table d'index
+     * donne la position de chaque tuile dans la trame : une tuile peut être
+     * lue et décodée seule, et les tuiles peuvent être décodées en parallèle.
+     *
+     * Format : SIGNATURE_TUILES, largeur, hauteur, qualité, taille de tuile,
+     * nombre de tuiles en largeur et en hauteur (uint32), puis nbTuiles + 1
+     * positions (uint64, en entiers depuis le début de la trame), puis la
+     * trame (int32).
+     * @param nomFichierSortie Chemin du fichier compressé
+     * @param tailleTuile Côté des tuiles en pixels (multiple de 8, défaut=256)
+     * @return true si compression réussie
+     */
+    bool compresserTuiles(const char* nomFichierSortie, unsigned int tailleTuile = 256);
+
+protected:
+    /**
+     * @brief Ordre de parcours zigzag : position (ligne, colonne) du k-ième coefficient
+     */
+    static const int ZIGZAG[64][2];
+
+    /**
+     * @brief Indice en ordre naturel (ligne x 8 + colonne) du k-ième coefficient zigzag
+     */
+    static const int ORDRE_NATUREL[64];
+
+    /**
+     * @brief Calcule la table de quantification en fonction de la qualité
+     * @param qualite Qualité souhaitée (0-100), éventuellement combinée avec
+     *                QUALITE_TABLE_TRANSPOSEE
+     * @param table Table de sortie 8x8
+     * @param chrominance true pour partir de la table de chrominance
+     */
+    void calculerTableQuantification(int qualite, int table[8][8], bool chrominance = false);
+
+    /**
+     * @brief Plus petit pas de quantification des coefficients AC d'une table
+     */
+    static int pasMinimalAC(const int table[8][8]);
+
+    /**
+     * @brief Détecte un bloc dont tous les coefficients AC se quantifient à zéro
+     *
+     * Les coefficients AC ne dépendent que des écarts des pixels à leur
+     * moyenne, d'où |AC| <= 4 x (max - min). Si 8 x (max - min) est inférieur
+     * au plus petit pas AC, la DCT est inutile : seul le DC (somme / 8) est
+     * calculé, avec exactement la valeur que donnerait Calcul_DCT_Block.
+     * @param Block8 Bloc 8x8 décalé (valeurs entre -128 et 127)
+     * @param pasMinimal Plus petit pas de quantification AC (1 : blocs constants seulement)
+     * @param DC Coefficient DC du bloc (sortie, si le bloc est uniforme)
+     * @return true si tous les AC sont nuls après quantification
+     */
+    static bool estBlocUniforme(char** Block8, int pasMinimal, double& DC);
+
+    /**
+     * @brief Écrit l'en-tête et la trame RLE dans un fichier compressé
+     * @param nomFichier Chemin du fichier de sortie
+     * @param largeur Largeur inscrite dans l'en-tête
+     * @param hauteur Hauteur inscrite dans l'en-tête
+     * @param qualite Qualité inscrite dans l'en-tête
+     * @param trame Trame RLE
+     * @param longueurTrame Longueur de la trame
+     * @return true si l'écriture a réussi
+     */
+    bool ecrireFichierCompresse(const char* nomFichier, unsigned int largeur, unsigned int hauteur,
+                                unsigned int qualite, const int* trame, int longueurTrame);
+
+    /**
+     * @brief Encode une bande de coefficients de tous les blocs (passe progressive)
+     *
+     * Passe DC (debut = fin = 0) : une différence DC par bloc. Passe AC :
+     * paires (runlength, amplitude) relatives au début de la bande ; une
+     * paire (n, 0) termine le bloc courant et indique que les n - 1 blocs
+     * suivants n'ont aucun coefficient non nul dans la bande.
+     * @param coefficientsZigzag Coefficients quantifiés, 64 par bloc en ordre zigzag
+     * @param totalBlocs Nombre de blocs
+     * @param debut Indice zigzag du premier coefficient de la bande
+     * @param fin Indice zigzag du dernier coefficient de la bande
+     * @param Trame Tableau de sortie
+     * @return Longueur de la trame de la passe
+     */
+    int coderBandeProgressive(const int* coefficientsZigzag, int totalBlocs, int debut, int fin, int* Trame);
+
+    /**
+     * @brief Quantifie le plan DCT en cache (calculé si besoin)
+     * @param qualite Qualité de quantification
+     * @param coefficients Coefficients quantifiés, 64 par bloc en ordre zigzag (sortie)
+     */
+    void quantifierCoefficientsZigzag(unsigned int qualite, std::vector<int>& coefficients);
+
+private:
+    /**
+     * @brief Quantifie le plan DCT en cache et écrit le fichier compressé
+     * @param nomFichier Chemin du fichier de sortie
+     * @param qualite Qualité de quantification
+     * @return Longueur de la trame écrite, -1 en cas d'erreur
+     */
+    int compresserCoefficients(const char* nomFichier, unsigned int qualite);
+
+    /**
+     * @brief Effectue le décalage de niveau (0-255 vers -128-127)
+     * @param bloc Bloc à traiter
+     */
+    void decalageNiveau(char** bloc);
+
+    /**
+     * @brief Effectue l'opération inverse du décalage de niveau
+     * @param bloc Bloc à traiter
+     */
+    void decalageNiveauInverse(char** bloc);
+
+    /**
+     * @brief Lit un bloc 8x8 depuis l'image
+     * @param x Position X du bloc
+     * @param y Position Y du bloc
+     * @param bloc Bloc de sortie
+     */
+    void lireBloc(unsigned int x, unsigned int y, unsigned char bloc[8][8]);
+
+    /**
+     * @brief Écrit un bloc 8x8 dans l'image
+     * @param x Position X du bloc
+     * @param y Position Y du bloc
+     * @param bloc Bloc d'entrée
+     */
+    void ecrireBloc(unsigned int x, unsigned int y, unsigned char bloc[8][8]);
+};
+
+#endif // CCOMPRESSION_H
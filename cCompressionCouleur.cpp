@@ -0,0 +1,340 @@
+/**
+ * @file cCompressionCouleur.cpp
+ * @brief Implémentation de la classe cCompressionCouleur
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "cCompressionCouleur.h"
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define JPEG_COULEUR_SSE2
+#endif
+
+using namespace std;
+
+#ifdef JPEG_COULEUR_SSE2
+namespace {
+    // Y, Cb, Cr (32 bits, avant décalage) des 4 pixels RGB en tête des 16 octets lus.
+    // Chaque pixel est replacé dans un mot de 32 bits r g b g, puis _mm_madd_epi16
+    // somme les produits deux à deux : les coefficients 38470 et 32768 ne tenant
+    // pas sur 16 bits signés, ils sont répartis en 32767 + 5703 (g en double) et
+    // 32767 + 1 (la composante seule est ajoutée à part).
+    void convertirQuatrePixels(__m128i octets, __m128i& Y, __m128i& Cb, __m128i& Cr) {
+        const __m128i masqueOctet = _mm_set1_epi32(0xFF);
+        const __m128i masquePixel = _mm_set1_epi32(0x00FFFFFF);
+        const __m128i masqueVert = _mm_set1_epi32(0x0000FF00);
+        const __m128i zero = _mm_setzero_si128();
+
+        // Pixel k aux octets 3k..3k+2 : décalages de 0, 3, 6 et 9 octets
+        __m128i p01 = _mm_unpacklo_epi32(octets, _mm_srli_si128(octets, 3));
+        __m128i p23 = _mm_unpacklo_epi32(_mm_srli_si128(octets, 6), _mm_srli_si128(octets, 9));
+        __m128i pixels = _mm_and_si128(_mm_unpacklo_epi64(p01, p23), masquePixel);
+        pixels = _mm_or_si128(pixels, _mm_slli_epi32(_mm_and_si128(pixels, masqueVert), 16));
+
+        // Composantes sur 16 bits : r g b g pour les pixels 0-1 (bas) et 2-3 (haut)
+        __m128i bas = _mm_unpacklo_epi8(pixels, zero);
+        __m128i haut = _mm_unpackhi_epi8(pixels, zero);
+
+        // Somme des deux produits partiels de chaque pixel
+        auto combiner = [&](__m128i coefficients) {
+            __m128 sommesBas = _mm_castsi128_ps(_mm_madd_epi16(bas, coefficients));
+            __m128 sommesHaut = _mm_castsi128_ps(_mm_madd_epi16(haut, coefficients));
+            return _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(sommesBas, sommesHaut, _MM_SHUFFLE(2, 0, 2, 0))),
+                                 _mm_castps_si128(_mm_shuffle_ps(sommesBas, sommesHaut, _MM_SHUFFLE(3, 1, 3, 1))));
+        };
+
+        __m128i r = _mm_and_si128(pixels, masqueOctet);
+        __m128i b = _mm_and_si128(_mm_srli_epi32(pixels, 16), masqueOctet);
+        const __m128i decalage = _mm_set1_epi32((128 << 16) + 32767);
+
+        Y = _mm_add_epi32(combiner(_mm_setr_epi16(19595, 32767, 7471, 5703, 19595, 32767, 7471, 5703)),
+                          _mm_set1_epi32(32768));
+        Cb = _mm_add_epi32(combiner(_mm_setr_epi16(-11056, -21712, 32767, 0, -11056, -21712, 32767, 0)),
+                           _mm_add_epi32(b, decalage));
+        Cr = _mm_add_epi32(combiner(_mm_setr_epi16(32767, -27440, -5328, 0, 32767, -27440, -5328, 0)),
+                           _mm_add_epi32(r, decalage));
+    }
+
+    // 8 valeurs 32 bits (entre 0 et 255 après décalage) écrites en 8 octets
+    void stockerHuitOctets(unsigned char* destination, __m128i premiers, __m128i derniers) {
+        __m128i mots = _mm_packs_epi32(_mm_srli_epi32(premiers, 16), _mm_srli_epi32(derniers, 16));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(destination), _mm_packus_epi16(mots, mots));
+    }
+}
+#endif
+
+cCompressionCouleur::cCompressionCouleur()
+    : cCompression(), mRGB(nullptr), mSousEchantillonnage(SOUS_ECHANTILLONNAGE_420) {
+}
+
+cCompressionCouleur::~cCompressionCouleur() {
+    delete[] mRGB;
+}
+
+unsigned int cCompressionCouleur::facteurHorizontal(eSousEchantillonnage sousEchantillonnage) {
+    return (sousEchantillonnage == SOUS_ECHANTILLONNAGE_444) ? 1 : 2;
+}
+
+unsigned int cCompressionCouleur::facteurVertical(eSousEchantillonnage sousEchantillonnage) {
+    return (sousEchantillonnage == SOUS_ECHANTILLONNAGE_420) ? 2 : 1;
+}
+
+bool cCompressionCouleur::chargerImageRGB(const unsigned char* rgb, unsigned int largeur, unsigned int hauteur) {
+    if (!rgb || largeur == 0 || hauteur == 0) {
+        cerr << "Erreur: Image RGB invalide" << endl;
+        return false;
+    }
+
+    delete[] mRGB;
+    mRGB = new unsigned char[largeur * hauteur * 3];
+    copy(rgb, rgb + largeur * hauteur * 3, mRGB);
+
+    // Pas de buffer en niveaux de gris : l'ancien (de la hauteur précédente)
+    // est libéré avant de changer les dimensions
+    libererBuffer();
+    setLargeur(largeur);
+    setHauteur(hauteur);
+    return true;
+}
+
+bool cCompressionCouleur::chargerImagePPM(const char* nomFichier) {
+    ifstream fichier(nomFichier, ios::binary);
+    if (!fichier) {
+        cerr << "Erreur: Impossible d'ouvrir " << nomFichier << endl;
+        return false;
+    }
+
+    // En-tête : P6, largeur, hauteur, valeur maximale (commentaires # ignorés)
+    string type;
+    unsigned int valeurs[3];
+    fichier >> type;
+    for (int i = 0; i < 3 && fichier; i++) {
+        fichier >> ws;
+        while (fichier.peek() == '#') {
+            string commentaire;
+            getline(fichier, commentaire);
+            fichier >> ws;
+        }
+        fichier >> valeurs[i];
+    }
+    fichier.get();  // Un seul caractère blanc avant les pixels
+
+    if (!fichier || type != "P6" || valeurs[2] != 255) {
+        cerr << "Erreur: " << nomFichier << " n'est pas un PPM binaire 8 bits" << endl;
+        return false;
+    }
+
+    vector<unsigned char> pixels(valeurs[0] * valeurs[1] * 3);
+    fichier.read(reinterpret_cast<char*>(pixels.data()), pixels.size());
+    if (!fichier) {
+        cerr << "Erreur: Pixels tronqués dans " << nomFichier << endl;
+        return false;
+    }
+
+    return chargerImageRGB(pixels.data(), valeurs[0], valeurs[1]);
+}
+
+void cCompressionCouleur::convertirRGBversYCbCr(const unsigned char* rgb, unsigned int nbPixels,
+                                                unsigned char* Y, unsigned char* Cb, unsigned char* Cr) {
+    // Coefficients JFIF multipliés par 2^16 ; le décalage de 128 des
+    // chrominances et l'arrondi sont inclus dans la constante
+    const int decalage = (128 << 16) + 32767;
+    unsigned int i = 0;
+
+#ifdef JPEG_COULEUR_SSE2
+    // 8 pixels par itération : deux lectures de 16 octets (aux octets 0 et 12),
+    // qui ne dépassent pas la fin du tableau tant que 10 pixels restent
+    for (; i + 10 <= nbPixels; i += 8) {
+        __m128i Y0, Cb0, Cr0, Y1, Cb1, Cr1;
+        convertirQuatrePixels(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb + 3 * i)), Y0, Cb0, Cr0);
+        convertirQuatrePixels(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb + 3 * i + 12)), Y1, Cb1, Cr1);
+        stockerHuitOctets(Y + i, Y0, Y1);
+        stockerHuitOctets(Cb + i, Cb0, Cb1);
+        stockerHuitOctets(Cr + i, Cr0, Cr1);
+    }
+#endif
+
+    for (; i < nbPixels; i++) {
+        int r = rgb[3 * i];
+        int g = rgb[3 * i + 1];
+        int b = rgb[3 * i + 2];
+
+        Y[i]  = static_cast<unsigned char>((19595 * r + 38470 * g + 7471 * b + 32768) >> 16);
+        Cb[i] = static_cast<unsigned char>((-11056 * r - 21712 * g + 32768 * b + decalage) >> 16);
+        Cr[i] = static_cast<unsigned char>((32768 * r - 27440 * g - 5328 * b + decalage) >> 16);
+    }
+}
+
+int cCompressionCouleur::coderBloc(const unsigned char* plan, unsigned int largeurPlan, unsigned int x, unsigned int y,
+                                   const int table[8][8], int& DC_precedent, int* Trame) {
+    char blocChar[8][8];
+    double dct[8][8];
+    char* charPtrs[8];
+    double* doublePtrs[8];
+    for (int i = 0; i < 8; i++) {
+        charPtrs[i] = blocChar[i];
+        doublePtrs[i] = dct[i];
+    }
+
+    // 1. Décalage de niveau
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_DECALAGE);
+        for (int i = 0; i < 8; i++) {
+            const unsigned char* ligne = plan + (y + i) * largeurPlan + x;
+            for (int j = 0; j < 8; j++) {
+                blocChar[i][j] = static_cast<char>(ligne[j] - 128);
+            }
+        }
+    }
+
+    // 2. DCT (DC seul pour un bloc uniforme)
+    double DC;
+    if (estBlocUniforme(charPtrs, pasMinimalAC(table), DC)) {
+        memset(dct, 0, sizeof(dct));
+        dct[0][0] = DC;
+    } else {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_DCT);
+        Calcul_DCT_Block(charPtrs, doublePtrs);
+    }
+
+    // 3. Quantification avec la table de la composante, en ordre zigzag
+    int coefficients[64];
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_QUANTIFICATION);
+        for (int k = 0; k < 64; k++) {
+            int u = ZIGZAG[k][0];
+            int v = ZIGZAG[k][1];
+            coefficients[k] = static_cast<int>(round(dct[u][v] / table[u][v]));
+        }
+    }
+
+    // 4. RLE
+    int longueur;
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_RLE);
+        longueur = RLE_Zigzag(coefficients, DC_precedent, Trame);
+    }
+    DC_precedent = coefficients[0];
+
+    JPEG_INSTR(
+        getInstrumentation().ajouterOctets(ETAPE_DCT, sizeof(dct));
+        getInstrumentation().ajouterOctets(ETAPE_RLE, longueur * sizeof(int));
+        getInstrumentation().enregistrerBloc(cInstrumentation::positionEOB(Trame, longueur))
+    );
+
+    return longueur;
+}
+
+bool cCompressionCouleur::compresserCouleur(const char* nomFichierSortie) {
+    if (!mRGB) {
+        cerr << "Erreur: Aucune image RGB chargée" << endl;
+        return false;
+    }
+
+    unsigned int largeur = getLargeur();
+    unsigned int hauteur = getHauteur();
+    unsigned int qualite = getQualite();
+
+    // 1. Géométrie des MCU et des plans (complétés jusqu'à un nombre entier de MCU)
+    unsigned int fh = facteurHorizontal(mSousEchantillonnage);
+    unsigned int fv = facteurVertical(mSousEchantillonnage);
+    unsigned int nbMCUX = (largeur + 8 * fh - 1) / (8 * fh);
+    unsigned int nbMCUY = (hauteur + 8 * fv - 1) / (8 * fv);
+    unsigned int largeurY = nbMCUX * 8 * fh;
+    unsigned int hauteurY = nbMCUY * 8 * fv;
+    unsigned int largeurC = nbMCUX * 8;
+    unsigned int hauteurC = nbMCUY * 8;
+
+    // 2. Conversion RGB -> YCbCr à pleine résolution
+    vector<unsigned char> Y(largeur * hauteur), Cb(largeur * hauteur), Cr(largeur * hauteur);
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_CHARGEMENT);
+        convertirRGBversYCbCr(mRGB, largeur * hauteur, Y.data(), Cb.data(), Cr.data());
+    }
+
+    // 3. Plans complétés (répétition du bord) et chrominance moyennée sur fh x fv pixels
+    vector<unsigned char> planY(largeurY * hauteurY), planCb(largeurC * hauteurC), planCr(largeurC * hauteurC);
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_DECALAGE);
+        for (unsigned int i = 0; i < hauteurY; i++) {
+            const unsigned char* source = &Y[min(i, hauteur - 1) * largeur];
+            for (unsigned int j = 0; j < largeurY; j++) {
+                planY[i * largeurY + j] = source[min(j, largeur - 1)];
+            }
+        }
+
+        for (unsigned int i = 0; i < hauteurC; i++) {
+            for (unsigned int j = 0; j < largeurC; j++) {
+                int sommeCb = 0, sommeCr = 0;
+                for (unsigned int di = 0; di < fv; di++) {
+                    unsigned int ligne = min(i * fv + di, hauteur - 1) * largeur;
+                    for (unsigned int dj = 0; dj < fh; dj++) {
+                        unsigned int index = ligne + min(j * fh + dj, largeur - 1);
+                        sommeCb += Cb[index];
+                        sommeCr += Cr[index];
+                    }
+                }
+                int nombre = fh * fv;
+                planCb[i * largeurC + j] = static_cast<unsigned char>((sommeCb + nombre / 2) / nombre);
+                planCr[i * largeurC + j] = static_cast<unsigned char>((sommeCr + nombre / 2) / nombre);
+            }
+        }
+    }
+
+    // 4. Tables de quantification de la luminance et de la chrominance
+    int tableY[8][8];
+    int tableC[8][8];
+    calculerTableQuantification(qualite, tableY);
+    calculerTableQuantification(qualite, tableC, true);
+
+    // 5. Codage des MCU entrelacées : blocs Y, puis Cb, puis Cr
+    unsigned int blocsParMCU = fh * fv + 2;
+    vector<int> trame(nbMCUX * nbMCUY * blocsParMCU * 129);
+    int longueurTrame = 0;
+    int DC_Y = 0, DC_Cb = 0, DC_Cr = 0;
+
+    for (unsigned int my = 0; my < nbMCUY; my++) {
+        for (unsigned int mx = 0; mx < nbMCUX; mx++) {
+            for (unsigned int by = 0; by < fv; by++) {
+                for (unsigned int bx = 0; bx < fh; bx++) {
+                    longueurTrame += coderBloc(planY.data(), largeurY, (mx * fh + bx) * 8, (my * fv + by) * 8,
+                                               tableY, DC_Y, &trame[longueurTrame]);
+                }
+            }
+            longueurTrame += coderBloc(planCb.data(), largeurC, mx * 8, my * 8, tableC, DC_Cb, &trame[longueurTrame]);
+            longueurTrame += coderBloc(planCr.data(), largeurC, mx * 8, my * 8, tableC, DC_Cr, &trame[longueurTrame]);
+        }
+    }
+
+    // 6. Écriture du fichier
+    JPEG_CHRONO(getInstrumentation(), ETAPE_ECRITURE);
+
+    ofstream fichier(nomFichierSortie, ios::binary);
+    if (!fichier) {
+        cerr << "Erreur: Impossible de créer " << nomFichierSortie << endl;
+        return false;
+    }
+
+    unsigned int entete[6] = {SIGNATURE_COULEUR, largeur, hauteur, qualite,
+                              static_cast<unsigned int>(mSousEchantillonnage),
+                              static_cast<unsigned int>(longueurTrame)};
+    fichier.write(reinterpret_cast<const char*>(entete), sizeof(entete));
+    fichier.write(reinterpret_cast<const char*>(trame.data()), longueurTrame * sizeof(int));
+
+    JPEG_INSTR(getInstrumentation().ajouterOctets(ETAPE_ECRITURE, sizeof(entete) + longueurTrame * sizeof(int)));
+
+    cout << "Compression couleur terminée: " << nomFichierSortie << " (" << largeur << "x" << hauteur
+         << ", " << (fh * fv == 1 ? "4:4:4" : (fv == 1 ? "4:2:2" : "4:2:0"))
+         << ", " << sizeof(entete) + longueurTrame * sizeof(int) << " octets)" << endl;
+
+    return fichier.good();
+}
@@ -0,0 +1,129 @@
+/**
+ * @file cCompressionCouleur.h
+ * @brief Déclaration de la classe cCompressionCouleur (images RGB, YCbCr sous-échantillonné)
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef CCOMPRESSIONCOULEUR_H
+#define CCOMPRESSIONCOULEUR_H
+
+#include "cCompression.h"
+
+/**
+ * @enum eSousEchantillonnage
+ * @brief Sous-échantillonnage des composantes de chrominance (Cb, Cr)
+ */
+enum eSousEchantillonnage {
+    SOUS_ECHANTILLONNAGE_444 = 0,   ///< Chrominance à pleine résolution (MCU 8x8)
+    SOUS_ECHANTILLONNAGE_422,       ///< Chrominance divisée par 2 horizontalement (MCU 16x8)
+    SOUS_ECHANTILLONNAGE_420        ///< Chrominance divisée par 2 dans les deux sens (MCU 16x16)
+};
+
+/**
+ * @class cCompressionCouleur
+ * @brief Compression JPEG d'images RGB
+ *
+ * L'image est convertie en YCbCr, la chrominance est sous-échantillonnée
+ * puis les blocs sont codés par MCU entrelacées : les blocs Y de la MCU,
+ * puis un bloc Cb et un bloc Cr. La luminance est quantifiée avec la table
+ * de luminance, Cb et Cr avec la table de chrominance ; chaque composante
+ * a sa propre chaîne de différences DC.
+ *
+ * Format du fichier : SIGNATURE_COULEUR, largeur, hauteur, qualité,
+ * sous-échantillonnage et longueur de trame (uint32), puis la trame (int32).
+ */
+class cCompressionCouleur : public cCompression {
+private:
+    unsigned char* mRGB;                        ///< Pixels RGB entrelacés (3 octets par pixel)
+    eSousEchantillonnage mSousEchantillonnage;  ///< Sous-échantillonnage de la chrominance
+
+public:
+    /**
+     * @brief Signature placée en tête des fichiers couleur ("JCOL")
+     */
+    static const unsigned int SIGNATURE_COULEUR = 0x4C4F434A;
+
+    /**
+     * @brief Constructeur par défaut (sous-échantillonnage 4:2:0)
+     */
+    cCompressionCouleur();
+
+    /**
+     * @brief Destructeur
+     */
+    ~cCompressionCouleur();
+
+    /**
+     * @brief Charge une image RGB depuis la mémoire
+     * @param rgb Pixels RGB entrelacés (largeur x hauteur x 3 octets)
+     * @param largeur Largeur de l'image
+     * @param hauteur Hauteur de l'image
+     * @return true si chargement réussi
+     */
+    bool chargerImageRGB(const unsigned char* rgb, unsigned int largeur, unsigned int hauteur);
+
+    /**
+     * @brief Charge une image PPM binaire (P6, 8 bits par composante)
+     * @param nomFichier Chemin du fichier PPM
+     * @return true si chargement réussi
+     */
+    bool chargerImagePPM(const char* nomFichier);
+
+    /**
+     * @brief Accès aux pixels RGB chargés
+     * @return Pixels RGB entrelacés, nullptr si aucune image
+     */
+    const unsigned char* getRGB() const { return mRGB; }
+
+    eSousEchantillonnage getSousEchantillonnage() const { return mSousEchantillonnage; }
+    void setSousEchantillonnage(eSousEchantillonnage sousEchantillonnage) { mSousEchantillonnage = sousEchantillonnage; }
+
+    /**
+     * @brief Compresse l'image RGB chargée
+     * @param nomFichierSortie Chemin du fichier compressé
+     * @return true si compression réussie
+     */
+    bool compresserCouleur(const char* nomFichierSortie);
+
+    /**
+     * @brief Convertit des pixels RGB entrelacés en trois plans Y, Cb, Cr (JFIF)
+     *
+     * Calcul en virgule fixe sur 16 bits, sans branchement ni saturation
+     * (les coefficients garantissent des résultats entre 0 et 255). Avec SSE2,
+     * les pixels sont traités 8 par 8 (_mm_madd_epi16), les derniers en scalaire
+     * avec exactement le même résultat.
+     * @param rgb Pixels RGB entrelacés
+     * @param nbPixels Nombre de pixels
+     * @param Y Plan de luminance (sortie)
+     * @param Cb Plan de chrominance bleue (sortie)
+     * @param Cr Plan de chrominance rouge (sortie)
+     */
+    static void convertirRGBversYCbCr(const unsigned char* rgb, unsigned int nbPixels,
+                                      unsigned char* Y, unsigned char* Cb, unsigned char* Cr);
+
+    /**
+     * @brief Facteurs de sous-échantillonnage horizontal et vertical de la chrominance
+     * @return 1 ou 2
+     */
+    static unsigned int facteurHorizontal(eSousEchantillonnage sousEchantillonnage);
+    static unsigned int facteurVertical(eSousEchantillonnage sousEchantillonnage);
+
+private:
+    /**
+     * @brief Code un bloc 8x8 d'un plan et ajoute sa trame RLE
+     * @param plan Plan de la composante (lignes de largeurPlan octets)
+     * @param largeurPlan Largeur du plan
+     * @param x Position X du bloc
+     * @param y Position Y du bloc
+     * @param table Table de quantification de la composante
+     * @param DC_precedent DC du bloc précédent de la composante (mis à jour)
+     * @param Trame Tableau de sortie (au plus 129 symboles)
+     * @return Longueur de la trame du bloc
+     */
+    int coderBloc(const unsigned char* plan, unsigned int largeurPlan, unsigned int x, unsigned int y,
+                  const int table[8][8], int& DC_precedent, int* Trame);
+};
+
+#endif // CCOMPRESSIONCOULEUR_H
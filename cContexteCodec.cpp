@@ -0,0 +1,128 @@
+/**
+ * @file cContexteCodec.cpp
+ * @brief Implémentation de la classe cContexteCodec
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "cContexteCodec.h"
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+
+cContexteCodec::cContexteCodec()
+    : cDecompression(), mTailleFlux(0), mAllocations(0) {
+}
+
+void cContexteCodec::reserver(unsigned int largeur, unsigned int hauteur) {
+    preparerBuffer(largeur, hauteur);
+
+    size_t tailleTrame = static_cast<size_t>(largeur / 8) * (hauteur / 8) * 129;  // au plus 129 symboles par bloc
+    preparerTrame(tailleTrame);
+    if (mFlux.size() < 4 * sizeof(unsigned int) + tailleTrame * sizeof(int)) {
+        mFlux.resize(4 * sizeof(unsigned int) + tailleTrame * sizeof(int));
+        mAllocations++;
+        JPEG_INSTR(getInstrumentation().compterAllocation());
+    }
+}
+
+void cContexteCodec::preparerBuffer(unsigned int largeur, unsigned int hauteur) {
+    if (getBuffer() && getLargeur() == largeur && getHauteur() == hauteur) {
+        return;
+    }
+    // allocBuffer compte déjà ces hauteur + 1 allocations dans l'instrumentation
+    allocBuffer(largeur, hauteur);
+    mAllocations += hauteur + 1;
+}
+
+void cContexteCodec::preparerTrame(size_t taille) {
+    if (mTrame.size() < taille) {
+        mTrame.resize(taille);
+        mAllocations++;
+        JPEG_INSTR(getInstrumentation().compterAllocation());
+    }
+}
+
+bool cContexteCodec::compresserMemoire(const unsigned char* pixels, unsigned int largeur, unsigned int hauteur,
+                                       unsigned int qualite) {
+    if (!pixels || largeur < 8 || hauteur < 8 || qualite > 100) {
+        cerr << "Erreur: Image ou qualité invalide" << endl;
+        return false;
+    }
+
+    // 1. Pixels dans le buffer réutilisé
+    reserver(largeur, hauteur);
+    unsigned char** buffer = getBuffer();
+    for (unsigned int i = 0; i < hauteur; i++) {
+        memcpy(buffer[i], pixels + static_cast<size_t>(i) * largeur, largeur);
+    }
+    setQualite(qualite);
+
+    // 2. Trame RLE, puis flux au format .dat
+    int longueurTrame = RLE(mTrame.data());
+
+    unsigned int entete[4] = {largeur, hauteur, qualite, static_cast<unsigned int>(longueurTrame)};
+    memcpy(mFlux.data(), entete, sizeof(entete));
+    memcpy(mFlux.data() + sizeof(entete), mTrame.data(), longueurTrame * sizeof(int));
+    mTailleFlux = sizeof(entete) + longueurTrame * sizeof(int);
+
+    return true;
+}
+
+bool cContexteCodec::decompresserMemoire(const unsigned char* flux, size_t taille) {
+    // 1. En-tête
+    unsigned int entete[4];
+    if (!flux || taille < sizeof(entete)) {
+        cerr << "Erreur: En-tête tronqué" << endl;
+        return false;
+    }
+    memcpy(entete, flux, sizeof(entete));
+    unsigned int largeur = entete[0];
+    unsigned int hauteur = entete[1];
+    unsigned int qualite = entete[2];
+    size_t longueurTrame = entete[3];
+
+    if (largeur == SIGNATURE_PROGRESSIF || largeur == SIGNATURE_TUILES) {
+        cerr << "Erreur: Seuls les flux séquentiels sont décodés en mémoire" << endl;
+        return false;
+    }
+    if ((taille - sizeof(entete)) / sizeof(int) < longueurTrame) {
+        cerr << "Erreur: Trame tronquée" << endl;
+        return false;
+    }
+
+    // Dimensions vérifiées avant d'allouer le buffer : chaque bloc complet
+    // occupe au moins 3 entiers de la trame (DC et paire de fin), et une image
+    // sans bloc complet n'est pas codée
+    unsigned int nbBlocsX = largeur / 8;
+    unsigned int nbBlocsY = hauteur / 8;
+    if (nbBlocsX == 0 || nbBlocsY == 0 ||
+        static_cast<unsigned long long>(nbBlocsX) * nbBlocsY > longueurTrame / 3) {
+        cerr << "Erreur: Dimensions " << largeur << "x" << hauteur << " incompatibles avec la trame" << endl;
+        return false;
+    }
+
+    // 2. Trame copiée dans le contexte (le flux n'est pas forcément aligné
+    //    sur un int et ses octets ne sont lus que par memcpy)
+    preparerTrame(longueurTrame);
+    memcpy(mTrame.data(), flux + sizeof(entete), longueurTrame * sizeof(int));
+
+    // 3. Blocs décodés directement dans le buffer réutilisé
+    preparerBuffer(largeur, hauteur);
+    setQualite(qualite);
+    unsigned char** buffer = getBuffer();
+    if (!decoderTrameTuile(mTrame.data(), static_cast<int>(longueurTrame), nbBlocsX, nbBlocsY, buffer, 0, 0)) {
+        cerr << "Erreur: Trame corrompue" << endl;
+        return false;
+    }
+
+    // Pixels hors des blocs complets (non codés) : à zéro, comme Decompression_JPEG
+    for (unsigned int i = 0; i < hauteur; i++) {
+        unsigned int debut = i < nbBlocsY * 8 ? nbBlocsX * 8 : 0;
+        memset(buffer[i] + debut, 0, largeur - debut);
+    }
+
+    return true;
+}
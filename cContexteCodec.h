@@ -0,0 +1,96 @@
+/**
+ * @file cContexteCodec.h
+ * @brief Déclaration de la classe cContexteCodec (codage et décodage en mémoire sans allocation)
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef CCONTEXTECODEC_H
+#define CCONTEXTECODEC_H
+
+#include "cDecompression.h"
+#include <vector>
+
+/**
+ * @class cContexteCodec
+ * @brief Codeur/décodeur réutilisable pour des images en niveaux de gris
+ *
+ * Le contexte garde d'un appel à l'autre le buffer de l'image, la trame RLE,
+ * le flux compressé et les facteurs de déquantification. Ces tampons ne font
+ * que grandir : une fois chauffé, le contexte code et décode des images de
+ * mêmes dimensions sans aucune allocation sur le tas. Le flux a le format des
+ * fichiers .dat séquentiels (en-tête de 4 entiers, puis la trame).
+ *
+ * Un contexte n'est utilisable que par un thread à la fois.
+ */
+class cContexteCodec : public cDecompression {
+private:
+    std::vector<int> mTrame;            ///< Trame RLE (codage, ou copie de la trame décodée)
+    std::vector<unsigned char> mFlux;   ///< Dernier flux compressé
+    size_t mTailleFlux;                 ///< Taille utile de mFlux en octets
+    unsigned long long mAllocations;    ///< Allocations faites par le contexte depuis sa création
+
+public:
+    /**
+     * @brief Constructeur (aucun tampon alloué)
+     */
+    cContexteCodec();
+
+    /**
+     * @brief Réserve les tampons pour des images jusqu'à largeur x hauteur
+     * @param largeur Largeur maximale
+     * @param hauteur Hauteur maximale
+     */
+    void reserver(unsigned int largeur, unsigned int hauteur);
+
+    /**
+     * @brief Compresse une image en mémoire
+     *
+     * Le flux produit est identique au fichier écrit par compresser().
+     * @param pixels Pixels de l'image (hauteur lignes de largeur octets)
+     * @param largeur Largeur de l'image (au moins 8)
+     * @param hauteur Hauteur de l'image (au moins 8)
+     * @param qualite Qualité de compression (0-100)
+     * @return true si compression réussie (flux accessible par getFlux())
+     */
+    bool compresserMemoire(const unsigned char* pixels, unsigned int largeur, unsigned int hauteur,
+                           unsigned int qualite);
+
+    const unsigned char* getFlux() const { return mFlux.data(); }
+    size_t getTailleFlux() const { return mTailleFlux; }
+
+    /**
+     * @brief Décompresse un flux séquentiel en mémoire
+     *
+     * L'image est écrite dans le buffer du contexte (getBuffer(), getLargeur(),
+     * getHauteur()), valable jusqu'au prochain appel. La trame est copiée
+     * dans le contexte : le flux peut avoir n'importe quel alignement. Les
+     * dimensions de l'en-tête sont refusées si la trame est trop courte pour
+     * leurs blocs.
+     * @param flux Flux compressé (format .dat séquentiel)
+     * @param taille Taille du flux en octets
+     * @return true si décompression réussie
+     */
+    bool decompresserMemoire(const unsigned char* flux, size_t taille);
+
+    /**
+     * @brief Nombre d'allocations faites par le contexte (tampons agrandis)
+     *
+     * Reste constant une fois le contexte chauffé pour une taille d'image.
+     */
+    unsigned long long getAllocations() const { return mAllocations; }
+
+private:
+    /**
+     * @brief Donne au buffer de l'image les dimensions demandées (réalloué seulement si elles changent)
+     */
+    void preparerBuffer(unsigned int largeur, unsigned int hauteur);
+
+    /**
+     * @brief Agrandit la trame à au moins taille entiers
+     */
+    void preparerTrame(size_t taille);
+};
+
+#endif // CCONTEXTECODEC_H
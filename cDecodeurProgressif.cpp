@@ -0,0 +1,176 @@
+/**
+ * @file cDecodeurProgressif.cpp
+ * @brief Implémentation de la classe cDecodeurProgressif
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "cDecodeurProgressif.h"
+#include <climits>
+#include <iostream>
+
+using namespace std;
+
+cDecodeurProgressif::cDecodeurProgressif()
+    : cDecompression(), mPosition(0), mNbPasses(0), mNbPassesDecodees(0), mNbBlocsX(0), mNbBlocsY(0),
+      mBlocs(nullptr), mBlocsModifies(nullptr), mCoefficientsAC(false), mBlocsRendus(0),
+      mLargeurImage(0), mHauteurImage(0) {
+}
+
+cDecodeurProgressif::~cDecodeurProgressif() {
+    fermer();
+}
+
+void cDecodeurProgressif::fermer() {
+    delete[] mBlocs;
+    delete[] mBlocsModifies;
+    mBlocs = nullptr;
+    mBlocsModifies = nullptr;
+    if (mFichier.is_open()) {
+        mFichier.close();
+    }
+    mNbPasses = 0;
+    mNbPassesDecodees = 0;
+    mCoefficientsAC = false;
+    mBlocsRendus = 0;
+}
+
+bool cDecodeurProgressif::ouvrir(const char* Nom_Fichier_compresse) {
+    fermer();
+
+    mFichier.open(Nom_Fichier_compresse, ios::binary);
+    if (!mFichier) {
+        cerr << "Erreur: Impossible d'ouvrir le fichier compressé " << Nom_Fichier_compresse << endl;
+        return false;
+    }
+
+    // 1. En-tête
+    unsigned int entete[5];
+    mFichier.read(reinterpret_cast<char*>(entete), sizeof(entete));
+    if (!mFichier) {
+        cerr << "Erreur: En-tête incomplet dans " << Nom_Fichier_compresse << endl;
+        mFichier.close();
+        return false;
+    }
+    if (entete[0] != SIGNATURE_PROGRESSIF) {
+        cerr << "Erreur: " << Nom_Fichier_compresse << " n'est pas un fichier progressif" << endl;
+        mFichier.close();
+        return false;
+    }
+    mPosition = mFichier.tellg();
+
+    // Le fichier peut être incomplet : seul le débordement est écarté ici, la
+    // taille de l'image est confrontée à la passe DC quand elle arrive
+    if (!dimensionsProgressivesValides(entete[1], entete[2], ULLONG_MAX)) {
+        cerr << "Erreur: Dimensions " << entete[1] << "x" << entete[2] << " invalides dans "
+             << Nom_Fichier_compresse << endl;
+        mFichier.close();
+        return false;
+    }
+    mLargeurImage = entete[1];
+    mHauteurImage = entete[2];
+    mNbPasses = entete[4];
+    mNbBlocsX = mLargeurImage / 8;
+    mNbBlocsY = mHauteurImage / 8;
+    setQualite(entete[3]);
+    return true;
+}
+
+void cDecodeurProgressif::allouerImage() {
+    // Coefficients à zéro, image vide
+    int totalBlocs = mNbBlocsX * mNbBlocsY;
+    mBlocs = new int[totalBlocs][64];
+    mBlocsModifies = new bool[totalBlocs];
+    for (int b = 0; b < totalBlocs; b++) {
+        for (int k = 0; k < 64; k++) {
+            mBlocs[b][k] = 0;
+        }
+    }
+    JPEG_INSTR(getInstrumentation().compterAllocation(2));
+
+    allocBuffer(mLargeurImage, mHauteurImage);
+}
+
+bool cDecodeurProgressif::decoderPasseSuivante() {
+    mBlocsRendus = 0;
+    if (!mFichier.is_open() || mNbPassesDecodees >= mNbPasses) {
+        return false;
+    }
+    int totalBlocs = mNbBlocsX * mNbBlocsY;
+
+    // 1. Passe suivante, seulement si elle est arrivée en entier
+    unsigned int descripteur[3];
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_CHARGEMENT);
+        mFichier.clear();
+        mFichier.seekg(0, ios::end);
+        streamoff finFichier = mFichier.tellg();
+        mFichier.seekg(mPosition);
+        mFichier.read(reinterpret_cast<char*>(descripteur), sizeof(descripteur));
+        if (!mFichier) {
+            return false;
+        }
+
+        // Au plus un DC ou 64 paires par bloc ; la première passe est celle des
+        // DC, avec un entier par bloc
+        bool premierePasse = mBlocs == nullptr;
+        if (descripteur[0] > descripteur[1] || descripteur[1] > 63 ||
+            descripteur[2] > static_cast<unsigned int>(totalBlocs) * 129 ||
+            (premierePasse && (descripteur[0] != 0 || descripteur[2] < static_cast<unsigned int>(totalBlocs)))) {
+            cerr << "Erreur: Descripteur de la passe " << mNbPassesDecodees << " invalide" << endl;
+            mNbPasses = mNbPassesDecodees;
+            return false;
+        }
+
+        // Rien n'est alloué pour une passe qui n'est pas encore là
+        if (static_cast<unsigned long long>(finFichier - mFichier.tellg()) / sizeof(int) < descripteur[2]) {
+            return false;
+        }
+        if (premierePasse) {
+            allouerImage();
+        }
+
+        mTrame.resize(descripteur[2]);
+        mFichier.read(reinterpret_cast<char*>(mTrame.data()), mTrame.size() * sizeof(int));
+        if (!mFichier) {
+            return false;
+        }
+        mPosition = mFichier.tellg();
+    }
+
+    // 2. Bande décodée dans les coefficients gardés des passes précédentes
+    for (int b = 0; b < totalBlocs; b++) {
+        mBlocsModifies[b] = false;
+    }
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_RLE);
+        if (!decoderBandeProgressive(mTrame.data(), static_cast<int>(mTrame.size()), descripteur[0],
+                                     descripteur[1], totalBlocs, mBlocs, mBlocsModifies)) {
+            cerr << "Erreur: Passe " << mNbPassesDecodees << " invalide" << endl;
+            mNbPasses = mNbPassesDecodees;
+            return false;
+        }
+    }
+    mNbPassesDecodees++;
+
+    // 3. Rendu : moyenne des blocs tant qu'il n'y a que les DC, sinon IDCT
+    //    des seuls blocs modifiés (de tous à la première passe AC)
+    if (descripteur[1] == 0 && !mCoefficientsAC) {
+        remplirBlocsDC(mBlocs, mNbBlocsX, mNbBlocsY);
+        mBlocsRendus = totalBlocs;
+        return true;
+    }
+
+    if (!mCoefficientsAC) {
+        mCoefficientsAC = true;
+        for (int b = 0; b < totalBlocs; b++) {
+            mBlocsModifies[b] = true;
+        }
+    }
+    for (int b = 0; b < totalBlocs; b++) {
+        mBlocsRendus += mBlocsModifies[b];
+    }
+    reconstruireImage(mBlocs, mNbBlocsX, mNbBlocsY, 1, mBlocsModifies);
+    return true;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file cDecodeurProgressif.h
+ * @brief Déclaration de la classe cDecodeurProgressif (rendu d'un fichier progressif passe par passe)
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef CDECODEURPROGRESSIF_H
+#define CDECODEURPROGRESSIF_H
+
+#include "cDecompression.h"
+#include <fstream>
+#include <vector>
+
+/**
+ * @class cDecodeurProgressif
+ * @brief Décodeur incrémental des fichiers progressifs (voir cCompression::compresserProgressif)
+ *
+ * Le fichier reste ouvert et les coefficients de tous les blocs sont gardés
+ * d'une passe à l'autre. decoderPasseSuivante() ne lit que la passe qui vient
+ * d'arriver, la décode dans les coefficients existants et ne refait l'IDCT
+ * que des blocs qu'elle a modifiés : le coût cumulé de l'affichage après
+ * chaque passe est celui d'un seul décodage, au lieu de redécoder toutes les
+ * passes précédentes à chaque appel de Decompression_Progressive.
+ *
+ * Le fichier peut être en cours de réception : une passe incomplète n'est
+ * pas consommée et sera relue à l'appel suivant.
+ */
+class cDecodeurProgressif : public cDecompression {
+private:
+    std::ifstream mFichier;         ///< Fichier progressif, ouvert jusqu'à la dernière passe
+    std::streamoff mPosition;       ///< Début de la prochaine passe dans le fichier
+    unsigned int mNbPasses;         ///< Nombre de passes annoncé par l'en-tête
+    unsigned int mNbPassesDecodees; ///< Passes déjà décodées
+    int mNbBlocsX;                  ///< Nombre de blocs en largeur
+    int mNbBlocsY;                  ///< Nombre de blocs en hauteur
+    int (*mBlocs)[64];              ///< Coefficients de tous les blocs, en ordre zigzag
+    bool* mBlocsModifies;           ///< Blocs modifiés par la dernière passe
+    bool mCoefficientsAC;           ///< Vrai dès qu'une passe AC a été décodée
+    std::vector<int> mTrame;        ///< Trame de la passe en cours (réutilisée)
+    int mBlocsRendus;               ///< Blocs recalculés par la dernière passe
+    unsigned int mLargeurImage;     ///< Largeur annoncée par l'en-tête
+    unsigned int mHauteurImage;     ///< Hauteur annoncée par l'en-tête
+
+public:
+    /**
+     * @brief Constructeur (aucun fichier ouvert)
+     */
+    cDecodeurProgressif();
+
+    /**
+     * @brief Destructeur
+     */
+    ~cDecodeurProgressif();
+
+    // Non copiable : les coefficients appartiennent à une seule instance
+    cDecodeurProgressif(const cDecodeurProgressif&) = delete;
+    cDecodeurProgressif& operator=(const cDecodeurProgressif&) = delete;
+
+    /**
+     * @brief Ouvre un fichier progressif et lit son en-tête
+     *
+     * L'image (getBuffer()) et les coefficients ne sont alloués qu'à l'arrivée
+     * de la passe DC, qui compte un entier par bloc : des dimensions forgées ne
+     * peuvent pas provoquer une allocation plus grande que le fichier reçu.
+     * @param Nom_Fichier_compresse Chemin du fichier progressif
+     * @return true si l'en-tête est complet et valide
+     */
+    bool ouvrir(const char* Nom_Fichier_compresse);
+
+    /**
+     * @brief Décode la passe suivante et met l'image à jour
+     *
+     * Sans passe AC, chaque bloc est rempli avec sa valeur moyenne (comme
+     * Decompression_Progressive) ; à la première passe AC tous les blocs
+     * passent par l'IDCT, ensuite seuls ceux que la passe a modifiés.
+     * @return true si une passe a été décodée, false si elle n'est pas encore
+     *         arrivée en entier, si toutes les passes sont décodées ou en cas d'erreur
+     */
+    bool decoderPasseSuivante();
+
+    unsigned int getNbPasses() const { return mNbPasses; }
+    unsigned int getNbPassesDecodees() const { return mNbPassesDecodees; }
+    bool estTermine() const { return mBlocs && mNbPassesDecodees == mNbPasses; }
+
+    /**
+     * @brief Nombre de blocs recalculés par le dernier appel à decoderPasseSuivante()
+     */
+    int getBlocsRendus() const { return mBlocsRendus; }
+
+private:
+    /**
+     * @brief Alloue les coefficients et l'image (à la première passe)
+     */
+    void allouerImage();
+
+    /**
+     * @brief Libère les coefficients et ferme le fichier
+     */
+    void fermer();
+};
+
+#endif // CDECODEURPROGRESSIF_H
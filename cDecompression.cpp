@@ -1,273 +1,1543 @@
-/**
- * @file cDecompression.cpp
- * @brief Implmentation de la classe cDecompression
- * @author EL KILI Rim
- * @date 2025
- * @version 1.0
- */
-
-#include "cDecompression.h"
-#include <fstream>
-#include <iostream>
-#include <cmath>
-
-using namespace std;
-
-cDecompression::cDecompression() : cCompression() {}
-
-cDecompression::cDecompression(unsigned int largeur, unsigned int hauteur, unsigned int qualite)
-    : cCompression(largeur, hauteur, qualite) {}
-
-char** cDecompression::Decompression_JPEG(const char* Nom_Fichier_compresse) {
-    ifstream fichier(Nom_Fichier_compresse, ios::binary);
-    if (!fichier) {
-        cerr << "Erreur: Impossible d'ouvrir le fichier compress" << endl;
-        return nullptr;
-    }
-
-    // Lire les mtadonnes
-    unsigned int largeur, hauteur, qualite;
-    fichier.read(reinterpret_cast<char*>(&largeur), sizeof(largeur));
-    fichier.read(reinterpret_cast<char*>(&hauteur), sizeof(hauteur));
-    fichier.read(reinterpret_cast<char*>(&qualite), sizeof(qualite));
-
-    // Dfinir les proprits
-    setLargeur(largeur);
-    setHauteur(hauteur);
-    setQualite(qualite);
-
-    // Allouer le buffer via la fonction publique
-    allocBuffer(largeur, hauteur);
-
-    // Lire la longueur de la trame
-    int longueurTrame;
-    fichier.read(reinterpret_cast<char*>(&longueurTrame), sizeof(longueurTrame));
-
-    // Lire la trame RLE
-    int* trame = new int[longueurTrame];
-    fichier.read(reinterpret_cast<char*>(trame), longueurTrame * sizeof(int));
-
-    fichier.close();
-
-    // Calculer le nombre de blocs
-    int nbBlocsX = largeur / 8;
-    int nbBlocsY = hauteur / 8;
-    int totalBlocs = nbBlocsX * nbBlocsY;
-
-    // Allouer les blocs (chaque bloc a 64 coefficients)
-    int** blocs = new int*[totalBlocs];
-    for (int i = 0; i < totalBlocs; i++) {
-        blocs[i] = new int[64];
-        for (int j = 0; j < 64; j++) {
-            blocs[i][j] = 0;
-        }
-    }
-
-    // Dcodeur RLE simplifi
-    int indexTrame = 0;
-    int DC_precedent = 0;
-
-    // Table de parcours zigzag inverse
-    int zigzagInv[64][2] = {
-        {0,0}, {0,1}, {1,0}, {2,0}, {1,1}, {0,2}, {0,3}, {1,2},
-        {2,1}, {3,0}, {4,0}, {3,1}, {2,2}, {1,3}, {0,4}, {0,5},
-        {1,4}, {2,3}, {3,2}, {4,1}, {5,0}, {6,0}, {5,1}, {4,2},
-        {3,3}, {2,4}, {1,5}, {0,6}, {0,7}, {1,6}, {2,5}, {3,4},
-        {4,3}, {5,2}, {6,1}, {7,0}, {7,1}, {6,2}, {5,3}, {4,4},
-        {3,5}, {2,6}, {1,7}, {2,7}, {3,6}, {4,5}, {5,4}, {6,3},
-        {7,2}, {7,3}, {6,4}, {5,5}, {4,6}, {3,7}, {4,7}, {5,6},
-        {6,5}, {7,4}, {7,5}, {6,6}, {5,7}, {6,7}, {7,6}, {7,7}
-    };
-
-    for (int b = 0; b < totalBlocs; b++) {
-        // 1. Lire le coefficient DC (diffrence)
-        int DC_diff = trame[indexTrame++];
-        int DC = DC_precedent + DC_diff;
-
-        // Stocker le coefficient DC
-        blocs[b][0] = DC;
-
-        // Mettre  jour pour le prochain bloc
-        DC_precedent = DC;
-
-        // 2. Lire les coefficients AC
-        int coeffIndex = 1; // Commencer aprs DC
-        bool finBloc = false;
-
-        while (!finBloc && coeffIndex < 64) {
-            if (indexTrame >= longueurTrame) {
-                break;
-            }
-
-            int runlength = trame[indexTrame++];
-            int amplitude = trame[indexTrame++];
-
-            if (runlength == 0 && amplitude == 0) {
-                finBloc = true;
-            } else {
-                // Sauter les zros
-                coeffIndex += runlength;
-
-                if (coeffIndex < 64) {
-                    // Stocker l'amplitude  la position zigzag
-                    blocs[b][coeffIndex] = amplitude;
-                    coeffIndex++;
-                }
-            }
-        }
-    }
-
-    // Allocations temporaires
-    char* charPtrs[8];
-    double* doublePtrs[8];
-    int* intPtrs[8];
-
-    char blocChar[8][8];
-    double dct[8][8];
-    int quant[8][8];
-
-    for (int i = 0; i < 8; i++) {
-        charPtrs[i] = blocChar[i];
-        doublePtrs[i] = dct[i];
-        intPtrs[i] = quant[i];
-    }
-
-    // Rcuprer le buffer via la fonction publique
-    unsigned char** buffer = getBuffer();
-
-    // Traiter chaque bloc
-    for (int by = 0; by < nbBlocsY; by++) {
-        for (int bx = 0; bx < nbBlocsX; bx++) {
-            int blocIndex = by * nbBlocsX + bx;
-
-            // 1. Reconstruire la matrice quantifie 8x8  partir du tableau linaire
-            for (int i = 0; i < 8; i++) {
-                for (int j = 0; j < 8; j++) {
-                    // Conversion de l'indice linaire
-                    int linearIndex = i * 8 + j;
-                    quant[i][j] = blocs[blocIndex][linearIndex];
-                }
-            }
-
-            // 2. Dquantifier
-            dequant_JPEG(intPtrs, doublePtrs);
-
-            // 3. Appliquer IDCT
-            Calcul_IDCT(doublePtrs, charPtrs);
-
-            // 4. Convertir de -128..127  0..255 et crire dans l'image
-            for (int i = 0; i < 8; i++) {
-                for (int j = 0; j < 8; j++) {
-                    unsigned int x = bx * 8 + j;
-                    unsigned int y = by * 8 + i;
-
-                    if (x < largeur && y < hauteur) {
-                        // Conversion et saturation
-                        int valeur = blocChar[i][j] + 128;
-                        if (valeur < 0) valeur = 0;
-                        if (valeur > 255) valeur = 255;
-                        buffer[y][x] = static_cast<unsigned char>(valeur);
-                    }
-                }
-            }
-        }
-    }
-
-    // Nettoyage
-    for (int i = 0; i < totalBlocs; i++) {
-        delete[] blocs[i];
-    }
-    delete[] blocs;
-    delete[] trame;
-
-    // Convertir en char** pour le retour
-    char** result = new char*[hauteur];
-    for (unsigned int i = 0; i < hauteur; i++) {
-        result[i] = new char[largeur];
-        for (unsigned int j = 0; j < largeur; j++) {
-            result[i][j] = static_cast<char>(buffer[i][j]);
-        }
-    }
-
-    cout << "Dcompression termine: " << largeur << "x" << hauteur
-         << " qualit " << qualite << "%" << endl;
-
-    return result;
-}
-
-void cDecompression::decoder_RLE(int* Trame, int longueur, int nbBlocsX, int nbBlocsY, int blocs[][64]) {
-    // Cette fonction est dj intgre dans Decompression_JPEG
-    cout << "Dcodage RLE: " << nbBlocsX << "x" << nbBlocsY << " blocs" << endl;
-}
-
-void cDecompression::reconstruireImage(int blocs[][64], int nbBlocsX, int nbBlocsY) {
-    // Cette fonction est dj intgre dans Decompression_JPEG
-    cout << "Reconstruction image: " << nbBlocsX << "x" << nbBlocsY << " blocs" << endl;
-}
-
-bool cDecompression::testerCompressionDecompression(const char* fichierEntree, int qualite) {
-    cout << "\n=== Test Compression/Dcompression ===" << endl;
-    cout << "Fichier: " << fichierEntree << endl;
-    cout << "Qualit: " << qualite << "%" << endl;
-
-    // 1. Charger l'image originale
-    cCompression compresseur;
-
-    if (!compresseur.chargerImageTexte(fichierEntree, 256, 256)) {
-        cerr << "Erreur de chargement de l'image" << endl;
-        return false;
-    }
-
-    compresseur.setQualite(qualite);
-
-    // 2. Compresser
-    string nomFichierSortie = string(fichierEntree) + "_compresse_q" + to_string(qualite) + ".dat";
-    if (!compresseur.compresser(nomFichierSortie.c_str())) {
-        cerr << "Erreur de compression" << endl;
-        return false;
-    }
-
-    // 3. Dcompresser
-    cDecompression decompresseur;
-    char** imageDecompressee = decompresseur.Decompression_JPEG(nomFichierSortie.c_str());
-
-    if (!imageDecompressee) {
-        cerr << "Erreur de dcompression" << endl;
-        return false;
-    }
-
-    // 4. Calculer des statistiques
-    unsigned int largeur = compresseur.getLargeur();
-    unsigned int hauteur = compresseur.getHauteur();
-
-    // Rcuprer l'image originale
-    unsigned char** original = compresseur.getBuffer();
-
-    // Calculer l'erreur quadratique moyenne
-    double erreurTotale = 0.0;
-    int pixels = largeur * hauteur;
-
-    for (unsigned int i = 0; i < hauteur; i++) {
-        for (unsigned int j = 0; j < largeur; j++) {
-            int diff = static_cast<int>(original[i][j]) - static_cast<int>(imageDecompressee[i][j]);
-            erreurTotale += diff * diff;
-        }
-    }
-
-    double eqm = sqrt(erreurTotale / pixels);
-    double psnr = (eqm > 0) ? 20 * log10(255.0 / eqm) : 99.99;
-
-    cout << "Resultats:" << endl;
-    cout << "  - EQM: " << eqm << endl;
-    cout << "  - PSNR: " << psnr << " dB" << endl;
-    cout << "  - Taille originale: " << pixels << " octets" << endl;
-
-    // Nettoyage
-    for (unsigned int i = 0; i < hauteur; i++) {
-        delete[] imageDecompressee[i];
-    }
-    delete[] imageDecompressee;
-
-    cout << "Test reussi!" << endl;
-    return true;
-}
+/**
+ * @file cDecompression.cpp
+ * @brief Implémentation de la classe cDecompression
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "cDecompression.h"
+#include "cFichierMappe.h"
+#include "cTablesDCT.h"
+#include <fstream>
+#include <iostream>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+
+using namespace std;
+
+cDecompression::cDecompression() : cCompression(), mLectureMappee(false), mQualiteDequant(~0u) {}
+
+cDecompression::cDecompression(unsigned int largeur, unsigned int hauteur, unsigned int qualite)
+    : cCompression(largeur, hauteur, qualite), mLectureMappee(false), mQualiteDequant(~0u) {}
+
+char** cDecompression::Decompression_JPEG(const char* Nom_Fichier_compresse, unsigned int echelle) {
+    if (echelle != 1 && echelle != 2 && echelle != 4 && echelle != 8) {
+        cerr << "Erreur: Échelle " << echelle << " non supportée (1, 2, 4 ou 8)" << endl;
+        return nullptr;
+    }
+
+    // Trame lue soit directement dans les pages projetées, soit copiée sur le tas
+    cFichierMappe projection;
+    ifstream fichier;
+    unsigned int largeur, hauteur, qualite;
+    if (mLectureMappee) {
+        if (!projection.ouvrir(Nom_Fichier_compresse) || projection.getTaille() < sizeof(largeur)) {
+            cerr << "Erreur: Impossible d'ouvrir le fichier compressé" << endl;
+            return nullptr;
+        }
+        memcpy(&largeur, projection.getDonnees(), sizeof(largeur));
+    } else {
+        fichier.open(Nom_Fichier_compresse, ios::binary);
+        if (!fichier) {
+            cerr << "Erreur: Impossible d'ouvrir le fichier compressé" << endl;
+            return nullptr;
+        }
+        fichier.read(reinterpret_cast<char*>(&largeur), sizeof(largeur));
+        if (!fichier) {
+            cerr << "Erreur: En-tête tronqué dans " << Nom_Fichier_compresse << endl;
+            return nullptr;
+        }
+    }
+
+    // Fichier progressif : décodage passe par passe
+    if (largeur == SIGNATURE_PROGRESSIF) {
+        if (echelle != 1) {
+            cerr << "Erreur: Échelle non supportée pour un fichier progressif" << endl;
+            return nullptr;
+        }
+        return Decompression_Progressive(Nom_Fichier_compresse);
+    }
+
+    // Fichier en tuiles : décodage parallèle des tuiles, qui projette le
+    // fichier lui-même en accès aléatoire
+    if (largeur == SIGNATURE_TUILES) {
+        if (echelle != 1) {
+            cerr << "Erreur: Échelle non supportée pour un fichier en tuiles" << endl;
+            return nullptr;
+        }
+        projection.fermer();
+        return Decompression_Tuiles(Nom_Fichier_compresse);
+    }
+
+    int longueurTrame;
+    const int* trame;
+    vector<int> trameLue;
+    if (mLectureMappee) {
+        // Pas de copie : la trame est décodée depuis les pages du fichier
+        const unsigned char* donnees = projection.getDonnees();
+        size_t taille = projection.getTaille();
+        if (taille < 4 * sizeof(unsigned int)) {
+            cerr << "Erreur: En-tête tronqué dans " << Nom_Fichier_compresse << endl;
+            return nullptr;
+        }
+        memcpy(&hauteur, donnees + sizeof(unsigned int), sizeof(hauteur));
+        memcpy(&qualite, donnees + 2 * sizeof(unsigned int), sizeof(qualite));
+        memcpy(&longueurTrame, donnees + 3 * sizeof(unsigned int), sizeof(longueurTrame));
+        if (longueurTrame < 0 ||
+            (taille - 4 * sizeof(unsigned int)) / sizeof(int) < static_cast<size_t>(longueurTrame)) {
+            cerr << "Erreur: Trame tronquée dans " << Nom_Fichier_compresse << endl;
+            return nullptr;
+        }
+        trame = reinterpret_cast<const int*>(donnees + 4 * sizeof(unsigned int));
+        JPEG_INSTR(getInstrumentation().ajouterOctets(ETAPE_CHARGEMENT, 4 * sizeof(int)));
+    } else {
+        // Relecture depuis le début par lireFichierCompresse(), qui rejette
+        // un en-tête ou une trame tronqués comme la lecture projetée
+        fichier.seekg(0);
+        if (!lireFichierCompresse(fichier, Nom_Fichier_compresse, largeur, hauteur, qualite, trameLue)) {
+            return nullptr;
+        }
+        fichier.close();
+        longueurTrame = static_cast<int>(trameLue.size());
+        trame = trameLue.data();
+    }
+
+    // Définir les propriétés
+    setQualite(qualite);
+
+    // Allouer le buffer à la taille de sortie (réduite si echelle > 1)
+    unsigned int largeurSortie = (largeur + echelle - 1) / echelle;
+    unsigned int hauteurSortie = (hauteur + echelle - 1) / echelle;
+    allocBuffer(largeurSortie, hauteurSortie);
+
+    // Calculer le nombre de blocs
+    int nbBlocsX = largeur / 8;
+    int nbBlocsY = hauteur / 8;
+    int totalBlocs = nbBlocsX * nbBlocsY;
+
+    // Allouer les blocs (64 coefficients par bloc, en ordre zigzag)
+    int (*blocs)[64] = new int[totalBlocs][64];
+    JPEG_INSTR(getInstrumentation().compterAllocation());
+
+    // Décoder la trame RLE
+    if (!decoder_RLE(trame, longueurTrame, nbBlocsX, nbBlocsY, blocs)) {
+        cerr << "Erreur: Trame corrompue dans " << Nom_Fichier_compresse << endl;
+        delete[] blocs;
+        return nullptr;
+    }
+
+    // Déquantifier, appliquer l'IDCT et écrire chaque bloc dans l'image
+    reconstruireImage(blocs, nbBlocsX, nbBlocsY, echelle);
+
+    // Nettoyage
+    delete[] blocs;
+    projection.fermer();
+
+    // Convertir en char** pour le retour
+    JPEG_CHRONO(getInstrumentation(), ETAPE_ECRITURE);
+    JPEG_INSTR(
+        getInstrumentation().compterAllocation(hauteurSortie + 1);
+        getInstrumentation().ajouterOctets(ETAPE_ECRITURE, largeurSortie * hauteurSortie)
+    );
+    unsigned char** buffer = getBuffer();
+    char** result = new char*[hauteurSortie];
+    for (unsigned int i = 0; i < hauteurSortie; i++) {
+        result[i] = new char[largeurSortie];
+        for (unsigned int j = 0; j < largeurSortie; j++) {
+            result[i][j] = static_cast<char>(buffer[i][j]);
+        }
+    }
+
+    cout << "Décompression terminée: " << largeurSortie << "x" << hauteurSortie
+         << " qualité " << qualite << "%";
+    if (echelle > 1) {
+        cout << " (échelle 1/" << echelle << ")";
+    }
+    cout << endl;
+
+    return result;
+}
+
+int cDecompression::decoderBlocRLE(const int* Trame, int longueur, int indexTrame,
+                                   int& DC_precedent, int* coefficients) {
+    if (coefficients) {
+        for (int k = 0; k < 64; k++) {
+            coefficients[k] = 0;
+        }
+    }
+
+    if (indexTrame >= longueur) {
+        return longueur;
+    }
+
+    // 1. Lire le coefficient DC (différence)
+    int DC = DC_precedent + Trame[indexTrame++];
+    DC_precedent = DC;
+    if (coefficients) {
+        coefficients[0] = DC;
+    }
+
+    // 2. Lire les coefficients AC
+    // Le bloc se termine toujours par une paire (zéros restants, 0), y compris
+    // (0,0) après un dernier coefficient non nul en position 63
+    int coeffIndex = 1; // Commencer après DC
+    bool finBloc = false;
+
+    while (!finBloc) {
+        if (indexTrame + 1 >= longueur) {
+            return longueur;
+        }
+
+        int runlength = Trame[indexTrame++];
+        int amplitude = Trame[indexTrame++];
+
+        if (amplitude == 0) {
+            finBloc = true;
+        } else {
+            // Sauter les zéros ; une position hors du bloc (run négatif ou
+            // au-delà de 63) ne peut venir que d'une trame corrompue
+            if (runlength < 0 || runlength > 63 - coeffIndex) {
+                return -1;
+            }
+            coeffIndex += runlength;
+
+            // Stocker l'amplitude à la position zigzag
+            if (coefficients) {
+                coefficients[coeffIndex] = amplitude;
+            }
+            coeffIndex++;
+        }
+    }
+
+    return indexTrame;
+}
+
+bool cDecompression::decoder_RLE(const int* Trame, int longueur, int nbBlocsX, int nbBlocsY, int blocs[][64]) {
+    int totalBlocs = nbBlocsX * nbBlocsY;
+    int indexTrame = 0;
+    int DC_precedent = 0;
+
+    for (int b = 0; b < totalBlocs; b++) {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_RLE);
+
+        indexTrame = decoderBlocRLE(Trame, longueur, indexTrame, DC_precedent, blocs[b]);
+        if (indexTrame < 0) {
+            return false;
+        }
+
+        JPEG_INSTR(
+            int positionEOB = 0;
+            for (int k = 63; k > 0; k--) {
+                if (blocs[b][k] != 0) { positionEOB = k; break; }
+            }
+            getInstrumentation().ajouterOctets(ETAPE_RLE, 64 * sizeof(int));
+            getInstrumentation().enregistrerBloc(positionEOB)
+        );
+    }
+    return true;
+}
+
+const double* cDecompression::facteursDequantification() {
+    if (mQualiteDequant != getQualite()) {
+        int table[8][8];
+        calculerTableQuantification(getQualite(), table);
+        for (int k = 0; k < 64; k++) {
+            mDequantZigzag[k] = table[ZIGZAG[k][0]][ZIGZAG[k][1]];
+        }
+        mQualiteDequant = getQualite();
+    }
+    return mDequantZigzag;
+}
+
+void cDecompression::decoderBloc(const int* coefficients, char** blocPixels, int taille) {
+    const double* facteurs = facteursDequantification();
+
+    // Bloc sans AC (fond uniforme) : remplissage par la moyenne, sans IDCT
+    bool sansAC = true;
+    for (int k = 1; k < 64 && sansAC; k++) {
+        sansAC = coefficients[k] == 0;
+    }
+    if (sansAC) {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_DCT);
+        Calcul_IDCT_DC(coefficients[0] * facteurs[0], blocPixels, taille);
+        return;
+    }
+
+    // Simple précision : même étape fusionnée, puis IDCT séparable en float
+    if (getPrecisionSimple() && taille == 8) {
+        float dctFloat[8][8];
+        float* floatPtrs[8];
+        for (int i = 0; i < 8; i++) {
+            floatPtrs[i] = dctFloat[i];
+        }
+        {
+            JPEG_CHRONO(getInstrumentation(), ETAPE_QUANTIFICATION);
+            float* naturel = &dctFloat[0][0];
+            for (int k = 0; k < 64; k++) {
+                naturel[ORDRE_NATUREL[k]] = static_cast<float>(coefficients[k] * facteurs[k]);
+            }
+        }
+        JPEG_CHRONO(getInstrumentation(), ETAPE_DCT);
+        Calcul_IDCT_Float(floatPtrs, blocPixels);
+        return;
+    }
+
+    double dct[8][8];
+    double* doublePtrs[8];
+    for (int i = 0; i < 8; i++) {
+        doublePtrs[i] = dct[i];
+    }
+
+    // 1. Déquantifier et remettre en ordre naturel en une passe
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_QUANTIFICATION);
+        double* naturel = &dct[0][0];
+        for (int k = 0; k < 64; k++) {
+            naturel[ORDRE_NATUREL[k]] = coefficients[k] * facteurs[k];
+        }
+    }
+
+    // 2. Appliquer l'IDCT (réduite si le bloc de sortie est plus petit)
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_DCT);
+        if (taille == 8) {
+            Calcul_IDCT(doublePtrs, blocPixels);
+        } else {
+            Calcul_IDCT_Reduite(doublePtrs, blocPixels, taille);
+        }
+    }
+
+    JPEG_INSTR(
+        getInstrumentation().ajouterOctets(ETAPE_QUANTIFICATION, sizeof(dct));
+        getInstrumentation().ajouterOctets(ETAPE_DCT, taille * taille)
+    );
+}
+
+void cDecompression::reconstruireImage(int blocs[][64], int nbBlocsX, int nbBlocsY, unsigned int echelle,
+                                       const bool* selection) {
+    unsigned char** buffer = getBuffer();
+    unsigned int largeur = getLargeur();
+    unsigned int hauteur = getHauteur();
+
+    char blocChar[8][8];
+    char* charPtrs[8];
+    for (int i = 0; i < 8; i++) {
+        charPtrs[i] = blocChar[i];
+    }
+
+    // Taille d'un bloc dans l'image de sortie
+    int taille = 8 / static_cast<int>(echelle);
+
+    // Traiter chaque bloc
+    for (int by = 0; by < nbBlocsY; by++) {
+        for (int bx = 0; bx < nbBlocsX; bx++) {
+            if (selection && !selection[by * nbBlocsX + bx]) {
+                continue;
+            }
+            decoderBloc(blocs[by * nbBlocsX + bx], charPtrs, taille);
+
+            // Convertir de -128..127 à 0..255 et écrire dans l'image
+            JPEG_CHRONO(getInstrumentation(), ETAPE_DECALAGE);
+            JPEG_INSTR(getInstrumentation().ajouterOctets(ETAPE_DECALAGE, taille * taille));
+            for (int i = 0; i < taille; i++) {
+                for (int j = 0; j < taille; j++) {
+                    unsigned int x = bx * taille + j;
+                    unsigned int y = by * taille + i;
+
+                    if (x < largeur && y < hauteur) {
+                        // Conversion et saturation
+                        int valeur = blocChar[i][j] + 128;
+                        if (valeur < 0) valeur = 0;
+                        if (valeur > 255) valeur = 255;
+                        buffer[y][x] = static_cast<unsigned char>(valeur);
+                    }
+                }
+            }
+        }
+    }
+}
+
+bool cDecompression::testerCompressionDecompression(const char* fichierEntree, int qualite) {
+    cout << "\n=== Test Compression/Décompression ===" << endl;
+    cout << "Fichier: " << fichierEntree << endl;
+    cout << "Qualité: " << qualite << "%" << endl;
+
+    // 1. Charger l'image originale
+    cCompression compresseur;
+
+    if (!compresseur.chargerImageTexte(fichierEntree, 256, 256)) {
+        cerr << "Erreur de chargement de l'image" << endl;
+        return false;
+    }
+
+    compresseur.setQualite(qualite);
+
+    // 2. Compresser
+    string nomFichierSortie = string(fichierEntree) + "_compresse_q" + to_string(qualite) + ".dat";
+    if (!compresseur.compresser(nomFichierSortie.c_str())) {
+        cerr << "Erreur de compression" << endl;
+        return false;
+    }
+
+    // 3. Décompresser
+    cDecompression decompresseur;
+    char** imageDecompressee = decompresseur.Decompression_JPEG(nomFichierSortie.c_str());
+
+    if (!imageDecompressee) {
+        cerr << "Erreur de décompression" << endl;
+        return false;
+    }
+
+    // 4. Calculer des statistiques
+    unsigned int largeur = compresseur.getLargeur();
+    unsigned int hauteur = compresseur.getHauteur();
+
+    // Récupérer l'image originale
+    unsigned char** original = compresseur.getBuffer();
+
+    // Calculer l'erreur quadratique moyenne
+    double erreurTotale = 0.0;
+    int pixels = largeur * hauteur;
+
+    for (unsigned int i = 0; i < hauteur; i++) {
+        for (unsigned int j = 0; j < largeur; j++) {
+            int diff = static_cast<int>(original[i][j]) - static_cast<int>(imageDecompressee[i][j]);
+            erreurTotale += diff * diff;
+        }
+    }
+
+    double eqm = sqrt(erreurTotale / pixels);
+    double psnr = (eqm > 0) ? 20 * log10(255.0 / eqm) : 99.99;
+
+    cout << "Resultats:" << endl;
+    cout << "  - EQM: " << eqm << endl;
+    cout << "  - PSNR: " << psnr << " dB" << endl;
+    cout << "  - Taille originale: " << pixels << " octets" << endl;
+
+    // Nettoyage
+    for (unsigned int i = 0; i < hauteur; i++) {
+        delete[] imageDecompressee[i];
+    }
+    delete[] imageDecompressee;
+
+    cout << "Test reussi!" << endl;
+    return true;
+}
+
+bool cDecompression::lireFichierCompresse(const char* nomFichier, unsigned int& largeur, unsigned int& hauteur,
+                                          unsigned int& qualite, vector<int>& trame) {
+    ifstream fichier(nomFichier, ios::binary);
+    if (!fichier) {
+        cerr << "Erreur: Impossible d'ouvrir le fichier compressé " << nomFichier << endl;
+        return false;
+    }
+    return lireFichierCompresse(fichier, nomFichier, largeur, hauteur, qualite, trame);
+}
+
+bool cDecompression::lireFichierCompresse(istream& fichier, const char* nomFichier, unsigned int& largeur,
+                                          unsigned int& hauteur, unsigned int& qualite, vector<int>& trame) {
+    JPEG_CHRONO(getInstrumentation(), ETAPE_CHARGEMENT);
+
+    int longueurTrame = 0;
+    fichier.read(reinterpret_cast<char*>(&largeur), sizeof(largeur));
+    fichier.read(reinterpret_cast<char*>(&hauteur), sizeof(hauteur));
+    fichier.read(reinterpret_cast<char*>(&qualite), sizeof(qualite));
+    fichier.read(reinterpret_cast<char*>(&longueurTrame), sizeof(longueurTrame));
+
+    if (!fichier || longueurTrame < 0) {
+        cerr << "Erreur: En-tête invalide dans " << nomFichier << endl;
+        return false;
+    }
+
+    trame.resize(longueurTrame);
+    fichier.read(reinterpret_cast<char*>(trame.data()), longueurTrame * sizeof(int));
+    if (!fichier) {
+        cerr << "Erreur: Trame tronquée dans " << nomFichier << endl;
+        return false;
+    }
+
+    JPEG_INSTR(
+        getInstrumentation().compterAllocation();
+        getInstrumentation().ajouterOctets(ETAPE_CHARGEMENT, 4 * sizeof(int) + longueurTrame * sizeof(int))
+    );
+    return true;
+}
+
+bool cDecompression::transcoder(const char* fichierEntree, const char* fichierSortie, unsigned int nouvelleQualite) {
+    if (nouvelleQualite > 100) {
+        cerr << "Erreur: Qualité invalide " << nouvelleQualite << endl;
+        return false;
+    }
+
+    // 1. Lire la trame d'origine
+    unsigned int largeur, hauteur, qualite;
+    vector<int> trame;
+    if (!lireFichierCompresse(fichierEntree, largeur, hauteur, qualite, trame)) {
+        return false;
+    }
+
+    int nbBlocsX = largeur / 8;
+    int nbBlocsY = hauteur / 8;
+    int totalBlocs = nbBlocsX * nbBlocsY;
+
+    // 2. Décoder jusqu'aux coefficients quantifiés (ordre zigzag)
+    int (*blocs)[64] = new int[totalBlocs][64];
+    JPEG_INSTR(getInstrumentation().compterAllocation());
+    if (!decoder_RLE(trame.data(), static_cast<int>(trame.size()), nbBlocsX, nbBlocsY, blocs)) {
+        cerr << "Erreur: Trame corrompue dans " << fichierEntree << endl;
+        delete[] blocs;
+        return false;
+    }
+
+    // 3. Facteurs de déquantification/requantification en ordre zigzag
+    int tableAncienne[8][8];
+    int tableNouvelle[8][8];
+    calculerTableQuantification(qualite, tableAncienne);
+    calculerTableQuantification(nouvelleQualite, tableNouvelle);
+
+    int facteurAncien[64];
+    double facteurNouveau[64];
+    for (int k = 0; k < 64; k++) {
+        facteurAncien[k] = tableAncienne[ZIGZAG[k][0]][ZIGZAG[k][1]];
+        facteurNouveau[k] = tableNouvelle[ZIGZAG[k][0]][ZIGZAG[k][1]];
+    }
+
+    // 4. Requantifier et réencoder chaque bloc
+    int* trameSortie = new int[totalBlocs * 129];
+    JPEG_INSTR(getInstrumentation().compterAllocation());
+    int longueurSortie = 0;
+    int DC_precedent = 0;
+
+    for (int b = 0; b < totalBlocs; b++) {
+        {
+            JPEG_CHRONO(getInstrumentation(), ETAPE_QUANTIFICATION);
+            for (int k = 0; k < 64; k++) {
+                if (blocs[b][k] != 0) {
+                    blocs[b][k] = static_cast<int>(round(blocs[b][k] * facteurAncien[k] / facteurNouveau[k]));
+                }
+            }
+        }
+
+        {
+            JPEG_CHRONO(getInstrumentation(), ETAPE_RLE);
+            longueurSortie += RLE_Zigzag(blocs[b], DC_precedent, trameSortie + longueurSortie);
+        }
+        DC_precedent = blocs[b][0];
+    }
+
+    // 5. Écrire le fichier avec la nouvelle qualité
+    bool ok = ecrireFichierCompresse(fichierSortie, largeur, hauteur, nouvelleQualite,
+                                     trameSortie, longueurSortie);
+
+    delete[] trameSortie;
+    delete[] blocs;
+
+    if (!ok) {
+        cerr << "Erreur: Impossible d'écrire " << fichierSortie << endl;
+        return false;
+    }
+
+    setQualite(nouvelleQualite);
+
+    cout << "Transcodage terminé: " << fichierEntree << " (qualité " << qualite << "%) -> "
+         << fichierSortie << " (qualité " << nouvelleQualite << "%)" << endl;
+
+    return true;
+}
+
+char** cDecompression::decodeRegion(const char* Nom_Fichier_compresse, unsigned int x, unsigned int y,
+                                    unsigned int w, unsigned int h) {
+    // Fichier ouvert une seule fois ; le premier entier distingue les formats
+    ifstream fichier(Nom_Fichier_compresse, ios::binary);
+    if (!fichier) {
+        cerr << "Erreur: Impossible d'ouvrir le fichier compressé " << Nom_Fichier_compresse << endl;
+        return nullptr;
+    }
+    unsigned int signature = 0;
+    fichier.read(reinterpret_cast<char*>(&signature), sizeof(signature));
+    bool tuiles = fichier && signature == SIGNATURE_TUILES;
+    fichier.clear();
+    fichier.seekg(0);
+
+    // Fichier en tuiles : seules les tuiles utiles sont lues
+    if (tuiles) {
+        return decodeRegionTuiles(fichier, Nom_Fichier_compresse, x, y, w, h);
+    }
+
+    // 1. Lire l'en-tête et la trame
+    unsigned int largeur, hauteur, qualite;
+    vector<int> trame;
+    if (!lireFichierCompresse(fichier, Nom_Fichier_compresse, largeur, hauteur, qualite, trame)) {
+        return nullptr;
+    }
+
+    // Comparaisons sans somme : x + w pourrait dépasser la capacité d'un unsigned
+    if (w == 0 || h == 0 || x >= largeur || w > largeur - x || y >= hauteur || h > hauteur - y) {
+        cerr << "Erreur: Région " << x << "," << y << " " << w << "x" << h
+             << " hors de l'image " << largeur << "x" << hauteur << endl;
+        return nullptr;
+    }
+
+    // La déquantification utilise la qualité du fichier
+    setQualite(qualite);
+
+    // 2. Allouer la région de sortie (pixels hors blocs complets à zéro)
+    char** region = new char*[h];
+    for (unsigned int i = 0; i < h; i++) {
+        region[i] = new char[w];
+        for (unsigned int j = 0; j < w; j++) {
+            region[i][j] = 0;
+        }
+    }
+    JPEG_INSTR(getInstrumentation().compterAllocation(h + 1));
+
+    // 3. Blocs qui intersectent la région
+    int nbBlocsX = largeur / 8;
+    int nbBlocsY = hauteur / 8;
+    int bx0 = x / 8;
+    int bx1 = min<int>((x + w - 1) / 8, nbBlocsX - 1);
+    int by0 = y / 8;
+    int by1 = min<int>((y + h - 1) / 8, nbBlocsY - 1);
+
+    int coefficients[64];
+    char blocChar[8][8];
+    char* charPtrs[8];
+    for (int i = 0; i < 8; i++) {
+        charPtrs[i] = blocChar[i];
+    }
+
+    int longueurTrame = static_cast<int>(trame.size());
+    int indexTrame = 0;
+    int DC_precedent = 0;
+
+    // 4. Parcourir la trame jusqu'au dernier bloc utile seulement
+    int dernierBloc = (bx1 >= bx0 && by1 >= by0) ? by1 * nbBlocsX + bx1 : -1;
+
+    for (int b = 0; b <= dernierBloc; b++) {
+        int bx = b % nbBlocsX;
+        int by = b / nbBlocsX;
+        bool dansRegion = bx >= bx0 && bx <= bx1 && by >= by0 && by <= by1;
+
+        {
+            JPEG_CHRONO(getInstrumentation(), ETAPE_RLE);
+            indexTrame = decoderBlocRLE(trame.data(), longueurTrame, indexTrame, DC_precedent,
+                                        dansRegion ? coefficients : nullptr);
+        }
+        if (indexTrame < 0) {
+            cerr << "Erreur: Trame corrompue dans " << Nom_Fichier_compresse << endl;
+            for (unsigned int i = 0; i < h; i++) {
+                delete[] region[i];
+            }
+            delete[] region;
+            return nullptr;
+        }
+
+        if (!dansRegion) {
+            continue;
+        }
+
+        decoderBloc(coefficients, charPtrs);
+
+        // Copier la partie du bloc comprise dans la région
+        JPEG_CHRONO(getInstrumentation(), ETAPE_DECALAGE);
+        for (int i = 0; i < 8; i++) {
+            unsigned int py = by * 8 + i;
+            if (py < y || py >= y + h) continue;
+
+            for (int j = 0; j < 8; j++) {
+                unsigned int px = bx * 8 + j;
+                if (px < x || px >= x + w) continue;
+
+                int valeur = blocChar[i][j] + 128;
+                if (valeur < 0) valeur = 0;
+                if (valeur > 255) valeur = 255;
+                region[py - y][px - x] = static_cast<char>(valeur);
+            }
+        }
+    }
+
+    int blocsDecodes = (dernierBloc >= 0) ? (bx1 - bx0 + 1) * (by1 - by0 + 1) : 0;
+    cout << "Décompression région: " << w << "x" << h << " en (" << x << "," << y
+         << "), blocs " << blocsDecodes << "/" << nbBlocsX * nbBlocsY << endl;
+
+    return region;
+}
+
+bool cDecompression::extrairePlanDC(const char* nomFichier, unsigned int& nbBlocsX, unsigned int& nbBlocsY,
+                                    vector<double>& planDC) {
+    unsigned int largeur, hauteur, qualite;
+    vector<int> trame;
+    if (!lireFichierCompresse(nomFichier, largeur, hauteur, qualite, trame)) {
+        return false;
+    }
+
+    nbBlocsX = largeur / 8;
+    nbBlocsY = hauteur / 8;
+    unsigned int totalBlocs = nbBlocsX * nbBlocsY;
+
+    // Seul le facteur de quantification du DC est nécessaire
+    int table[8][8];
+    calculerTableQuantification(qualite, table);
+    double facteurDC = table[0][0] / 8.0;
+
+    planDC.resize(totalBlocs);
+
+    int longueurTrame = static_cast<int>(trame.size());
+    int indexTrame = 0;
+    int DC_precedent = 0;
+
+    JPEG_CHRONO(getInstrumentation(), ETAPE_RLE);
+    for (unsigned int b = 0; b < totalBlocs; b++) {
+        // Les coefficients AC sont sautés : seule la chaîne des DC est suivie
+        indexTrame = decoderBlocRLE(trame.data(), longueurTrame, indexTrame, DC_precedent, nullptr);
+        if (indexTrame < 0) {
+            cerr << "Erreur: Trame corrompue dans " << nomFichier << endl;
+            return false;
+        }
+        planDC[b] = DC_precedent * facteurDC;
+    }
+
+    setQualite(qualite);
+    return true;
+}
+
+char** cDecompression::extraireApercuDC(const char* Nom_Fichier_compresse) {
+    unsigned int nbBlocsX, nbBlocsY;
+    vector<double> planDC;
+    if (!extrairePlanDC(Nom_Fichier_compresse, nbBlocsX, nbBlocsY, planDC)) {
+        return nullptr;
+    }
+
+    allocBuffer(nbBlocsX, nbBlocsY);
+    unsigned char** buffer = getBuffer();
+
+    char** apercu = new char*[nbBlocsY];
+    for (unsigned int i = 0; i < nbBlocsY; i++) {
+        apercu[i] = new char[nbBlocsX];
+        for (unsigned int j = 0; j < nbBlocsX; j++) {
+            int valeur = static_cast<int>(round(planDC[i * nbBlocsX + j])) + 128;
+            if (valeur < 0) valeur = 0;
+            if (valeur > 255) valeur = 255;
+            buffer[i][j] = static_cast<unsigned char>(valeur);
+            apercu[i][j] = static_cast<char>(valeur);
+        }
+    }
+    JPEG_INSTR(getInstrumentation().compterAllocation(nbBlocsY + 1));
+
+    cout << "Aperçu DC: " << nbBlocsX << "x" << nbBlocsY << endl;
+    return apercu;
+}
+
+bool cDecompression::calculerEmpreinte(const char* Nom_Fichier_compresse, unsigned long long& empreinte) {
+    unsigned int nbBlocsX, nbBlocsY;
+    vector<double> planDC;
+    if (!extrairePlanDC(Nom_Fichier_compresse, nbBlocsX, nbBlocsY, planDC)) {
+        return false;
+    }
+
+    if (nbBlocsX == 0 || nbBlocsY == 0) {
+        cerr << "Erreur: Image vide dans " << Nom_Fichier_compresse << endl;
+        return false;
+    }
+
+    // 1. Ramener le plan DC à 32x32 (moyenne des blocs couverts par chaque case)
+    const int N = 32;
+    double plan[N][N];
+    for (int i = 0; i < N; i++) {
+        unsigned int y0 = i * nbBlocsY / N;
+        unsigned int y1 = max((i + 1) * nbBlocsY / N, y0 + 1);
+        for (int j = 0; j < N; j++) {
+            unsigned int x0 = j * nbBlocsX / N;
+            unsigned int x1 = max((j + 1) * nbBlocsX / N, x0 + 1);
+
+            double somme = 0.0;
+            for (unsigned int y = y0; y < y1; y++) {
+                for (unsigned int x = x0; x < x1; x++) {
+                    somme += planDC[y * nbBlocsX + x];
+                }
+            }
+            plan[i][j] = somme / ((y1 - y0) * (x1 - x0));
+        }
+    }
+
+    // 2. DCT 32x32 limitée aux 8x8 coefficients de basse fréquence
+    //    (cosinus de la table construite à la compilation, seules les 8 premières lignes servent)
+    const double (*base)[N] = TABLE_COSINUS<N>.c;
+
+    double lignes[8][N];
+    for (int u = 0; u < 8; u++) {
+        for (int j = 0; j < N; j++) {
+            double somme = 0.0;
+            for (int i = 0; i < N; i++) {
+                somme += base[u][i] * plan[i][j];
+            }
+            lignes[u][j] = somme;
+        }
+    }
+
+    double basses[64];
+    for (int u = 0; u < 8; u++) {
+        for (int v = 0; v < 8; v++) {
+            double somme = 0.0;
+            for (int j = 0; j < N; j++) {
+                somme += lignes[u][j] * base[v][j];
+            }
+            basses[u * 8 + v] = somme;
+        }
+    }
+
+    // 3. Un bit par coefficient : supérieur à la médiane des AC
+    vector<double> tries(basses + 1, basses + 64);
+    nth_element(tries.begin(), tries.begin() + tries.size() / 2, tries.end());
+    double mediane = tries[tries.size() / 2];
+
+    empreinte = 0;
+    for (int k = 0; k < 64; k++) {
+        if (basses[k] > mediane) {
+            empreinte |= 1ULL << k;
+        }
+    }
+
+    return true;
+}
+
+int cDecompression::distanceEmpreintes(unsigned long long a, unsigned long long b) {
+    unsigned long long difference = a ^ b;
+    int distance = 0;
+    while (difference) {
+        difference &= difference - 1;
+        distance++;
+    }
+    return distance;
+}
+
+bool cDecompression::transformer(const char* fichierEntree, const char* fichierSortie,
+                                 eTransformation transformation) {
+    // 1. Décomposition : transposition éventuelle, puis symétries de l'image transposée
+    bool transposer = transformation == TRANSFORMATION_ROTATION_90 ||
+                      transformation == TRANSFORMATION_ROTATION_270 ||
+                      transformation == TRANSFORMATION_TRANSPOSITION;
+    bool inverserX = transformation == TRANSFORMATION_ROTATION_90 ||
+                     transformation == TRANSFORMATION_ROTATION_180 ||
+                     transformation == TRANSFORMATION_MIROIR_HORIZONTAL;
+    bool inverserY = transformation == TRANSFORMATION_ROTATION_180 ||
+                     transformation == TRANSFORMATION_ROTATION_270 ||
+                     transformation == TRANSFORMATION_MIROIR_VERTICAL;
+
+    // 2. Lire la trame d'origine
+    unsigned int largeur, hauteur, qualite;
+    vector<int> trame;
+    if (!lireFichierCompresse(fichierEntree, largeur, hauteur, qualite, trame)) {
+        return false;
+    }
+
+    int nbBlocsX = largeur / 8;
+    int nbBlocsY = hauteur / 8;
+    int totalBlocs = nbBlocsX * nbBlocsY;
+
+    int (*blocs)[64] = new int[totalBlocs][64];
+    JPEG_INSTR(getInstrumentation().compterAllocation());
+    if (!decoder_RLE(trame.data(), static_cast<int>(trame.size()), nbBlocsX, nbBlocsY, blocs)) {
+        cerr << "Erreur: Trame corrompue dans " << fichierEntree << endl;
+        delete[] blocs;
+        return false;
+    }
+
+    // 3. Permutation et signes des coefficients, en ordre zigzag
+    int indiceZigzag[8][8];
+    for (int k = 0; k < 64; k++) {
+        indiceZigzag[ZIGZAG[k][0]][ZIGZAG[k][1]] = k;
+    }
+
+    int source[64];
+    int signe[64];
+    for (int k = 0; k < 64; k++) {
+        int u = ZIGZAG[k][0];
+        int v = ZIGZAG[k][1];
+        source[k] = transposer ? indiceZigzag[v][u] : k;
+        signe[k] = ((inverserX && (v & 1)) != (inverserY && (u & 1))) ? -1 : 1;
+    }
+
+    // 4. Réordonner les blocs et réencoder
+    int nbBlocsXSortie = transposer ? nbBlocsY : nbBlocsX;
+    int nbBlocsYSortie = transposer ? nbBlocsX : nbBlocsY;
+
+    int* trameSortie = new int[totalBlocs * 129];
+    JPEG_INSTR(getInstrumentation().compterAllocation());
+    int longueurSortie = 0;
+    int DC_precedent = 0;
+    int coefficients[64];
+
+    for (int oby = 0; oby < nbBlocsYSortie; oby++) {
+        for (int obx = 0; obx < nbBlocsXSortie; obx++) {
+            int tbx = inverserX ? nbBlocsXSortie - 1 - obx : obx;
+            int tby = inverserY ? nbBlocsYSortie - 1 - oby : oby;
+            const int* bloc = transposer ? blocs[tbx * nbBlocsX + tby] : blocs[tby * nbBlocsX + tbx];
+
+            for (int k = 0; k < 64; k++) {
+                coefficients[k] = signe[k] * bloc[source[k]];
+            }
+
+            JPEG_CHRONO(getInstrumentation(), ETAPE_RLE);
+            longueurSortie += RLE_Zigzag(coefficients, DC_precedent, trameSortie + longueurSortie);
+            DC_precedent = coefficients[0];
+        }
+    }
+
+    // 5. Écrire le fichier (dimensions ramenées aux blocs complets)
+    unsigned int qualiteSortie = transposer ? (qualite ^ QUALITE_TABLE_TRANSPOSEE) : qualite;
+    bool ok = ecrireFichierCompresse(fichierSortie, nbBlocsXSortie * 8, nbBlocsYSortie * 8, qualiteSortie,
+                                     trameSortie, longueurSortie);
+
+    delete[] trameSortie;
+    delete[] blocs;
+
+    if (!ok) {
+        cerr << "Erreur: Impossible d'écrire " << fichierSortie << endl;
+        return false;
+    }
+
+    cout << "Transformation terminée: " << fichierEntree << " -> " << fichierSortie
+         << " (" << nbBlocsXSortie * 8 << "x" << nbBlocsYSortie * 8 << ")" << endl;
+
+    return true;
+}
+
+bool cDecompression::recadrer(const char* fichierEntree, const char* fichierSortie, unsigned int x, unsigned int y,
+                              unsigned int w, unsigned int h) {
+    if (x % 8 != 0 || y % 8 != 0 || w % 8 != 0 || h % 8 != 0 || w == 0 || h == 0) {
+        cerr << "Erreur: Rectangle " << x << "," << y << " " << w << "x" << h
+             << " non aligné sur les blocs 8x8" << endl;
+        return false;
+    }
+
+    // 1. Lire la trame d'origine
+    unsigned int largeur, hauteur, qualite;
+    vector<int> trame;
+    if (!lireFichierCompresse(fichierEntree, largeur, hauteur, qualite, trame)) {
+        return false;
+    }
+
+    int nbBlocsX = largeur / 8;
+    int nbBlocsY = hauteur / 8;
+    int bx0 = x / 8;
+    int by0 = y / 8;
+    int nbBlocsXSortie = w / 8;
+    int nbBlocsYSortie = h / 8;
+
+    if (bx0 + nbBlocsXSortie > nbBlocsX || by0 + nbBlocsYSortie > nbBlocsY) {
+        cerr << "Erreur: Rectangle " << x << "," << y << " " << w << "x" << h
+             << " hors de l'image " << largeur << "x" << hauteur << endl;
+        return false;
+    }
+
+    // 2. Parcourir la trame jusqu'au dernier bloc conservé et réencoder au fil de l'eau
+    int* trameSortie = new int[nbBlocsXSortie * nbBlocsYSortie * 129];
+    JPEG_INSTR(getInstrumentation().compterAllocation());
+    int longueurSortie = 0;
+
+    int longueurTrame = static_cast<int>(trame.size());
+    int indexTrame = 0;
+    int DC_precedent = 0;
+    int DC_precedentSortie = 0;
+    int coefficients[64];
+
+    int dernierBloc = (by0 + nbBlocsYSortie - 1) * nbBlocsX + bx0 + nbBlocsXSortie - 1;
+
+    for (int b = 0; b <= dernierBloc; b++) {
+        int bx = b % nbBlocsX;
+        int by = b / nbBlocsX;
+        bool conserve = bx >= bx0 && bx < bx0 + nbBlocsXSortie && by >= by0 && by < by0 + nbBlocsYSortie;
+
+        {
+            JPEG_CHRONO(getInstrumentation(), ETAPE_RLE);
+            indexTrame = decoderBlocRLE(trame.data(), longueurTrame, indexTrame, DC_precedent,
+                                        conserve ? coefficients : nullptr);
+        }
+        if (indexTrame < 0) {
+            cerr << "Erreur: Trame corrompue dans " << fichierEntree << endl;
+            delete[] trameSortie;
+            return false;
+        }
+
+        if (!conserve) {
+            continue;
+        }
+
+        JPEG_CHRONO(getInstrumentation(), ETAPE_RLE);
+        longueurSortie += RLE_Zigzag(coefficients, DC_precedentSortie, trameSortie + longueurSortie);
+        DC_precedentSortie = coefficients[0];
+    }
+
+    // 3. Écrire le fichier recadré
+    bool ok = ecrireFichierCompresse(fichierSortie, w, h, qualite, trameSortie, longueurSortie);
+    delete[] trameSortie;
+
+    if (!ok) {
+        cerr << "Erreur: Impossible d'écrire " << fichierSortie << endl;
+        return false;
+    }
+
+    cout << "Recadrage terminé: " << fichierEntree << " -> " << fichierSortie << " ("
+         << w << "x" << h << " en " << x << "," << y << ")" << endl;
+
+    return true;
+}
+
+bool cDecompression::decoderBandeProgressive(const int* Trame, int longueur, int debut, int fin,
+                                             int totalBlocs, int blocs[][64], bool* blocsModifies) {
+    int index = 0;
+
+    // Passe DC : chaîne des différences
+    if (debut == 0) {
+        if (longueur < totalBlocs) {
+            return false;
+        }
+        int DC_precedent = 0;
+        for (int b = 0; b < totalBlocs; b++) {
+            DC_precedent += Trame[index++];
+            blocs[b][0] = DC_precedent;
+            if (blocsModifies) {
+                blocsModifies[b] = true;
+            }
+        }
+        return true;
+    }
+
+    // Passe AC : paires (runlength, amplitude), (n, 0) termine le bloc et saute n - 1 blocs vides
+    int b = 0;
+    while (b < totalBlocs) {
+        int k = debut;
+        while (true) {
+            if (index + 1 >= longueur) {
+                return false;
+            }
+
+            int runlength = Trame[index++];
+            int amplitude = Trame[index++];
+
+            if (amplitude == 0) {
+                if (runlength < 1 || runlength > totalBlocs - b) {
+                    return false;
+                }
+                b += runlength;
+                break;
+            }
+
+            // Une position hors de la bande ne peut venir que d'une trame corrompue
+            if (runlength < 0 || runlength > fin - k) {
+                return false;
+            }
+            k += runlength;
+            blocs[b][k] = amplitude;
+            if (blocsModifies) {
+                blocsModifies[b] = true;
+            }
+            k++;
+        }
+    }
+
+    return true;
+}
+
+bool cDecompression::dimensionsProgressivesValides(unsigned int largeur, unsigned int hauteur,
+                                                   unsigned long long nbEntiers) {
+    // Au plus 129 entiers par bloc dans une passe : le nombre de blocs doit
+    // tenir dans un int même multiplié par 129
+    unsigned long long totalBlocs = static_cast<unsigned long long>(largeur / 8) * (hauteur / 8);
+    return totalBlocs > 0 && totalBlocs <= nbEntiers && totalBlocs <= INT_MAX / 129;
+}
+
+void cDecompression::remplirBlocsDC(int blocs[][64], int nbBlocsX, int nbBlocsY) {
+    JPEG_CHRONO(getInstrumentation(), ETAPE_DECALAGE);
+
+    int table[8][8];
+    calculerTableQuantification(getQualite(), table);
+    unsigned char** buffer = getBuffer();
+
+    for (int b = 0; b < nbBlocsX * nbBlocsY; b++) {
+        int valeur = static_cast<int>(round(blocs[b][0] * table[0][0] / 8.0)) + 128;
+        if (valeur < 0) valeur = 0;
+        if (valeur > 255) valeur = 255;
+
+        unsigned int x0 = (b % nbBlocsX) * 8;
+        unsigned int y0 = (b / nbBlocsX) * 8;
+        for (unsigned int i = y0; i < y0 + 8; i++) {
+            for (unsigned int j = x0; j < x0 + 8; j++) {
+                buffer[i][j] = static_cast<unsigned char>(valeur);
+            }
+        }
+    }
+}
+
+char** cDecompression::Decompression_Progressive(const char* Nom_Fichier_compresse, unsigned int nbPassesMax,
+                                                 unsigned int* nbPassesDecodees) {
+    if (nbPassesDecodees) {
+        *nbPassesDecodees = 0;
+    }
+
+    ifstream fichier(Nom_Fichier_compresse, ios::binary);
+    if (!fichier) {
+        cerr << "Erreur: Impossible d'ouvrir le fichier compressé " << Nom_Fichier_compresse << endl;
+        return nullptr;
+    }
+
+    // 1. En-tête
+    unsigned int entete[5];
+    fichier.read(reinterpret_cast<char*>(entete), sizeof(entete));
+    if (!fichier || entete[0] != SIGNATURE_PROGRESSIF) {
+        cerr << "Erreur: " << Nom_Fichier_compresse << " n'est pas un fichier progressif" << endl;
+        return nullptr;
+    }
+
+    unsigned int largeur = entete[1];
+    unsigned int hauteur = entete[2];
+    unsigned int qualite = entete[3];
+    unsigned int nbPasses = entete[4];
+    if (nbPassesMax > 0 && nbPassesMax < nbPasses) {
+        nbPasses = nbPassesMax;
+    }
+
+    // Dimensions vérifiées avant d'allouer les coefficients : la passe DC,
+    // toujours la première, compte un entier par bloc complet
+    fichier.seekg(0, ios::end);
+    unsigned long long nbEntiers = (static_cast<unsigned long long>(fichier.tellg()) - sizeof(entete)) / sizeof(int);
+    fichier.seekg(sizeof(entete));
+    if (!dimensionsProgressivesValides(largeur, hauteur, nbEntiers)) {
+        cerr << "Erreur: Dimensions " << largeur << "x" << hauteur << " incompatibles avec "
+             << Nom_Fichier_compresse << endl;
+        return nullptr;
+    }
+
+    int nbBlocsX = largeur / 8;
+    int nbBlocsY = hauteur / 8;
+    int totalBlocs = nbBlocsX * nbBlocsY;
+
+    int (*blocs)[64] = new int[totalBlocs][64];
+    for (int b = 0; b < totalBlocs; b++) {
+        for (int k = 0; k < 64; k++) {
+            blocs[b][k] = 0;
+        }
+    }
+    JPEG_INSTR(getInstrumentation().compterAllocation());
+
+    // 2. Passes complètes disponibles
+    unsigned int decodees = 0;
+    bool coefficientsAC = false;
+    vector<int> trame;
+
+    for (unsigned int p = 0; p < nbPasses; p++) {
+        unsigned int descripteur[3];
+        {
+            JPEG_CHRONO(getInstrumentation(), ETAPE_CHARGEMENT);
+            fichier.read(reinterpret_cast<char*>(descripteur), sizeof(descripteur));
+            if (!fichier || descripteur[0] > descripteur[1] || descripteur[1] > 63 ||
+                descripteur[2] > nbEntiers) {
+                break;
+            }
+
+            trame.resize(descripteur[2]);
+            fichier.read(reinterpret_cast<char*>(trame.data()), trame.size() * sizeof(int));
+            if (!fichier) {
+                break;
+            }
+        }
+
+        JPEG_CHRONO(getInstrumentation(), ETAPE_RLE);
+        if (!decoderBandeProgressive(trame.data(), static_cast<int>(trame.size()), descripteur[0],
+                                     descripteur[1], totalBlocs, blocs)) {
+            cerr << "Erreur: Passe " << p << " invalide dans " << Nom_Fichier_compresse << endl;
+            break;
+        }
+
+        decodees++;
+        coefficientsAC = coefficientsAC || descripteur[1] > 0;
+    }
+
+    if (nbPassesDecodees) {
+        *nbPassesDecodees = decodees;
+    }
+
+    if (decodees == 0) {
+        cerr << "Erreur: Aucune passe complète dans " << Nom_Fichier_compresse << endl;
+        delete[] blocs;
+        return nullptr;
+    }
+
+    // 3. Reconstruction : IDCT, ou remplissage par la moyenne si seuls les DC sont connus
+    setQualite(qualite);
+    allocBuffer(largeur, hauteur);
+
+    if (coefficientsAC) {
+        reconstruireImage(blocs, nbBlocsX, nbBlocsY);
+    } else {
+        remplirBlocsDC(blocs, nbBlocsX, nbBlocsY);
+    }
+
+    delete[] blocs;
+
+    // 4. Copie vers l'image retournée
+    JPEG_CHRONO(getInstrumentation(), ETAPE_ECRITURE);
+    JPEG_INSTR(getInstrumentation().compterAllocation(hauteur + 1));
+    unsigned char** buffer = getBuffer();
+    char** result = new char*[hauteur];
+    for (unsigned int i = 0; i < hauteur; i++) {
+        result[i] = new char[largeur];
+        for (unsigned int j = 0; j < largeur; j++) {
+            result[i][j] = static_cast<char>(buffer[i][j]);
+        }
+    }
+
+    cout << "Décompression progressive: " << decodees << "/" << entete[4] << " passes, "
+         << largeur << "x" << hauteur << " qualité " << qualite << "%" << endl;
+
+    return result;
+}
+
+bool cDecompression::lireEnteteTuiles(istream& fichier, unsigned int& largeur, unsigned int& hauteur,
+                                      unsigned int& qualite, unsigned int& tailleTuile, unsigned int& nbTuilesX,
+                                      unsigned int& nbTuilesY, vector<unsigned long long>& index) {
+    JPEG_CHRONO(getInstrumentation(), ETAPE_CHARGEMENT);
+
+    unsigned int entete[7];
+    fichier.read(reinterpret_cast<char*>(entete), sizeof(entete));
+    if (!fichier || entete[0] != SIGNATURE_TUILES || entete[4] == 0 || entete[4] % 8 != 0) {
+        cerr << "Erreur: En-tête de fichier en tuiles invalide" << endl;
+        return false;
+    }
+
+    largeur = entete[1];
+    hauteur = entete[2];
+    qualite = entete[3];
+    tailleTuile = entete[4];
+    nbTuilesX = entete[5];
+    nbTuilesY = entete[6];
+
+    unsigned int blocsParTuile = tailleTuile / 8;
+    if (nbTuilesX != (largeur / 8 + blocsParTuile - 1) / blocsParTuile ||
+        nbTuilesY != (hauteur / 8 + blocsParTuile - 1) / blocsParTuile) {
+        cerr << "Erreur: Nombre de tuiles incohérent avec les dimensions" << endl;
+        return false;
+    }
+
+    index.resize(static_cast<size_t>(nbTuilesX) * nbTuilesY + 1);
+    fichier.read(reinterpret_cast<char*>(index.data()), index.size() * sizeof(unsigned long long));
+    if (!fichier || index[0] != 0) {
+        cerr << "Erreur: Table d'index des tuiles invalide" << endl;
+        return false;
+    }
+
+    for (size_t t = 1; t < index.size(); t++) {
+        if (index[t] < index[t - 1]) {
+            cerr << "Erreur: Table d'index des tuiles invalide" << endl;
+            return false;
+        }
+    }
+
+    JPEG_INSTR(getInstrumentation().ajouterOctets(ETAPE_CHARGEMENT, sizeof(entete) + index.size() * sizeof(unsigned long long)));
+    return true;
+}
+
+bool cDecompression::decoderTrameTuile(const int* Trame, int longueur, unsigned int nbBlocsX, unsigned int nbBlocsY,
+                                       unsigned char** destination, unsigned int x0, unsigned int y0) {
+    char blocChar[8][8];
+    char* charPtrs[8];
+    for (int i = 0; i < 8; i++) {
+        charPtrs[i] = blocChar[i];
+    }
+
+    int coefficients[64];
+    int indexTrame = 0;
+    int DC_precedent = 0;
+
+    for (unsigned int by = 0; by < nbBlocsY; by++) {
+        for (unsigned int bx = 0; bx < nbBlocsX; bx++) {
+            {
+                JPEG_CHRONO(getInstrumentation(), ETAPE_RLE);
+                indexTrame = decoderBlocRLE(Trame, longueur, indexTrame, DC_precedent, coefficients);
+            }
+            if (indexTrame < 0) {
+                return false;
+            }
+
+            decoderBloc(coefficients, charPtrs);
+
+            JPEG_CHRONO(getInstrumentation(), ETAPE_DECALAGE);
+            for (int i = 0; i < 8; i++) {
+                unsigned char* ligne = destination[y0 + by * 8 + i] + x0 + bx * 8;
+                for (int j = 0; j < 8; j++) {
+                    int valeur = blocChar[i][j] + 128;
+                    if (valeur < 0) valeur = 0;
+                    if (valeur > 255) valeur = 255;
+                    ligne[j] = static_cast<unsigned char>(valeur);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+char** cDecompression::Decompression_Tuiles(const char* Nom_Fichier_compresse, unsigned int nbThreads) {
+    ifstream fichier(Nom_Fichier_compresse, ios::binary);
+    if (!fichier) {
+        cerr << "Erreur: Impossible d'ouvrir le fichier compressé " << Nom_Fichier_compresse << endl;
+        return nullptr;
+    }
+
+    // 1. En-tête, index et trame de toutes les tuiles
+    unsigned int largeur, hauteur, qualite, tailleTuile, nbTuilesX, nbTuilesY;
+    vector<unsigned long long> index;
+    if (!lireEnteteTuiles(fichier, largeur, hauteur, qualite, tailleTuile, nbTuilesX, nbTuilesY, index)) {
+        return nullptr;
+    }
+
+    // Trame projetée (partagée sans copie par tous les threads) ou lue sur le tas
+    cFichierMappe projection;
+    vector<int> trameLue;
+    const int* trame;
+    if (mLectureMappee) {
+        size_t debutTrame = static_cast<size_t>(fichier.tellg());
+        if (!projection.ouvrir(Nom_Fichier_compresse, ACCES_ALEATOIRE) ||
+            (projection.getTaille() - debutTrame) / sizeof(int) < index.back()) {
+            cerr << "Erreur: Trame tronquée dans " << Nom_Fichier_compresse << endl;
+            return nullptr;
+        }
+        trame = reinterpret_cast<const int*>(projection.getDonnees() + debutTrame);
+    } else {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_CHARGEMENT);
+        trameLue.resize(index.back());
+        fichier.read(reinterpret_cast<char*>(trameLue.data()), trameLue.size() * sizeof(int));
+        if (!fichier) {
+            cerr << "Erreur: Trame tronquée dans " << Nom_Fichier_compresse << endl;
+            return nullptr;
+        }
+        trame = trameLue.data();
+    }
+    fichier.close();
+
+    setQualite(qualite);
+    allocBuffer(largeur, hauteur);
+    unsigned char** buffer = getBuffer();
+
+    // 2. Répartition dynamique des tuiles entre les threads
+    unsigned int nbTuiles = nbTuilesX * nbTuilesY;
+    if (nbThreads == 0) {
+        nbThreads = max(1u, thread::hardware_concurrency());
+    }
+    nbThreads = max(1u, min(nbThreads, nbTuiles));
+
+    unsigned int nbBlocsX = largeur / 8;
+    unsigned int nbBlocsY = hauteur / 8;
+    unsigned int blocsParTuile = tailleTuile / 8;
+
+    // Un décodeur par thread : compteurs et tables propres à chacun
+    cDecompression* decodeurs = new cDecompression[nbThreads];
+    atomic<unsigned int> prochaineTuile(0);
+    atomic<bool> trameValide(true);
+
+    auto travail = [&](cDecompression& decodeur) {
+        decodeur.setQualite(qualite);
+        decodeur.setPrecisionSimple(getPrecisionSimple());
+        unsigned int t;
+        while ((t = prochaineTuile++) < nbTuiles) {
+            unsigned int tx = t % nbTuilesX;
+            unsigned int ty = t / nbTuilesX;
+            unsigned int bx0 = tx * blocsParTuile;
+            unsigned int by0 = ty * blocsParTuile;
+
+            if (!decodeur.decoderTrameTuile(trame + index[t], static_cast<int>(index[t + 1] - index[t]),
+                                            min(blocsParTuile, nbBlocsX - bx0), min(blocsParTuile, nbBlocsY - by0),
+                                            buffer, bx0 * 8, by0 * 8)) {
+                trameValide = false;
+            }
+        }
+    };
+
+    vector<thread> threads;
+    for (unsigned int i = 1; i < nbThreads; i++) {
+        threads.emplace_back(travail, ref(decodeurs[i]));
+    }
+    travail(decodeurs[0]);
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    for (unsigned int i = 0; i < nbThreads; i++) {
+        JPEG_INSTR(getInstrumentation().cumuler(decodeurs[i].getInstrumentation()));
+    }
+    delete[] decodeurs;
+
+    if (!trameValide) {
+        cerr << "Erreur: Trame corrompue dans " << Nom_Fichier_compresse << endl;
+        return nullptr;
+    }
+
+    // 3. Copie vers l'image retournée
+    JPEG_CHRONO(getInstrumentation(), ETAPE_ECRITURE);
+    JPEG_INSTR(getInstrumentation().compterAllocation(hauteur + 1));
+    char** result = new char*[hauteur];
+    for (unsigned int i = 0; i < hauteur; i++) {
+        result[i] = new char[largeur];
+        for (unsigned int j = 0; j < largeur; j++) {
+            result[i][j] = static_cast<char>(buffer[i][j]);
+        }
+    }
+
+    cout << "Décompression en tuiles terminée: " << largeur << "x" << hauteur << ", " << nbTuiles
+         << " tuiles sur " << nbThreads << " thread(s)" << endl;
+
+    return result;
+}
+
+char** cDecompression::decoderTuile(const char* Nom_Fichier_compresse, unsigned int tx, unsigned int ty) {
+    ifstream fichier(Nom_Fichier_compresse, ios::binary);
+    if (!fichier) {
+        cerr << "Erreur: Impossible d'ouvrir le fichier compressé " << Nom_Fichier_compresse << endl;
+        return nullptr;
+    }
+
+    unsigned int largeur, hauteur, qualite, tailleTuile, nbTuilesX, nbTuilesY;
+    vector<unsigned long long> index;
+    if (!lireEnteteTuiles(fichier, largeur, hauteur, qualite, tailleTuile, nbTuilesX, nbTuilesY, index)) {
+        return nullptr;
+    }
+
+    if (tx >= nbTuilesX || ty >= nbTuilesY) {
+        cerr << "Erreur: Tuile " << tx << "," << ty << " hors de la grille "
+             << nbTuilesX << "x" << nbTuilesY << endl;
+        return nullptr;
+    }
+
+    // 1. Lire uniquement la trame de la tuile
+    unsigned int t = ty * nbTuilesX + tx;
+    vector<int> trame(index[t + 1] - index[t]);
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_CHARGEMENT);
+        fichier.seekg(static_cast<streamoff>(index[t] * sizeof(int)), ios::cur);
+        fichier.read(reinterpret_cast<char*>(trame.data()), trame.size() * sizeof(int));
+        if (!fichier) {
+            cerr << "Erreur: Trame de la tuile tronquée dans " << Nom_Fichier_compresse << endl;
+            return nullptr;
+        }
+    }
+
+    // 2. Décoder la tuile dans le buffer (taille de la tuile)
+    unsigned int blocsParTuile = tailleTuile / 8;
+    unsigned int nbBlocsX = min(blocsParTuile, largeur / 8 - tx * blocsParTuile);
+    unsigned int nbBlocsY = min(blocsParTuile, hauteur / 8 - ty * blocsParTuile);
+
+    setQualite(qualite);
+    allocBuffer(nbBlocsX * 8, nbBlocsY * 8);
+    unsigned char** buffer = getBuffer();
+    if (!decoderTrameTuile(trame.data(), static_cast<int>(trame.size()), nbBlocsX, nbBlocsY, buffer, 0, 0)) {
+        cerr << "Erreur: Trame de la tuile corrompue dans " << Nom_Fichier_compresse << endl;
+        return nullptr;
+    }
+
+    // 3. Copie vers la tuile retournée
+    char** tuile = new char*[nbBlocsY * 8];
+    for (unsigned int i = 0; i < nbBlocsY * 8; i++) {
+        tuile[i] = new char[nbBlocsX * 8];
+        for (unsigned int j = 0; j < nbBlocsX * 8; j++) {
+            tuile[i][j] = static_cast<char>(buffer[i][j]);
+        }
+    }
+    JPEG_INSTR(getInstrumentation().compterAllocation(nbBlocsY * 8 + 1));
+
+    cout << "Décompression tuile " << tx << "," << ty << ": " << nbBlocsX * 8 << "x" << nbBlocsY * 8 << endl;
+    return tuile;
+}
+
+char** cDecompression::decodeRegionTuiles(istream& fichier, const char* Nom_Fichier_compresse, unsigned int x,
+                                          unsigned int y, unsigned int w, unsigned int h) {
+    unsigned int largeur, hauteur, qualite, tailleTuile, nbTuilesX, nbTuilesY;
+    vector<unsigned long long> index;
+    if (!lireEnteteTuiles(fichier, largeur, hauteur, qualite, tailleTuile, nbTuilesX, nbTuilesY, index)) {
+        return nullptr;
+    }
+    streamoff debutTrame = fichier.tellg();
+
+    // Comparaisons sans somme, comme decodeRegion
+    if (w == 0 || h == 0 || x >= largeur || w > largeur - x || y >= hauteur || h > hauteur - y) {
+        cerr << "Erreur: Région " << x << "," << y << " " << w << "x" << h
+             << " hors de l'image " << largeur << "x" << hauteur << endl;
+        return nullptr;
+    }
+
+    setQualite(qualite);
+
+    // 1. Région de sortie (pixels hors blocs complets à zéro)
+    char** region = new char*[h];
+    for (unsigned int i = 0; i < h; i++) {
+        region[i] = new char[w];
+        for (unsigned int j = 0; j < w; j++) {
+            region[i][j] = 0;
+        }
+    }
+    JPEG_INSTR(getInstrumentation().compterAllocation(h + 1));
+
+    // 2. Tuiles qui intersectent la région
+    unsigned int tx0 = x / tailleTuile;
+    unsigned int tx1 = min((x + w - 1) / tailleTuile, nbTuilesX - 1);
+    unsigned int ty0 = y / tailleTuile;
+    unsigned int ty1 = min((y + h - 1) / tailleTuile, nbTuilesY - 1);
+    unsigned int blocsParTuile = tailleTuile / 8;
+
+    // Tuile décodée réutilisée
+    vector<unsigned char> pixels(tailleTuile * tailleTuile);
+    vector<unsigned char*> lignes(tailleTuile);
+    for (unsigned int i = 0; i < tailleTuile; i++) {
+        lignes[i] = &pixels[i * tailleTuile];
+    }
+    vector<int> trame;
+    unsigned int tuilesDecodees = 0;
+
+    for (unsigned int ty = ty0; ty <= ty1; ty++) {
+        for (unsigned int tx = tx0; tx <= tx1; tx++) {
+            unsigned int t = ty * nbTuilesX + tx;
+            trame.resize(index[t + 1] - index[t]);
+            {
+                JPEG_CHRONO(getInstrumentation(), ETAPE_CHARGEMENT);
+                fichier.seekg(debutTrame + static_cast<streamoff>(index[t] * sizeof(int)));
+                fichier.read(reinterpret_cast<char*>(trame.data()), trame.size() * sizeof(int));
+            }
+            unsigned int nbBlocsX = min(blocsParTuile, largeur / 8 - tx * blocsParTuile);
+            unsigned int nbBlocsY = min(blocsParTuile, hauteur / 8 - ty * blocsParTuile);
+            if (!fichier ||
+                !decoderTrameTuile(trame.data(), static_cast<int>(trame.size()), nbBlocsX, nbBlocsY, lignes.data(), 0, 0)) {
+                cerr << "Erreur: Trame de la tuile " << (fichier ? "corrompue" : "tronquée") << " dans "
+                     << Nom_Fichier_compresse << endl;
+                for (unsigned int i = 0; i < h; i++) {
+                    delete[] region[i];
+                }
+                delete[] region;
+                return nullptr;
+            }
+            tuilesDecodees++;
+
+            // Copier la partie de la tuile comprise dans la région
+            unsigned int px0 = tx * tailleTuile;
+            unsigned int py0 = ty * tailleTuile;
+            for (unsigned int i = 0; i < nbBlocsY * 8; i++) {
+                unsigned int py = py0 + i;
+                if (py < y || py >= y + h) continue;
+                for (unsigned int j = 0; j < nbBlocsX * 8; j++) {
+                    unsigned int px = px0 + j;
+                    if (px < x || px >= x + w) continue;
+                    region[py - y][px - x] = static_cast<char>(lignes[i][j]);
+                }
+            }
+        }
+    }
+
+    cout << "Décompression région: " << w << "x" << h << " en (" << x << "," << y
+         << "), tuiles " << tuilesDecodees << "/" << nbTuilesX * nbTuilesY << endl;
+
+    return region;
+}
@@ -1,70 +1,385 @@
-/**
- * @file cDecompression.h
- * @brief Dclaration de la classe cDecompression pour la dcompression JPEG
- * @author EL KILI Rim
- * @date 2025
- * @version 1.0
- */
-
-#ifndef CDECOMPRESSION_H
-#define CDECOMPRESSION_H
-
-#include "cCompression.h"
-
-/**
- * @class cDecompression
- * @brief Classe pour la dcompression d'images JPEG
- *
- * Cette classe hrite de cCompression et implmente les fonctionnalits
- * de dcompression JPEG.
- */
-class cDecompression : public cCompression {
-public:
-    /**
-     * @brief Constructeur par dfaut
-     */
-    cDecompression();
-
-    /**
-     * @brief Constructeur avec paramtres
-     * @param largeur Largeur de l'image
-     * @param hauteur Hauteur de l'image
-     * @param qualite Qualit de compression
-     */
-    cDecompression(unsigned int largeur, unsigned int hauteur, unsigned int qualite = 50);
-
-    /**
-     * @brief Dcompresse une image  partir d'un fichier
-     * @param Nom_Fichier_compresse Chemin du fichier compress
-     * @return Image dcompresse
-     */
-    char** Decompression_JPEG(const char* Nom_Fichier_compresse);
-
-    /**
-     * @brief Dcode une trame RLE
-     * @param Trame Trame RLE d'entre
-     * @param longueur Longueur de la trame
-     * @param nbBlocsX Nombre de blocs en largeur
-     * @param nbBlocsY Nombre de blocs en hauteur
-     * @param blocs Tableau de sortie pour les blocs
-     */
-    void decoder_RLE(int* Trame, int longueur, int nbBlocsX, int nbBlocsY, int blocs[][64]);
-
-    /**
-     * @brief Reconstruit l'image  partir des blocs dcompresss
-     * @param blocs Blocs dcompresss
-     * @param nbBlocsX Nombre de blocs en largeur
-     * @param nbBlocsY Nombre de blocs en hauteur
-     */
-    void reconstruireImage(int blocs[][64], int nbBlocsX, int nbBlocsY);
-
-    /**
-     * @brief Teste le cycle compression/dcompression
-     * @param fichierEntree Fichier image d'entre
-     * @param qualite Qualit de compression
-     * @return true si le test est russi
-     */
-    bool testerCompressionDecompression(const char* fichierEntree, int qualite);
-};
-
-#endif // CDECOMPRESSION_H
+/**
+ * @file cDecompression.h
+ * @brief Déclaration de la classe cDecompression pour la décompression JPEG
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef CDECOMPRESSION_H
+#define CDECOMPRESSION_H
+
+#include "cCompression.h"
+#include <istream>
+
+/**
+ * @enum eTransformation
+ * @brief Transformations géométriques sans perte (voir cDecompression::transformer)
+ */
+enum eTransformation {
+    TRANSFORMATION_ROTATION_90 = 0,     ///< Rotation de 90° dans le sens horaire
+    TRANSFORMATION_ROTATION_180,        ///< Rotation de 180°
+    TRANSFORMATION_ROTATION_270,        ///< Rotation de 270° dans le sens horaire
+    TRANSFORMATION_MIROIR_HORIZONTAL,   ///< Symétrie gauche-droite
+    TRANSFORMATION_MIROIR_VERTICAL,     ///< Symétrie haut-bas
+    TRANSFORMATION_TRANSPOSITION        ///< Échange des lignes et des colonnes
+};
+
+/**
+ * @class cDecompression
+ * @brief Classe pour la décompression d'images JPEG
+ *
+ * Cette classe hérite de cCompression et implémente les fonctionnalités
+ * de décompression JPEG.
+ */
+class cDecompression : public cCompression {
+private:
+    bool mLectureMappee;            ///< Décoder depuis une projection mémoire du fichier (voir setLectureMappee)
+    double mDequantZigzag[64];      ///< Facteurs de déquantification en ordre zigzag
+    unsigned int mQualiteDequant;   ///< Qualité pour laquelle mDequantZigzag a été calculé
+
+public:
+    /**
+     * @brief Constructeur par défaut
+     */
+    cDecompression();
+
+    /**
+     * @brief Constructeur avec paramètres
+     * @param largeur Largeur de l'image
+     * @param hauteur Hauteur de l'image
+     * @param qualite Qualité de compression
+     */
+    cDecompression(unsigned int largeur, unsigned int hauteur, unsigned int qualite = 50);
+
+    /**
+     * @brief Active la lecture par projection mémoire (mmap / MapViewOfFile)
+     *
+     * Decompression_JPEG et Decompression_Tuiles décodent alors la trame
+     * directement depuis les pages du fichier, sans la copier sur le tas ;
+     * ces pages restent partagées par le cache du système entre les processus
+     * qui décodent le même fichier.
+     * @param active true pour projeter le fichier (défaut : lecture classique)
+     */
+    void setLectureMappee(bool active) { mLectureMappee = active; }
+    bool getLectureMappee() const { return mLectureMappee; }
+
+    /**
+     * @brief Décompresse une image à partir d'un fichier
+     *
+     * Avec une échelle de 2, 4 ou 8, chaque bloc est reconstruit par une IDCT
+     * réduite (4x4, 2x2 ou DC seul) : l'image produite et le buffer interne
+     * ont directement la taille réduite, donnée ensuite par getLargeur() et
+     * getHauteur().
+     * @param Nom_Fichier_compresse Chemin du fichier compressé
+     * @param echelle Facteur de réduction (1, 2, 4 ou 8, défaut=1)
+     * @return Image décompressée
+     */
+    char** Decompression_JPEG(const char* Nom_Fichier_compresse, unsigned int echelle = 1);
+
+    /**
+     * @brief Décompresse un fichier progressif (voir cCompression::compresserProgressif)
+     *
+     * Les passes sont décodées dans l'ordre jusqu'à nbPassesMax ou jusqu'à la
+     * dernière passe complète d'un fichier tronqué (réception partielle).
+     * Si seule la passe DC est disponible, chaque bloc est rempli avec sa
+     * valeur moyenne sans IDCT. Decompression_JPEG redirige vers cette
+     * fonction lorsqu'elle reconnaît la signature progressive.
+     * @param Nom_Fichier_compresse Chemin du fichier compressé
+     * @param nbPassesMax Nombre maximal de passes à décoder (0 = toutes)
+     * @param nbPassesDecodees Nombre de passes effectivement décodées (sortie, optionnelle)
+     * @return Image décompressée, nullptr si aucune passe n'est disponible
+     */
+    char** Decompression_Progressive(const char* Nom_Fichier_compresse, unsigned int nbPassesMax = 0,
+                                     unsigned int* nbPassesDecodees = nullptr);
+
+    /**
+     * @brief Décompresse un fichier en tuiles (voir cCompression::compresserTuiles)
+     *
+     * Les tuiles sont indépendantes : elles sont réparties entre plusieurs
+     * threads, chacun avec son propre décodeur, et écrites directement dans
+     * le buffer de l'image. Decompression_JPEG redirige vers cette fonction
+     * lorsqu'elle reconnaît la signature des tuiles.
+     * @param Nom_Fichier_compresse Chemin du fichier compressé
+     * @param nbThreads Nombre de threads (0 = nombre de cœurs)
+     * @return Image décompressée, nullptr si erreur
+     */
+    char** Decompression_Tuiles(const char* Nom_Fichier_compresse, unsigned int nbThreads = 0);
+
+    /**
+     * @brief Décompresse une seule tuile d'un fichier en tuiles
+     *
+     * Seuls l'en-tête, la table d'index et la trame de la tuile sont lus. Le
+     * buffer interne prend la taille de la tuile (plus petite en bord
+     * d'image), donnée ensuite par getLargeur() et getHauteur().
+     * @param Nom_Fichier_compresse Chemin du fichier compressé
+     * @param tx Colonne de la tuile
+     * @param ty Ligne de la tuile
+     * @return Tuile décompressée, nullptr si erreur
+     */
+    char** decoderTuile(const char* Nom_Fichier_compresse, unsigned int tx, unsigned int ty);
+
+    /**
+     * @brief Décode une trame RLE
+     * @param Trame Trame RLE d'entrée
+     * @param longueur Longueur de la trame
+     * @param nbBlocsX Nombre de blocs en largeur
+     * @param nbBlocsY Nombre de blocs en hauteur
+     * @param blocs Tableau de sortie pour les blocs
+     * @return false si la trame est corrompue (position hors d'un bloc)
+     */
+    bool decoder_RLE(const int* Trame, int longueur, int nbBlocsX, int nbBlocsY, int blocs[][64]);
+
+    /**
+     * @brief Reconstruit l'image à partir des blocs décompressés
+     * @param blocs Blocs décompressés
+     * @param nbBlocsX Nombre de blocs en largeur
+     * @param nbBlocsY Nombre de blocs en hauteur
+     * @param echelle Facteur de réduction (1, 2, 4 ou 8, défaut=1)
+     * @param selection Blocs à reconstruire (nullptr = tous) ; les autres pixels sont laissés tels quels
+     */
+    void reconstruireImage(int blocs[][64], int nbBlocsX, int nbBlocsY, unsigned int echelle = 1,
+                           const bool* selection = nullptr);
+
+    /**
+     * @brief Teste le cycle compression/décompression
+     * @param fichierEntree Fichier image d'entrée
+     * @param qualite Qualité de compression
+     * @return true si le test est réussi
+     */
+    bool testerCompressionDecompression(const char* fichierEntree, int qualite);
+
+    /**
+     * @brief Change la qualité d'un fichier compressé sans repasser par les pixels
+     *
+     * La trame est décodée jusqu'aux coefficients quantifiés, déquantifiés avec
+     * l'ancienne table, requantifiés avec la nouvelle puis réencodés en RLE :
+     * ni IDCT ni DCT ne sont calculées.
+     * @param fichierEntree Fichier compressé d'origine
+     * @param fichierSortie Fichier compressé produit
+     * @param nouvelleQualite Qualité de sortie (0-100)
+     * @return true si le transcodage a réussi
+     */
+    bool transcoder(const char* fichierEntree, const char* fichierSortie, unsigned int nouvelleQualite);
+
+    /**
+     * @brief Décompresse uniquement une région rectangulaire de l'image
+     *
+     * Les blocs hors de la région sont sautés dans la trame (seule la chaîne
+     * des DC est suivie) ; seuls les blocs qui intersectent la région sont
+     * déquantifiés et passent par l'IDCT. Le décodage s'arrête après le
+     * dernier bloc utile. Pour un fichier en tuiles, seules les tuiles qui
+     * intersectent la région sont lues, grâce à la table d'index.
+     * @param Nom_Fichier_compresse Chemin du fichier compressé
+     * @param x Abscisse du coin supérieur gauche
+     * @param y Ordonnée du coin supérieur gauche
+     * @param w Largeur de la région
+     * @param h Hauteur de la région
+     * @return Région décompressée (h lignes de w pixels), nullptr si erreur
+     */
+    char** decodeRegion(const char* Nom_Fichier_compresse, unsigned int x, unsigned int y,
+                        unsigned int w, unsigned int h);
+
+    /**
+     * @brief Applique une rotation ou une symétrie sans perte à un fichier compressé
+     *
+     * Les blocs sont réordonnés et leurs coefficients quantifiés transposés
+     * et/ou changés de signe ((-1)^v pour une symétrie horizontale, (-1)^u
+     * pour une symétrie verticale), puis la trame est réencodée : ni IDCT ni
+     * DCT ne sont calculées. Une transposition bascule l'indicateur
+     * QUALITE_TABLE_TRANSPOSEE de l'en-tête. Les pixels hors des blocs
+     * complets, qui ne sont pas codés, sont retirés des dimensions.
+     * @param fichierEntree Fichier compressé d'origine
+     * @param fichierSortie Fichier compressé produit
+     * @param transformation Rotation ou symétrie à appliquer
+     * @return true si la transformation a réussi
+     */
+    bool transformer(const char* fichierEntree, const char* fichierSortie, eTransformation transformation);
+
+    /**
+     * @brief Recadre sans perte un fichier compressé sur un rectangle aligné sur les blocs
+     *
+     * La trame est décodée jusqu'aux coefficients (les blocs hors du
+     * rectangle sont seulement sautés), les blocs du rectangle sont conservés
+     * tels quels et la chaîne des différences DC est recalculée avant le
+     * réencodage : aucune transformée n'est calculée.
+     * @param fichierEntree Fichier compressé d'origine
+     * @param fichierSortie Fichier compressé produit
+     * @param x Abscisse du coin supérieur gauche (multiple de 8)
+     * @param y Ordonnée du coin supérieur gauche (multiple de 8)
+     * @param w Largeur du rectangle (multiple de 8)
+     * @param h Hauteur du rectangle (multiple de 8)
+     * @return true si le recadrage a réussi
+     */
+    bool recadrer(const char* fichierEntree, const char* fichierSortie, unsigned int x, unsigned int y,
+                  unsigned int w, unsigned int h);
+
+    /**
+     * @brief Extrait l'aperçu au 1/8 formé par les seuls coefficients DC
+     *
+     * La trame est parcourue sans décoder les coefficients AC : chaque bloc
+     * donne un pixel égal à sa valeur moyenne. Le buffer interne prend la
+     * taille de l'aperçu (getLargeur() x getHauteur()).
+     * @param Nom_Fichier_compresse Chemin du fichier compressé
+     * @return Aperçu (une ligne par ligne de blocs), nullptr si erreur
+     */
+    char** extraireApercuDC(const char* Nom_Fichier_compresse);
+
+    /**
+     * @brief Calcule une empreinte perceptuelle (pHash) à partir des DC
+     *
+     * Le plan DC est ramené à 32x32, transformé par DCT ; les 64 coefficients
+     * basse fréquence (8x8) sont comparés à leur médiane pour donner un bit
+     * chacun. Deux images proches ont des empreintes à faible distance de
+     * Hamming. Aucune IDCT ni décodage des AC n'est nécessaire.
+     * @param Nom_Fichier_compresse Chemin du fichier compressé
+     * @param empreinte Empreinte sur 64 bits (sortie)
+     * @return true si le calcul a réussi
+     */
+    bool calculerEmpreinte(const char* Nom_Fichier_compresse, unsigned long long& empreinte);
+
+    /**
+     * @brief Distance de Hamming entre deux empreintes
+     * @return Nombre de bits différents (0 à 64)
+     */
+    static int distanceEmpreintes(unsigned long long a, unsigned long long b);
+
+protected:
+    /**
+     * @brief Extrait le plan des valeurs moyennes des blocs (DC déquantifié / 8)
+     * @param nomFichier Chemin du fichier compressé
+     * @param nbBlocsX Nombre de blocs en largeur (sortie)
+     * @param nbBlocsY Nombre de blocs en hauteur (sortie)
+     * @param planDC Moyenne de chaque bloc, entre -128 et 127 (sortie)
+     * @return true si la lecture a réussi
+     */
+    bool extrairePlanDC(const char* nomFichier, unsigned int& nbBlocsX, unsigned int& nbBlocsY,
+                        std::vector<double>& planDC);
+
+    /**
+     * @brief Lit l'en-tête et la trame RLE d'un fichier compressé
+     * @param nomFichier Chemin du fichier compressé
+     * @param largeur Largeur de l'image (sortie)
+     * @param hauteur Hauteur de l'image (sortie)
+     * @param qualite Qualité de compression (sortie)
+     * @param trame Trame RLE (sortie)
+     * @return true si la lecture a réussi
+     */
+    bool lireFichierCompresse(const char* nomFichier, unsigned int& largeur, unsigned int& hauteur,
+                              unsigned int& qualite, std::vector<int>& trame);
+
+    /**
+     * @brief Lit l'en-tête et la trame RLE depuis un fichier déjà ouvert (positionné au début)
+     * @param fichier Flux du fichier compressé
+     * @param nomFichier Chemin du fichier (messages d'erreur)
+     */
+    bool lireFichierCompresse(std::istream& fichier, const char* nomFichier, unsigned int& largeur,
+                              unsigned int& hauteur, unsigned int& qualite, std::vector<int>& trame);
+
+    /**
+     * @brief Décode un bloc de la trame RLE
+     * @param Trame Trame RLE
+     * @param longueur Longueur de la trame
+     * @param indexTrame Position du début du bloc dans la trame
+     * @param DC_precedent Valeur DC du bloc précédent (mise à jour)
+     * @param coefficients 64 coefficients en ordre zigzag (sortie), ou nullptr
+     *                     pour seulement sauter le bloc
+     * @return Position du bloc suivant dans la trame, ou -1 si la trame est
+     *         corrompue (run négatif ou coefficient au-delà de la position 63)
+     */
+    int decoderBlocRLE(const int* Trame, int longueur, int indexTrame,
+                       int& DC_precedent, int* coefficients);
+
+    /**
+     * @brief Décode une passe progressive dans les blocs de coefficients
+     * @param Trame Trame de la passe
+     * @param longueur Longueur de la trame
+     * @param debut Indice zigzag du premier coefficient de la bande
+     * @param fin Indice zigzag du dernier coefficient de la bande
+     * @param totalBlocs Nombre de blocs
+     * @param blocs Coefficients en ordre zigzag (complétés par la bande)
+     * @param blocsModifies Mis à true pour chaque bloc dont un coefficient est écrit (optionnel)
+     * @return true si la trame est cohérente
+     */
+    bool decoderBandeProgressive(const int* Trame, int longueur, int debut, int fin,
+                                 int totalBlocs, int blocs[][64], bool* blocsModifies = nullptr);
+
+    /**
+     * @brief Vérifie les dimensions d'un fichier progressif avant d'allouer ses coefficients
+     *
+     * La passe DC, toujours la première, compte un entier par bloc complet :
+     * le nombre de blocs est borné par les entiers disponibles.
+     * @param largeur Largeur annoncée par l'en-tête
+     * @param hauteur Hauteur annoncée par l'en-tête
+     * @param nbEntiers Entiers disponibles après l'en-tête (ou dans la passe DC)
+     * @return true si l'image a au moins un bloc et que leur nombre est plausible
+     */
+    static bool dimensionsProgressivesValides(unsigned int largeur, unsigned int hauteur,
+                                              unsigned long long nbEntiers);
+
+    /**
+     * @brief Remplit chaque bloc de l'image avec sa valeur moyenne (seuls les DC sont connus)
+     * @param blocs Coefficients en ordre zigzag (seul le DC est lu)
+     * @param nbBlocsX Nombre de blocs en largeur
+     * @param nbBlocsY Nombre de blocs en hauteur
+     */
+    void remplirBlocsDC(int blocs[][64], int nbBlocsX, int nbBlocsY);
+
+    /**
+     * @brief Lit l'en-tête et la table d'index d'un fichier en tuiles
+     * @param fichier Flux positionné au début du fichier (positionné ensuite au début de la trame)
+     * @param largeur Largeur de l'image (sortie)
+     * @param hauteur Hauteur de l'image (sortie)
+     * @param qualite Qualité de compression (sortie)
+     * @param tailleTuile Côté des tuiles en pixels (sortie)
+     * @param nbTuilesX Nombre de tuiles en largeur (sortie)
+     * @param nbTuilesY Nombre de tuiles en hauteur (sortie)
+     * @param index Position de chaque tuile dans la trame, plus la fin (sortie)
+     * @return true si la lecture a réussi
+     */
+    bool lireEnteteTuiles(std::istream& fichier, unsigned int& largeur, unsigned int& hauteur,
+                          unsigned int& qualite, unsigned int& tailleTuile, unsigned int& nbTuilesX,
+                          unsigned int& nbTuilesY, std::vector<unsigned long long>& index);
+
+    /**
+     * @brief Décode la trame d'une tuile et écrit ses pixels dans une image
+     * @param Trame Trame de la tuile
+     * @param longueur Longueur de la trame
+     * @param nbBlocsX Nombre de blocs de la tuile en largeur
+     * @param nbBlocsY Nombre de blocs de la tuile en hauteur
+     * @param destination Lignes de l'image de sortie
+     * @param x0 Abscisse du coin de la tuile dans l'image de sortie
+     * @param y0 Ordonnée du coin de la tuile dans l'image de sortie
+     * @return false si la trame est corrompue
+     */
+    bool decoderTrameTuile(const int* Trame, int longueur, unsigned int nbBlocsX, unsigned int nbBlocsY,
+                           unsigned char** destination, unsigned int x0, unsigned int y0);
+
+    /**
+     * @brief Décompresse une région d'un fichier en tuiles (voir decodeRegion)
+     * @param fichier Flux du fichier, positionné au début (signature)
+     * @param Nom_Fichier_compresse Chemin du fichier (messages d'erreur)
+     */
+    char** decodeRegionTuiles(std::istream& fichier, const char* Nom_Fichier_compresse, unsigned int x,
+                              unsigned int y, unsigned int w, unsigned int h);
+
+    /**
+     * @brief Facteurs de déquantification en ordre zigzag pour la qualité courante
+     *
+     * Recalculés seulement quand la qualité change (et non à chaque bloc).
+     */
+    const double* facteursDequantification();
+
+    /**
+     * @brief Déquantifie un bloc et applique l'IDCT
+     *
+     * Chaque coefficient est multiplié par son facteur et placé directement à
+     * sa position en ordre naturel, en une seule passe.
+     * @param coefficients 64 coefficients quantifiés du bloc, en ordre zigzag
+     * @param blocPixels Bloc de sortie taille x taille (valeurs entre -128 et 127)
+     * @param taille Taille du bloc reconstruit (8, ou 4/2/1 pour une IDCT réduite)
+     */
+    void decoderBloc(const int* coefficients, char** blocPixels, int taille = 8);
+};
+
+#endif // CDECOMPRESSION_H
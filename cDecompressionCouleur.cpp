@@ -0,0 +1,229 @@
+/**
+ * @file cDecompressionCouleur.cpp
+ * @brief Implémentation de la classe cDecompressionCouleur
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "cDecompressionCouleur.h"
+#include <fstream>
+#include <iostream>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    inline unsigned char saturer(int valeur) {
+        return static_cast<unsigned char>(valeur < 0 ? 0 : (valeur > 255 ? 255 : valeur));
+    }
+}
+
+cDecompressionCouleur::cDecompressionCouleur()
+    : cDecompression(), mSousEchantillonnage(SOUS_ECHANTILLONNAGE_420) {
+}
+
+void cDecompressionCouleur::reconstruireBloc(const int* coefficients, const int table[8][8],
+                                             unsigned char* plan, unsigned int largeurPlan,
+                                             unsigned int x, unsigned int y) {
+    double dct[8][8];
+    char blocChar[8][8];
+    double* doublePtrs[8];
+    char* charPtrs[8];
+    for (int i = 0; i < 8; i++) {
+        doublePtrs[i] = dct[i];
+        charPtrs[i] = blocChar[i];
+    }
+
+    // Bloc sans AC : remplissage par la moyenne, sans IDCT
+    bool sansAC = true;
+    for (int k = 1; k < 64 && sansAC; k++) {
+        sansAC = coefficients[k] == 0;
+    }
+    if (sansAC) {
+        {
+            JPEG_CHRONO(getInstrumentation(), ETAPE_DCT);
+            Calcul_IDCT_DC(coefficients[0] * table[0][0], charPtrs);
+        }
+        JPEG_CHRONO(getInstrumentation(), ETAPE_DECALAGE);
+        unsigned char valeur = saturer(blocChar[0][0] + 128);
+        for (int i = 0; i < 8; i++) {
+            memset(plan + (y + i) * largeurPlan + x, valeur, 8);
+        }
+        return;
+    }
+
+    // 1. Déquantification et remise en ordre naturel
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_QUANTIFICATION);
+        for (int k = 0; k < 64; k++) {
+            int u = ZIGZAG[k][0];
+            int v = ZIGZAG[k][1];
+            dct[u][v] = coefficients[k] * table[u][v];
+        }
+    }
+
+    // 2. IDCT
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_DCT);
+        Calcul_IDCT(doublePtrs, charPtrs);
+    }
+
+    // 3. Décalage de niveau vers le plan
+    JPEG_CHRONO(getInstrumentation(), ETAPE_DECALAGE);
+    for (int i = 0; i < 8; i++) {
+        unsigned char* ligne = plan + (y + i) * largeurPlan + x;
+        for (int j = 0; j < 8; j++) {
+            ligne[j] = saturer(blocChar[i][j] + 128);
+        }
+    }
+}
+
+void cDecompressionCouleur::convertirYCbCrversRGB(const unsigned char* Y, unsigned int largeurY,
+                                                  const unsigned char* Cb, const unsigned char* Cr,
+                                                  unsigned int largeurC, unsigned int largeur, unsigned int hauteur,
+                                                  eSousEchantillonnage sousEchantillonnage, unsigned char* rgb) {
+    unsigned int decalageX = cCompressionCouleur::facteurHorizontal(sousEchantillonnage) - 1;
+    unsigned int decalageY = cCompressionCouleur::facteurVertical(sousEchantillonnage) - 1;
+
+    // Coefficients JFIF inverses multipliés par 2^16
+    for (unsigned int i = 0; i < hauteur; i++) {
+        const unsigned char* ligneY = Y + i * largeurY;
+        const unsigned char* ligneCb = Cb + (i >> decalageY) * largeurC;
+        const unsigned char* ligneCr = Cr + (i >> decalageY) * largeurC;
+        unsigned char* sortie = rgb + i * largeur * 3;
+
+        for (unsigned int j = 0; j < largeur; j++) {
+            int y = ligneY[j];
+            int cb = ligneCb[j >> decalageX] - 128;
+            int cr = ligneCr[j >> decalageX] - 128;
+
+            sortie[3 * j]     = saturer(y + ((91881 * cr + 32768) >> 16));
+            sortie[3 * j + 1] = saturer(y + ((-22554 * cb - 46802 * cr + 32768) >> 16));
+            sortie[3 * j + 2] = saturer(y + ((116130 * cb + 32768) >> 16));
+        }
+    }
+}
+
+unsigned char* cDecompressionCouleur::Decompression_Couleur(const char* Nom_Fichier_compresse) {
+    // 1. Lire l'en-tête et la trame
+    unsigned int entete[6];
+    vector<int> trame;
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_CHARGEMENT);
+
+        ifstream fichier(Nom_Fichier_compresse, ios::binary);
+        if (!fichier) {
+            cerr << "Erreur: Impossible d'ouvrir le fichier compressé " << Nom_Fichier_compresse << endl;
+            return nullptr;
+        }
+
+        fichier.read(reinterpret_cast<char*>(entete), sizeof(entete));
+        if (!fichier || entete[0] != cCompressionCouleur::SIGNATURE_COULEUR ||
+            entete[4] > SOUS_ECHANTILLONNAGE_420) {
+            cerr << "Erreur: " << Nom_Fichier_compresse << " n'est pas un fichier couleur" << endl;
+            return nullptr;
+        }
+
+        trame.resize(entete[5]);
+        fichier.read(reinterpret_cast<char*>(trame.data()), trame.size() * sizeof(int));
+        if (!fichier) {
+            cerr << "Erreur: Trame tronquée dans " << Nom_Fichier_compresse << endl;
+            return nullptr;
+        }
+    }
+
+    unsigned int largeur = entete[1];
+    unsigned int hauteur = entete[2];
+    unsigned int qualite = entete[3];
+    mSousEchantillonnage = static_cast<eSousEchantillonnage>(entete[4]);
+
+    // Pas de buffer en niveaux de gris : l'ancien (Decompression_JPEG sur le
+    // même objet) est libéré avant de changer les dimensions
+    libererBuffer();
+    setLargeur(largeur);
+    setHauteur(hauteur);
+    setQualite(qualite);
+
+    // 2. Géométrie des MCU et des plans
+    unsigned int fh = cCompressionCouleur::facteurHorizontal(mSousEchantillonnage);
+    unsigned int fv = cCompressionCouleur::facteurVertical(mSousEchantillonnage);
+    unsigned int nbMCUX = (largeur + 8 * fh - 1) / (8 * fh);
+    unsigned int nbMCUY = (hauteur + 8 * fv - 1) / (8 * fv);
+    unsigned int largeurY = nbMCUX * 8 * fh;
+    unsigned int largeurC = nbMCUX * 8;
+
+    vector<unsigned char> planY(largeurY * nbMCUY * 8 * fv);
+    vector<unsigned char> planCb(largeurC * nbMCUY * 8);
+    vector<unsigned char> planCr(largeurC * nbMCUY * 8);
+
+    int tableY[8][8];
+    int tableC[8][8];
+    calculerTableQuantification(qualite, tableY);
+    calculerTableQuantification(qualite, tableC, true);
+
+    // 3. Décoder les MCU entrelacées
+    int longueurTrame = static_cast<int>(trame.size());
+    int indexTrame = 0;
+    int DC_Y = 0, DC_Cb = 0, DC_Cr = 0;
+    int coefficients[64];
+    auto lireBloc = [&](int& DC_precedent) {
+        indexTrame = decoderBlocRLE(trame.data(), longueurTrame, indexTrame, DC_precedent, coefficients);
+        return indexTrame >= 0;
+    };
+
+    for (unsigned int my = 0; my < nbMCUY; my++) {
+        for (unsigned int mx = 0; mx < nbMCUX; mx++) {
+            for (unsigned int by = 0; by < fv; by++) {
+                for (unsigned int bx = 0; bx < fh; bx++) {
+                    if (!lireBloc(DC_Y)) {
+                        cerr << "Erreur: Trame corrompue dans " << Nom_Fichier_compresse << endl;
+                        return nullptr;
+                    }
+                    reconstruireBloc(coefficients, tableY, planY.data(), largeurY,
+                                     (mx * fh + bx) * 8, (my * fv + by) * 8);
+                }
+            }
+            if (!lireBloc(DC_Cb)) {
+                cerr << "Erreur: Trame corrompue dans " << Nom_Fichier_compresse << endl;
+                return nullptr;
+            }
+            reconstruireBloc(coefficients, tableC, planCb.data(), largeurC, mx * 8, my * 8);
+            if (!lireBloc(DC_Cr)) {
+                cerr << "Erreur: Trame corrompue dans " << Nom_Fichier_compresse << endl;
+                return nullptr;
+            }
+            reconstruireBloc(coefficients, tableC, planCr.data(), largeurC, mx * 8, my * 8);
+        }
+    }
+
+    // 4. Suréchantillonnage et conversion en RGB
+    unsigned char* rgb = new unsigned char[largeur * hauteur * 3];
+    {
+        JPEG_CHRONO(getInstrumentation(), ETAPE_ECRITURE);
+        convertirYCbCrversRGB(planY.data(), largeurY, planCb.data(), planCr.data(), largeurC,
+                              largeur, hauteur, mSousEchantillonnage, rgb);
+    }
+    JPEG_INSTR(
+        getInstrumentation().compterAllocation(4);
+        getInstrumentation().ajouterOctets(ETAPE_ECRITURE, largeur * hauteur * 3)
+    );
+
+    cout << "Décompression couleur terminée: " << largeur << "x" << hauteur
+         << " qualité " << qualite << "%" << endl;
+
+    return rgb;
+}
+
+bool cDecompressionCouleur::ecrireImagePPM(const char* nomFichier, const unsigned char* rgb,
+                                           unsigned int largeur, unsigned int hauteur) {
+    ofstream fichier(nomFichier, ios::binary);
+    if (!fichier || !rgb) {
+        return false;
+    }
+
+    fichier << "P6\n" << largeur << " " << hauteur << "\n255\n";
+    fichier.write(reinterpret_cast<const char*>(rgb), largeur * hauteur * 3);
+    return fichier.good();
+}
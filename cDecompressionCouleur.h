@@ -0,0 +1,89 @@
+/**
+ * @file cDecompressionCouleur.h
+ * @brief Déclaration de la classe cDecompressionCouleur
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef CDECOMPRESSIONCOULEUR_H
+#define CDECOMPRESSIONCOULEUR_H
+
+#include "cDecompression.h"
+#include "cCompressionCouleur.h"
+
+/**
+ * @class cDecompressionCouleur
+ * @brief Décompression des fichiers produits par cCompressionCouleur
+ *
+ * Les plans Y, Cb et Cr sont reconstruits bloc par bloc, puis une seule
+ * passe réalise à la fois le suréchantillonnage de la chrominance et la
+ * conversion YCbCr -> RGB, sans plan de chrominance intermédiaire à pleine
+ * résolution.
+ */
+class cDecompressionCouleur : public cDecompression {
+private:
+    eSousEchantillonnage mSousEchantillonnage;  ///< Sous-échantillonnage du dernier fichier décodé
+
+public:
+    /**
+     * @brief Constructeur par défaut
+     */
+    cDecompressionCouleur();
+
+    /**
+     * @brief Décompresse un fichier couleur
+     *
+     * Les dimensions de l'image sont ensuite données par getLargeur() et
+     * getHauteur().
+     * @param Nom_Fichier_compresse Chemin du fichier compressé
+     * @return Pixels RGB entrelacés (à libérer avec delete[]), nullptr si erreur
+     */
+    unsigned char* Decompression_Couleur(const char* Nom_Fichier_compresse);
+
+    eSousEchantillonnage getSousEchantillonnage() const { return mSousEchantillonnage; }
+
+    /**
+     * @brief Suréchantillonne la chrominance et convertit en RGB en une passe
+     * @param Y Plan de luminance (lignes de largeurY octets)
+     * @param largeurY Largeur du plan de luminance
+     * @param Cb Plan Cb sous-échantillonné (lignes de largeurC octets)
+     * @param Cr Plan Cr sous-échantillonné
+     * @param largeurC Largeur des plans de chrominance
+     * @param largeur Largeur de l'image
+     * @param hauteur Hauteur de l'image
+     * @param sousEchantillonnage Sous-échantillonnage des plans Cb et Cr
+     * @param rgb Pixels RGB entrelacés (sortie, largeur x hauteur x 3)
+     */
+    static void convertirYCbCrversRGB(const unsigned char* Y, unsigned int largeurY,
+                                      const unsigned char* Cb, const unsigned char* Cr, unsigned int largeurC,
+                                      unsigned int largeur, unsigned int hauteur,
+                                      eSousEchantillonnage sousEchantillonnage, unsigned char* rgb);
+
+    /**
+     * @brief Écrit une image RGB au format PPM binaire (P6)
+     * @param nomFichier Chemin du fichier de sortie
+     * @param rgb Pixels RGB entrelacés
+     * @param largeur Largeur de l'image
+     * @param hauteur Hauteur de l'image
+     * @return true si l'écriture a réussi
+     */
+    static bool ecrireImagePPM(const char* nomFichier, const unsigned char* rgb,
+                               unsigned int largeur, unsigned int hauteur);
+
+private:
+    /**
+     * @brief Déquantifie un bloc (coefficients en ordre zigzag), applique l'IDCT
+     *        et l'écrit dans un plan
+     * @param coefficients 64 coefficients quantifiés en ordre zigzag
+     * @param table Table de quantification de la composante
+     * @param plan Plan de sortie (lignes de largeurPlan octets)
+     * @param largeurPlan Largeur du plan
+     * @param x Position X du bloc
+     * @param y Position Y du bloc
+     */
+    void reconstruireBloc(const int* coefficients, const int table[8][8],
+                          unsigned char* plan, unsigned int largeurPlan, unsigned int x, unsigned int y);
+};
+
+#endif // CDECOMPRESSIONCOULEUR_H
@@ -0,0 +1,122 @@
+/**
+ * @file cFichierMappe.cpp
+ * @brief Implémentation de la classe cFichierMappe
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "cFichierMappe.h"
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+cFichierMappe::cFichierMappe()
+    : mDonnees(nullptr), mTaille(0), mMappe(false)
+#ifdef _WIN32
+    , mFichier(nullptr), mProjection(nullptr)
+#endif
+{
+}
+
+cFichierMappe::~cFichierMappe() {
+    fermer();
+}
+
+bool cFichierMappe::ouvrir(const char* nomFichier, eAccesFichier acces) {
+    fermer();
+
+#ifdef _WIN32
+    (void)acces;
+    HANDLE fichier = CreateFileA(nomFichier, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fichier != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER taille;
+        if (GetFileSizeEx(fichier, &taille) && taille.QuadPart > 0) {
+            HANDLE projection = CreateFileMappingA(fichier, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (projection) {
+                void* vue = MapViewOfFile(projection, FILE_MAP_READ, 0, 0, 0);
+                if (vue) {
+                    mFichier = fichier;
+                    mProjection = projection;
+                    mDonnees = static_cast<const unsigned char*>(vue);
+                    mTaille = static_cast<size_t>(taille.QuadPart);
+                    mMappe = true;
+                    return true;
+                }
+                CloseHandle(projection);
+            }
+        }
+        CloseHandle(fichier);
+    }
+#else
+    int descripteur = open(nomFichier, O_RDONLY);
+    if (descripteur >= 0) {
+        struct stat informations;
+        if (fstat(descripteur, &informations) == 0 && informations.st_size > 0) {
+            void* vue = mmap(nullptr, static_cast<size_t>(informations.st_size), PROT_READ, MAP_SHARED, descripteur, 0);
+            if (vue != MAP_FAILED) {
+                // Lecture anticipée agressive seulement pour une trame lue d'un bout à
+                // l'autre ; les tuiles et régions sont lues par morceaux, en parallèle
+                if (acces == ACCES_SEQUENTIEL) {
+                    madvise(vue, static_cast<size_t>(informations.st_size), MADV_SEQUENTIAL);
+                }
+                mDonnees = static_cast<const unsigned char*>(vue);
+                mTaille = static_cast<size_t>(informations.st_size);
+                mMappe = true;
+            }
+        }
+        // La projection reste valide après la fermeture du descripteur
+        close(descripteur);
+        if (mMappe) {
+            return true;
+        }
+    }
+#endif
+
+    // Repli : lecture complète dans un tampon
+    ifstream fichier(nomFichier, ios::binary | ios::ate);
+    if (!fichier) {
+        return false;
+    }
+
+    mCopie.resize(static_cast<size_t>(fichier.tellg()));
+    fichier.seekg(0);
+    fichier.read(reinterpret_cast<char*>(mCopie.data()), mCopie.size());
+    if (!fichier) {
+        mCopie.clear();
+        return false;
+    }
+
+    mDonnees = mCopie.data();
+    mTaille = mCopie.size();
+    return true;
+}
+
+void cFichierMappe::fermer() {
+    if (mMappe) {
+#ifdef _WIN32
+        UnmapViewOfFile(mDonnees);
+        CloseHandle(static_cast<HANDLE>(mProjection));
+        CloseHandle(static_cast<HANDLE>(mFichier));
+        mProjection = nullptr;
+        mFichier = nullptr;
+#else
+        munmap(const_cast<unsigned char*>(mDonnees), mTaille);
+#endif
+    }
+
+    mCopie.clear();
+    mDonnees = nullptr;
+    mTaille = 0;
+    mMappe = false;
+}
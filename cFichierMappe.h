@@ -0,0 +1,85 @@
+/**
+ * @file cFichierMappe.h
+ * @brief Déclaration de la classe cFichierMappe (projection d'un fichier en mémoire)
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef CFICHIERMAPPE_H
+#define CFICHIERMAPPE_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @enum eAccesFichier
+ * @brief Façon dont le contenu projeté sera parcouru (conseil donné au noyau)
+ */
+enum eAccesFichier {
+    ACCES_SEQUENTIEL = 0,   ///< Lu une seule fois du début à la fin : lecture anticipée agressive
+    ACCES_ALEATOIRE         ///< Lu par morceaux, dans le désordre ou par plusieurs threads (tuiles, régions)
+};
+
+/**
+ * @class cFichierMappe
+ * @brief Fichier en lecture seule projeté en mémoire
+ *
+ * Utilise mmap (POSIX) ou MapViewOfFile (Windows) : les pages sont lues à
+ * la demande et partagées, via le cache du système, entre les processus qui
+ * ouvrent le même fichier. Si la projection est impossible, le fichier est
+ * lu dans un tampon sur le tas et l'interface reste la même.
+ */
+class cFichierMappe {
+private:
+    const unsigned char* mDonnees;      ///< Début du fichier en mémoire
+    size_t mTaille;                     ///< Taille du fichier en octets
+    bool mMappe;                        ///< true si mDonnees est une projection
+    std::vector<unsigned char> mCopie;  ///< Tampon de repli si la projection échoue
+#ifdef _WIN32
+    void* mFichier;                     ///< HANDLE du fichier
+    void* mProjection;                  ///< HANDLE de la projection
+#endif
+
+public:
+    /**
+     * @brief Constructeur (aucun fichier ouvert)
+     */
+    cFichierMappe();
+
+    /**
+     * @brief Destructeur (libère la projection)
+     */
+    ~cFichierMappe();
+
+    // Non copiable : la projection appartient à une seule instance
+    cFichierMappe(const cFichierMappe&) = delete;
+    cFichierMappe& operator=(const cFichierMappe&) = delete;
+
+    /**
+     * @brief Projette un fichier en mémoire (ou le copie si la projection échoue)
+     *
+     * Sous POSIX, le mode d'accès choisit le conseil madvise : MADV_SEQUENTIAL
+     * pour une lecture unique du début à la fin, aucun conseil (lecture
+     * anticipée par défaut du noyau) sinon. Il est sans effet sous Windows.
+     * @param nomFichier Chemin du fichier
+     * @param acces Façon dont le contenu sera parcouru
+     * @return true si le contenu est accessible
+     */
+    bool ouvrir(const char* nomFichier, eAccesFichier acces = ACCES_SEQUENTIEL);
+
+    /**
+     * @brief Libère la projection ou le tampon
+     */
+    void fermer();
+
+    const unsigned char* getDonnees() const { return mDonnees; }
+    size_t getTaille() const { return mTaille; }
+
+    /**
+     * @brief Indique si le contenu est une projection (et non une copie)
+     */
+    bool estMappe() const { return mMappe; }
+};
+
+#endif // CFICHIERMAPPE_H
@@ -1,187 +1,544 @@
-/**
- * @file cHuffman.cpp
- * @brief Implmentation de la classe cHuffman
- * @author EL KILI Rim
- * @date 2025
- * @version 1.0
- */
-
-#include "cHuffman.h"
-#include <iostream>
-#include <iomanip>
-#include <algorithm>
-
-using namespace std;
-
-// ========== CONSTRUCTEURS ET DESTRUCTEUR ==========
-
-cHuffman::cHuffman()
-    : mRacine(nullptr), mTrame(nullptr), mLongueur(0) {
-}
-
-cHuffman::cHuffman(char* trame, unsigned int longueur)
-    : mTrame(trame), mLongueur(longueur), mRacine(nullptr) {
-}
-
-cHuffman::~cHuffman() {
-    supprimerArbre(mRacine);
-}
-
-// ========== ACCESS ET MUTATEURS ==========
-
-sNoeud* cHuffman::getRacine() const { return mRacine; }
-char* cHuffman::getTrame() const { return mTrame; }
-unsigned int cHuffman::getLongueur() const { return mLongueur; }
-
-// ========== FONCTIONS HUFFMAN ==========
-
-void cHuffman::HuffmanCodes(char* donnees, double* frequences, unsigned int taille) {
-    // Crer une file de priorit min
-    priority_queue<sNoeud*, vector<sNoeud*>, compare> file;
-
-    // Crer les nuds initiaux
-    for (unsigned int i = 0; i < taille; i++) {
-        file.push(new sNoeud(donnees[i], frequences[i]));
-    }
-
-    // Construire l'arbre de Huffman
-    while (file.size() > 1) {
-        // Extraire les deux nuds avec les plus petites frquences
-        sNoeud* gauche = file.top();
-        file.pop();
-
-        sNoeud* droit = file.top();
-        file.pop();
-
-        // Crer un nouveau nud interne
-        double sommeFreq = gauche->mfreq + droit->mfreq;
-        sNoeud* nouveau = new sNoeud(sommeFreq, gauche, droit);
-
-        // Ajouter le nouveau nud  la file
-        file.push(nouveau);
-    }
-
-    // La racine est le dernier nud
-    if (!file.empty()) {
-        mRacine = file.top();
-        file.pop();
-    }
-
-    // Gnrer les codes
-    genererCodes(mRacine, "");
-}
-
-void cHuffman::genererCodes(sNoeud* racine, std::string code) {
-    if (!racine) return;
-
-    // Si c'est une feuille, stocker le code
-    if (!racine->mgauche && !racine->mdroit) {
-        if (racine->mdonnee != 0) {
-            mCodes[racine->mdonnee] = code;
-        }
-    } else {
-        // Parcours rcursif
-        genererCodes(racine->mgauche, code + "0");
-        genererCodes(racine->mdroit, code + "1");
-    }
-}
-
-void cHuffman::AfficherHuffman(sNoeud* racine) {
-    if (!racine) racine = mRacine;
-    if (!racine) return;
-
-    cout << "Codes Huffman:" << endl;
-    cout << "==============" << endl;
-
-    for (const auto& paire : mCodes) {
-        cout << "  '" << paire.first << "' : " << paire.second << endl;
-    }
-    cout << endl;
-}
-
-unsigned int cHuffman::Histogramme(char* trame, unsigned int longueur,
-                                   char* donnees, double* frequences) {
-    if (!trame || longueur == 0) return 0;
-
-    // Compter les occurrences
-    map<char, int> comptage;
-    for (unsigned int i = 0; i < longueur; i++) {
-        comptage[trame[i]]++;
-    }
-
-    // Copier dans les tableaux de sortie
-    unsigned int index = 0;
-    for (const auto& paire : comptage) {
-        donnees[index] = paire.first;
-        frequences[index] = static_cast<double>(paire.second) / longueur;
-        index++;
-    }
-
-    return index;
-}
-
-unsigned int cHuffman::encoder(char* trameEntree, unsigned int longueur,
-                               vector<bool>& trameSortie) {
-    if (!trameEntree || longueur == 0 || mCodes.empty()) return 0;
-
-    trameSortie.clear();
-
-    // Pour chaque caractre, ajouter son code
-    for (unsigned int i = 0; i < longueur; i++) {
-        char c = trameEntree[i];
-        auto it = mCodes.find(c);
-        if (it != mCodes.end()) {
-            const string& code = it->second;
-            for (char bit : code) {
-                trameSortie.push_back(bit == '1');
-            }
-        }
-    }
-
-    return trameSortie.size();
-}
-
-unsigned int cHuffman::decoder(vector<bool>& trameEntree, unsigned int longueurBits,
-                               char* trameSortie) {
-    if (!mRacine || trameEntree.empty()) return 0;
-
-    unsigned int indexSortie = 0;
-    sNoeud* courant = mRacine;
-
-    for (unsigned int i = 0; i < longueurBits; i++) {
-        // Suivre le chemin dans l'arbre
-        if (trameEntree[i]) {
-            courant = courant->mdroit;
-        } else {
-            courant = courant->mgauche;
-        }
-
-        // Si on arrive  une feuille
-        if (!courant->mgauche && !courant->mdroit) {
-            trameSortie[indexSortie++] = courant->mdonnee;
-            courant = mRacine; // Retour  la racine
-        }
-    }
-
-    return indexSortie;
-}
-
-// ========== FONCTIONS AUXILIAIRES ==========
-
-void cHuffman::supprimerArbre(sNoeud* noeud) {
-    if (!noeud) return;
-
-    supprimerArbre(noeud->mgauche);
-    supprimerArbre(noeud->mdroit);
-    delete noeud;
-}
-
-sNoeud* cHuffman::copierArbre(sNoeud* original) {
-    if (!original) return nullptr;
-
-    sNoeud* copie = new sNoeud(original->mdonnee, original->mfreq);
-    copie->mgauche = copierArbre(original->mgauche);
-    copie->mdroit = copierArbre(original->mdroit);
-
-    return copie;
-}
+/**
+ * @file cHuffman.cpp
+ * @brief Implémentation de la classe cHuffman
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "cHuffman.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+/**
+ * @brief Écriture de codes dans des mots de 64 bits, bit de poids fort en premier
+ */
+struct sEcrivainBits {
+    vector<uint64_t>& mots;
+    uint64_t courant;
+    int libres;  // bits encore libres dans courant
+
+    explicit sEcrivainBits(vector<uint64_t>& m) : mots(m), courant(0), libres(64) {}
+
+    void ajouter(uint64_t code, int longueur) {
+        if (longueur < libres) {
+            courant |= code << (libres - longueur);
+            libres -= longueur;
+        } else {
+            int reste = longueur - libres;
+            mots.push_back(courant | (code >> reste));
+            courant = reste ? code << (64 - reste) : 0;
+            libres = 64 - reste;
+        }
+    }
+
+    /** @return Nombre total de bits écrits */
+    uint64_t terminer() {
+        uint64_t nbBits = static_cast<uint64_t>(mots.size()) * 64 + (64 - libres);
+        if (libres < 64) {
+            mots.push_back(courant);
+        }
+        return nbBits;
+    }
+};
+
+} // namespace
+
+// ========== CONSTRUCTEURS ET DESTRUCTEUR ==========
+
+cHuffman::cHuffman()
+    : mRacine(nullptr), mTrame(nullptr), mLongueur(0), mSymbolesCorriges(0) {
+}
+
+cHuffman::cHuffman(char* trame, unsigned int longueur)
+    : mTrame(trame), mLongueur(longueur), mRacine(nullptr), mSymbolesCorriges(0) {
+}
+
+cHuffman::~cHuffman() {
+    supprimerArbre(mRacine);
+}
+
+// ========== ACCESS ET MUTATEURS ==========
+
+sNoeud* cHuffman::getRacine() const { return mRacine; }
+char* cHuffman::getTrame() const { return mTrame; }
+unsigned int cHuffman::getLongueur() const { return mLongueur; }
+
+// ========== FONCTIONS HUFFMAN ==========
+
+void cHuffman::HuffmanCodes(char* donnees, double* frequences, unsigned int taille) {
+    // Créer une file de priorité min
+    priority_queue<sNoeud*, vector<sNoeud*>, compare> file;
+
+    // Créer les nœuds initiaux
+    for (unsigned int i = 0; i < taille; i++) {
+        file.push(new sNoeud(donnees[i], frequences[i]));
+    }
+
+    // Construire l'arbre de Huffman
+    while (file.size() > 1) {
+        // Extraire les deux nœuds avec les plus petites fréquences
+        sNoeud* gauche = file.top();
+        file.pop();
+
+        sNoeud* droit = file.top();
+        file.pop();
+
+        // Créer un nouveau nœud interne
+        double sommeFreq = gauche->mfreq + droit->mfreq;
+        sNoeud* nouveau = new sNoeud(sommeFreq, gauche, droit);
+
+        // Ajouter le nouveau nœud à la file
+        file.push(nouveau);
+    }
+
+    // La racine est le dernier nœud
+    if (!file.empty()) {
+        mRacine = file.top();
+        file.pop();
+    }
+
+    // Générer les codes et la table de décodage
+    genererCodes(mRacine, "");
+    construireTableDecodage();
+}
+
+void cHuffman::genererCodes(sNoeud* racine, std::string code) {
+    if (!racine) return;
+
+    // Si c'est une feuille, stocker le code
+    if (!racine->mgauche && !racine->mdroit) {
+        if (racine->mdonnee != 0) {
+            mCodes[racine->mdonnee] = code;
+        }
+    } else {
+        // Parcours récursif
+        genererCodes(racine->mgauche, code + "0");
+        genererCodes(racine->mdroit, code + "1");
+    }
+}
+
+void cHuffman::AfficherHuffman(sNoeud* racine) {
+    if (!racine) racine = mRacine;
+    if (!racine) return;
+
+    cout << "Codes Huffman:" << endl;
+    cout << "==============" << endl;
+
+    for (const auto& paire : mCodes) {
+        cout << "  '" << paire.first << "' : " << paire.second << endl;
+    }
+    cout << endl;
+}
+
+unsigned int cHuffman::Histogramme(char* trame, unsigned int longueur,
+                                   char* donnees, double* frequences) {
+    if (!trame || longueur == 0) return 0;
+
+    // Compter les occurrences
+    map<char, int> comptage;
+    for (unsigned int i = 0; i < longueur; i++) {
+        comptage[trame[i]]++;
+    }
+
+    // Copier dans les tableaux de sortie
+    unsigned int index = 0;
+    for (const auto& paire : comptage) {
+        donnees[index] = paire.first;
+        frequences[index] = static_cast<double>(paire.second) / longueur;
+        index++;
+    }
+
+    return index;
+}
+
+unsigned int cHuffman::encoder(char* trameEntree, unsigned int longueur,
+                               vector<bool>& trameSortie) {
+    if (!trameEntree || longueur == 0 || mCodes.empty()) return 0;
+
+    trameSortie.clear();
+
+    // Pour chaque caractère, ajouter son code
+    for (unsigned int i = 0; i < longueur; i++) {
+        char c = trameEntree[i];
+        auto it = mCodes.find(c);
+        if (it != mCodes.end()) {
+            const string& code = it->second;
+            for (char bit : code) {
+                trameSortie.push_back(bit == '1');
+            }
+        }
+    }
+
+    return trameSortie.size();
+}
+
+unsigned int cHuffman::decoder(vector<bool>& trameEntree, unsigned int longueurBits,
+                               char* trameSortie) {
+    if (!mRacine || trameEntree.empty()) return 0;
+
+    // Regroupement en mots de 64 bits pour la table de décodage
+    // (sans branchement : les bits sont imprévisibles)
+    longueurBits = static_cast<unsigned int>(min<size_t>(longueurBits, trameEntree.size()));
+    vector<uint64_t> mots((longueurBits + 63) / 64, 0);
+    vector<bool>::const_iterator bit = trameEntree.begin();
+    for (unsigned int i = 0; i < longueurBits; i += 64) {
+        unsigned int n = min(64u, longueurBits - i);
+        uint64_t mot = 0;
+        for (unsigned int j = 0; j < n; j++, ++bit) {
+            mot = (mot << 1) | static_cast<uint64_t>(*bit);
+        }
+        mots[i / 64] = mot << (64 - n);
+    }
+
+    return decoder(mots, longueurBits, trameSortie);
+}
+
+unsigned int cHuffman::decoder(const vector<uint64_t>& mots, unsigned int longueurBits,
+                               char* trameSortie) {
+    // Un arbre réduit à une feuille n'a aucun code
+    if (!mRacine || !mRacine->mgauche || mots.empty()) return 0;
+    longueurBits = static_cast<unsigned int>(min<uint64_t>(longueurBits, mots.size() * 64));
+
+    const sEntreeDecodage* table = mTableDecodage.data();
+    unsigned int indexSortie = 0;
+    unsigned int position = 0;
+
+    auto lireBit = [&](unsigned int i) {
+        return ((mots[i / 64] >> (63 - i % 64)) & 1) != 0;
+    };
+
+    // 1. Fenêtres complètes : plusieurs symboles par consultation
+    while (position + FENETRE_DECODAGE <= longueurBits) {
+        size_t i = position / 64;
+        int decalage = position % 64;
+        uint64_t fenetre = mots[i] << decalage;
+        if (decalage && i + 1 < mots.size()) {
+            fenetre |= mots[i + 1] >> (64 - decalage);
+        }
+
+        const sEntreeDecodage& entree = table[fenetre >> (64 - FENETRE_DECODAGE)];
+        if (entree.nbSymboles) {
+            for (int k = 0; k < entree.nbSymboles; k++) {
+                trameSortie[indexSortie++] = entree.symboles[k];
+            }
+            position += entree.nbBits[entree.nbSymboles - 1];
+        } else {
+            // Code plus long que la fenêtre : parcours de l'arbre
+            sNoeud* courant = mRacine;
+            while (position < longueurBits) {
+                courant = lireBit(position++) ? courant->mdroit : courant->mgauche;
+                if (!courant->mgauche && !courant->mdroit) {
+                    trameSortie[indexSortie++] = courant->mdonnee;
+                    break;
+                }
+            }
+        }
+    }
+
+    // 2. Derniers bits : parcours de l'arbre (un code incomplet est ignoré)
+    sNoeud* courant = mRacine;
+    for (; position < longueurBits; position++) {
+        courant = lireBit(position) ? courant->mdroit : courant->mgauche;
+        if (!courant->mgauche && !courant->mdroit) {
+            trameSortie[indexSortie++] = courant->mdonnee;
+            courant = mRacine;
+        }
+    }
+
+    return indexSortie;
+}
+
+unsigned int cHuffman::decoderPlage(const vector<uint64_t>& mots, unsigned int longueurBits,
+                                    unsigned int position, unsigned int arret,
+                                    vector<char>& symboles, vector<unsigned int>& fins) const {
+    const sEntreeDecodage* table = mTableDecodage.data();
+
+    while (position < arret && position < longueurBits) {
+        if (position + FENETRE_DECODAGE <= longueurBits) {
+            size_t i = position / 64;
+            int decalage = position % 64;
+            uint64_t fenetre = mots[i] << decalage;
+            if (decalage && i + 1 < mots.size()) {
+                fenetre |= mots[i + 1] >> (64 - decalage);
+            }
+
+            const sEntreeDecodage& entree = table[fenetre >> (64 - FENETRE_DECODAGE)];
+            if (entree.nbSymboles) {
+                unsigned int debut = position;
+                for (int k = 0; k < entree.nbSymboles && position < arret; k++) {
+                    symboles.push_back(entree.symboles[k]);
+                    position = debut + entree.nbBits[k];
+                    fins.push_back(position);
+                }
+                continue;
+            }
+        }
+
+        // Code plus long que la fenêtre ou fin du flux : parcours de l'arbre
+        sNoeud* courant = mRacine;
+        unsigned int p = position;
+        while (p < longueurBits) {
+            courant = ((mots[p / 64] >> (63 - p % 64)) & 1) ? courant->mdroit : courant->mgauche;
+            p++;
+            if (!courant->mgauche && !courant->mdroit) break;
+        }
+        if (courant->mgauche || courant->mdroit) {
+            break;  // code incomplet en fin de flux
+        }
+        symboles.push_back(courant->mdonnee);
+        fins.push_back(p);
+        position = p;
+    }
+
+    return position;
+}
+
+unsigned int cHuffman::decoderParallele(const vector<uint64_t>& mots, unsigned int longueurBits,
+                                        char* trameSortie, unsigned int nbThreads) {
+    mSymbolesCorriges = 0;
+    if (!mRacine || !mRacine->mgauche || mots.empty()) return 0;
+    longueurBits = static_cast<unsigned int>(min<uint64_t>(longueurBits, mots.size() * 64));
+
+    // 1. Découpage du flux en segments de bits
+    if (nbThreads == 0) {
+        nbThreads = max(1u, thread::hardware_concurrency());
+    }
+    unsigned int nbSegments = max(1u, min(nbThreads, longueurBits / (8 * TAILLE_SEGMENT_MIN)));
+    if (nbSegments == 1) {
+        return decoder(mots, longueurBits, trameSortie);
+    }
+
+    vector<unsigned int> debuts(nbSegments + 1);
+    for (unsigned int s = 0; s <= nbSegments; s++) {
+        debuts[s] = static_cast<unsigned int>(static_cast<uint64_t>(longueurBits) * s / nbSegments);
+    }
+
+    // 2. Décodage spéculatif : chaque segment à partir de son premier bit
+    vector<vector<char>> symboles(nbSegments);
+    vector<vector<unsigned int>> fins(nbSegments);
+
+    auto decoderSegment = [&](unsigned int s) {
+        symboles[s].reserve((debuts[s + 1] - debuts[s]) / 2);
+        fins[s].reserve((debuts[s + 1] - debuts[s]) / 2);
+        decoderPlage(mots, longueurBits, debuts[s], debuts[s + 1], symboles[s], fins[s]);
+    };
+
+    vector<thread> threads;
+    for (unsigned int s = 1; s < nbSegments; s++) {
+        threads.emplace_back(decoderSegment, s);
+    }
+    decoderSegment(0);
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    // 3. Correction : raccord de chaque segment sur la vraie frontière de symbole
+    unsigned int indexSortie = 0;
+    unsigned int position = 0;  // frontière exacte (début du prochain symbole)
+    vector<char> corriges;
+    vector<unsigned int> finsCorriges;
+
+    for (unsigned int s = 0; s < nbSegments; s++) {
+        const vector<unsigned int>& f = fins[s];
+        size_t n = f.size();
+        size_t k = 0;  // premier symbole du thread qui ne commence pas avant position
+
+        while (true) {
+            while (k < n && (k == 0 ? debuts[s] : f[k - 1]) < position) k++;
+
+            // Frontière exacte vue par le thread : ses symboles suivants sont exacts
+            if (k < n && (k == 0 ? debuts[s] : f[k - 1]) == position) {
+                memcpy(trameSortie + indexSortie, symboles[s].data() + k, n - k);
+                indexSortie += static_cast<unsigned int>(n - k);
+                position = f.back();
+                break;
+            }
+            if (position >= debuts[s + 1] || position >= longueurBits) {
+                break;
+            }
+
+            // Sinon, un symbole de plus à partir de la frontière exacte
+            corriges.clear();
+            finsCorriges.clear();
+            unsigned int suivante = decoderPlage(mots, longueurBits, position, position + 1, corriges, finsCorriges);
+            if (corriges.empty()) {
+                position = longueurBits;  // code incomplet en fin de flux
+                break;
+            }
+            trameSortie[indexSortie++] = corriges[0];
+            mSymbolesCorriges++;
+            position = suivante;
+        }
+    }
+
+    return indexSortie;
+}
+
+void cHuffman::construireTableDecodage() {
+    mTableDecodage.clear();
+    if (!mRacine || !mRacine->mgauche) return;
+
+    // Chaque valeur de la fenêtre est décodée une fois en suivant l'arbre
+    mTableDecodage.resize(1u << FENETRE_DECODAGE);
+    for (unsigned int valeur = 0; valeur < mTableDecodage.size(); valeur++) {
+        sEntreeDecodage& entree = mTableDecodage[valeur];
+        entree = sEntreeDecodage();
+
+        sNoeud* courant = mRacine;
+        for (int b = 0; b < FENETRE_DECODAGE && entree.nbSymboles < 3; b++) {
+            bool bit = ((valeur >> (FENETRE_DECODAGE - 1 - b)) & 1) != 0;
+            courant = bit ? courant->mdroit : courant->mgauche;
+            if (!courant->mgauche && !courant->mdroit) {
+                entree.symboles[entree.nbSymboles] = courant->mdonnee;
+                entree.nbBits[entree.nbSymboles] = static_cast<unsigned char>(b + 1);
+                entree.nbSymboles++;
+                courant = mRacine;
+            }
+        }
+    }
+}
+
+bool cHuffman::tableCodes(uint64_t codes[256], unsigned char longueurs[256]) const {
+    fill(codes, codes + 256, 0);
+    fill(longueurs, longueurs + 256, 0);
+
+    for (const auto& paire : mCodes) {
+        const string& code = paire.second;
+        if (code.size() > 64) {
+            return false;
+        }
+        uint64_t valeur = 0;
+        for (char bit : code) {
+            valeur = (valeur << 1) | (bit == '1');
+        }
+        unsigned char symbole = static_cast<unsigned char>(paire.first);
+        codes[symbole] = valeur;
+        longueurs[symbole] = static_cast<unsigned char>(code.size());
+    }
+    return true;
+}
+
+unsigned int cHuffman::encoderParallele(const char* trameEntree, unsigned int longueur,
+                                        vector<uint64_t>& mots, unsigned int nbThreads) {
+    mots.clear();
+    if (!trameEntree || longueur == 0 || mCodes.empty()) return 0;
+
+    uint64_t codes[256];
+    unsigned char longueurs[256];
+    if (!tableCodes(codes, longueurs)) {
+        // Codes trop longs pour un mot : encodeur série, puis regroupement
+        vector<bool> bits;
+        encoder(const_cast<char*>(trameEntree), longueur, bits);
+        mots.assign((bits.size() + 63) / 64, 0);
+        for (size_t i = 0; i < bits.size(); i++) {
+            if (bits[i]) {
+                mots[i / 64] |= uint64_t(1) << (63 - i % 64);
+            }
+        }
+        return static_cast<unsigned int>(bits.size());
+    }
+
+    // 1. Découpage en segments consécutifs de taille égale
+    if (nbThreads == 0) {
+        nbThreads = max(1u, thread::hardware_concurrency());
+    }
+    unsigned int nbSegments = max(1u, min(nbThreads, longueur / TAILLE_SEGMENT_MIN));
+
+    vector<vector<uint64_t>> segments(nbSegments);
+    vector<uint64_t> bitsSegment(nbSegments);
+
+    auto encoderSegment = [&](unsigned int s) {
+        unsigned int debut = static_cast<unsigned int>(static_cast<uint64_t>(longueur) * s / nbSegments);
+        unsigned int fin = static_cast<unsigned int>(static_cast<uint64_t>(longueur) * (s + 1) / nbSegments);
+        segments[s].reserve((fin - debut) / 8 + 1);
+
+        sEcrivainBits ecrivain(segments[s]);
+        for (unsigned int i = debut; i < fin; i++) {
+            unsigned char symbole = static_cast<unsigned char>(trameEntree[i]);
+            if (longueurs[symbole]) {
+                ecrivain.ajouter(codes[symbole], longueurs[symbole]);
+            }
+        }
+        bitsSegment[s] = ecrivain.terminer();
+    };
+
+    // 2. Encodage des segments en parallèle (le premier sur le thread appelant)
+    vector<thread> threads;
+    for (unsigned int s = 1; s < nbSegments; s++) {
+        threads.emplace_back(encoderSegment, s);
+    }
+    encoderSegment(0);
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    // 3. Concaténation : chaque segment est décalé de sa position en bits
+    uint64_t nbBits = 0;
+    for (unsigned int s = 0; s < nbSegments; s++) {
+        nbBits += bitsSegment[s];
+    }
+    mots.assign(static_cast<size_t>((nbBits + 63) / 64) + 1, 0);
+
+    uint64_t position = 0;
+    for (unsigned int s = 0; s < nbSegments; s++) {
+        size_t base = static_cast<size_t>(position / 64);
+        int decalage = static_cast<int>(position % 64);
+        const vector<uint64_t>& segment = segments[s];
+        if (decalage == 0) {
+            for (size_t i = 0; i < segment.size(); i++) {
+                mots[base + i] |= segment[i];
+            }
+        } else {
+            for (size_t i = 0; i < segment.size(); i++) {
+                mots[base + i] |= segment[i] >> decalage;
+                mots[base + i + 1] |= segment[i] << (64 - decalage);
+            }
+        }
+        position += bitsSegment[s];
+    }
+    mots.resize(static_cast<size_t>((nbBits + 63) / 64));
+
+    return static_cast<unsigned int>(nbBits);
+}
+
+unsigned int cHuffman::encoderParallele(const char* trameEntree, unsigned int longueur,
+                                        vector<bool>& trameSortie, unsigned int nbThreads) {
+    vector<uint64_t> mots;
+    unsigned int nbBits = encoderParallele(trameEntree, longueur, mots, nbThreads);
+
+    trameSortie.assign(nbBits, false);
+    for (unsigned int i = 0; i < nbBits; i++) {
+        if ((mots[i / 64] >> (63 - i % 64)) & 1) {
+            trameSortie[i] = true;
+        }
+    }
+    return nbBits;
+}
+
+// ========== FONCTIONS AUXILIAIRES ==========
+
+void cHuffman::supprimerArbre(sNoeud* noeud) {
+    if (!noeud) return;
+
+    supprimerArbre(noeud->mgauche);
+    supprimerArbre(noeud->mdroit);
+    delete noeud;
+}
+
+sNoeud* cHuffman::copierArbre(sNoeud* original) {
+    if (!original) return nullptr;
+
+    sNoeud* copie = new sNoeud(original->mdonnee, original->mfreq);
+    copie->mgauche = copierArbre(original->mgauche);
+    copie->mdroit = copierArbre(original->mdroit);
+
+    return copie;
+}
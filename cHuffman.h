@@ -1,164 +1,282 @@
-/**
- * @file cHuffman.h
- * @brief Dclaration de la classe cHuffman pour le codage de Huffman
- * @author EL KILI Rim
- * @date 2025
- * @version 1.0
- */
-
-#ifndef CHUFFMAN_H
-#define CHUFFMAN_H
-
-#include <queue>
-#include <vector>
-#include <string>
-#include <map>
-
-/**
- * @struct sNoeud
- * @brief Structure reprsentant un nud dans l'arbre de Huffman
- */
-struct sNoeud {
-    char mdonnee;           ///< Caractre stock (ou 0 pour les nuds internes)
-    double mfreq;           ///< Frquence d'apparition
-    sNoeud* mgauche;        ///< Pointeur vers le fils gauche
-    sNoeud* mdroit;         ///< Pointeur vers le fils droit
-
-    /**
-     * @brief Constructeur
-     * @param d Caractre
-     * @param f Frquence
-     */
-    sNoeud(char d, double f)
-        : mdonnee(d), mfreq(f), mgauche(nullptr), mdroit(nullptr) {}
-
-    /**
-     * @brief Constructeur pour nud interne
-     * @param f Frquence totale
-     * @param g Fils gauche
-     * @param d Fils droit
-     */
-    sNoeud(double f, sNoeud* g, sNoeud* d)
-        : mdonnee(0), mfreq(f), mgauche(g), mdroit(d) {}
-};
-
-/**
- * @struct compare
- * @brief Foncteur de comparaison pour la file de priorit
- */
-struct compare {
-    /**
-     * @brief Compare deux nuds par leur frquence
-     * @param gauche Premier nud
-     * @param droit Second nud
-     * @return true si gauche > droit (pour une file min)
-     */
-    bool operator()(sNoeud* gauche, sNoeud* droit) {
-        return gauche->mfreq > droit->mfreq;
-    }
-};
-
-/**
- * @class cHuffman
- * @brief Classe pour le codage de Huffman
- *
- * Implmente la construction de l'arbre de Huffman et le codage/dcodage
- */
-class cHuffman {
-private:
-    sNoeud* mRacine;                ///< Racine de l'arbre de Huffman
-    char* mTrame;                   ///< Trame  encoder/dcoder
-    unsigned int mLongueur;         ///< Longueur de la trame
-    std::map<char, std::string> mCodes;  ///< Table des codes Huffman
-
-public:
-    /**
-     * @brief Constructeur par dfaut
-     */
-    cHuffman();
-
-    /**
-     * @brief Constructeur avec initialisation
-     * @param trame Trame  encoder
-     * @param longueur Longueur de la trame
-     */
-    cHuffman(char* trame, unsigned int longueur);
-
-    /**
-     * @brief Destructeur
-     */
-    ~cHuffman();
-
-    // Accesseurs
-    sNoeud* getRacine() const;
-    char* getTrame() const;
-    unsigned int getLongueur() const;
-
-    /**
-     * @brief Construit l'arbre de Huffman  partir de donnes
-     * @param donnees Tableau de caractres
-     * @param frequences Tableau de frquences
-     * @param taille Nombre d'lments
-     */
-    void HuffmanCodes(char* donnees, double* frequences, unsigned int taille);
-
-    /**
-     * @brief Affiche les codes Huffman
-     * @param racine Racine de l'arbre (par dfaut: mRacine)
-     */
-    void AfficherHuffman(sNoeud* racine = nullptr);
-
-    /**
-     * @brief Calcule l'histogramme d'une trame
-     * @param trame Trame d'entre
-     * @param longueur Longueur de la trame
-     * @param donnees Tableau de sortie pour les caractres uniques
-     * @param frequences Tableau de sortie pour les frquences
-     * @return Nombre d'lments uniques
-     */
-    static unsigned int Histogramme(char* trame, unsigned int longueur,
-                                    char* donnees, double* frequences);
-
-    /**
-     * @brief Encode une trame avec Huffman
-     * @param trameEntree Trame d'entre
-     * @param longueur Longueur de la trame
-     * @param trameSortie Trame encode (sortie)
-     * @return Longueur de la trame encode en bits
-     */
-    unsigned int encoder(char* trameEntree, unsigned int longueur,
-                         std::vector<bool>& trameSortie);
-
-    /**
-     * @brief Dcode une trame avec Huffman
-     * @param trameEntree Trame encode
-     * @param longueurBits Longueur en bits
-     * @param trameSortie Trame dcode (sortie)
-     * @return Longueur de la trame dcode
-     */
-    unsigned int decoder(std::vector<bool>& trameEntree, unsigned int longueurBits,
-                         char* trameSortie);
-
-private:
-    /**
-     * @brief Gnre les codes Huffman rcursivement
-     * @param racine Nud courant
-     * @param code Code accumul
-     */
-    void genererCodes(sNoeud* racine, std::string code);
-
-    /**
-     * @brief Supprime rcursivement l'arbre
-     * @param noeud Nud  supprimer
-     */
-    void supprimerArbre(sNoeud* noeud);
-
-    /**
-     * @brief Copie rcursivement un arbre
-     * @param original Arbre original
-     * @return Copie de l'arbre
-     */
-    sNoeud* copierArbre(sNoeud* original);
-};
-
-#endif // CHUFFMAN_H
+/**
+ * @file cHuffman.h
+ * @brief Déclaration de la classe cHuffman pour le codage de Huffman
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef CHUFFMAN_H
+#define CHUFFMAN_H
+
+#include <cstdint>
+#include <queue>
+#include <vector>
+#include <string>
+#include <map>
+
+/**
+ * @struct sNoeud
+ * @brief Structure représentant un nœud dans l'arbre de Huffman
+ */
+struct sNoeud {
+    char mdonnee;           ///< Caractère stocké (ou 0 pour les nœuds internes)
+    double mfreq;           ///< Fréquence d'apparition
+    sNoeud* mgauche;        ///< Pointeur vers le fils gauche
+    sNoeud* mdroit;         ///< Pointeur vers le fils droit
+
+    /**
+     * @brief Constructeur
+     * @param d Caractère
+     * @param f Fréquence
+     */
+    sNoeud(char d, double f)
+        : mdonnee(d), mfreq(f), mgauche(nullptr), mdroit(nullptr) {}
+
+    /**
+     * @brief Constructeur pour nœud interne
+     * @param f Fréquence totale
+     * @param g Fils gauche
+     * @param d Fils droit
+     */
+    sNoeud(double f, sNoeud* g, sNoeud* d)
+        : mdonnee(0), mfreq(f), mgauche(g), mdroit(d) {}
+};
+
+/**
+ * @struct compare
+ * @brief Foncteur de comparaison pour la file de priorité
+ */
+struct compare {
+    /**
+     * @brief Compare deux nœuds par leur fréquence
+     * @param gauche Premier nœud
+     * @param droit Second nœud
+     * @return true si gauche > droit (pour une file min)
+     */
+    bool operator()(sNoeud* gauche, sNoeud* droit) {
+        return gauche->mfreq > droit->mfreq;
+    }
+};
+
+/**
+ * @struct sEntreeDecodage
+ * @brief Entrée de la table de décodage : symboles entiers lus dans une fenêtre de bits
+ */
+struct sEntreeDecodage {
+    char symboles[3];           ///< Symboles décodés, dans l'ordre du flux
+    unsigned char nbSymboles;   ///< Nombre de symboles (0 : premier code plus long que la fenêtre)
+    unsigned char nbBits[3];    ///< Bits consommés après chaque symbole (cumulés)
+    unsigned char reserve;      ///< Alignement sur 8 octets
+};
+
+/**
+ * @class cHuffman
+ * @brief Classe pour le codage de Huffman
+ *
+ * Implémente la construction de l'arbre de Huffman et le codage/décodage
+ */
+class cHuffman {
+private:
+    sNoeud* mRacine;                ///< Racine de l'arbre de Huffman
+    char* mTrame;                   ///< Trame à encoder/décoder
+    unsigned int mLongueur;         ///< Longueur de la trame
+    std::map<char, std::string> mCodes;  ///< Table des codes Huffman
+    std::vector<sEntreeDecodage> mTableDecodage;  ///< Table indexée par les FENETRE_DECODAGE bits suivants
+    unsigned int mSymbolesCorriges;      ///< Symboles redécodés par le dernier decoderParallele
+
+public:
+    /**
+     * @brief Constructeur par défaut
+     */
+    cHuffman();
+
+    /**
+     * @brief Constructeur avec initialisation
+     * @param trame Trame à encoder
+     * @param longueur Longueur de la trame
+     */
+    cHuffman(char* trame, unsigned int longueur);
+
+    /**
+     * @brief Destructeur
+     */
+    ~cHuffman();
+
+    // Accesseurs
+    sNoeud* getRacine() const;
+    char* getTrame() const;
+    unsigned int getLongueur() const;
+
+    /**
+     * @brief Construit l'arbre de Huffman à partir de données
+     * @param donnees Tableau de caractères
+     * @param frequences Tableau de fréquences
+     * @param taille Nombre d'éléments
+     */
+    void HuffmanCodes(char* donnees, double* frequences, unsigned int taille);
+
+    /**
+     * @brief Affiche les codes Huffman
+     * @param racine Racine de l'arbre (par défaut: mRacine)
+     */
+    void AfficherHuffman(sNoeud* racine = nullptr);
+
+    /**
+     * @brief Calcule l'histogramme d'une trame
+     * @param trame Trame d'entrée
+     * @param longueur Longueur de la trame
+     * @param donnees Tableau de sortie pour les caractères uniques
+     * @param frequences Tableau de sortie pour les fréquences
+     * @return Nombre d'éléments uniques
+     */
+    static unsigned int Histogramme(char* trame, unsigned int longueur,
+                                    char* donnees, double* frequences);
+
+    /**
+     * @brief Encode une trame avec Huffman
+     * @param trameEntree Trame d'entrée
+     * @param longueur Longueur de la trame
+     * @param trameSortie Trame encodée (sortie)
+     * @return Longueur de la trame encodée en bits
+     */
+    unsigned int encoder(char* trameEntree, unsigned int longueur,
+                         std::vector<bool>& trameSortie);
+
+    /**
+     * @brief Décode une trame avec Huffman
+     * @param trameEntree Trame encodée
+     * @param longueurBits Longueur en bits
+     * @param trameSortie Trame décodée (sortie)
+     * @return Longueur de la trame décodée
+     */
+    unsigned int decoder(std::vector<bool>& trameEntree, unsigned int longueurBits,
+                         char* trameSortie);
+
+    /**
+     * @brief Nombre de bits lus à chaque consultation de la table de décodage
+     */
+    static const int FENETRE_DECODAGE = 12;
+
+    /**
+     * @brief Décode une trame rangée en mots de 64 bits (voir encoderParallele)
+     *
+     * Chaque consultation de la table lit FENETRE_DECODAGE bits et produit
+     * jusqu'à trois symboles, tant que leurs codes tiennent ensemble dans la
+     * fenêtre. Les codes plus longs sont décodés en parcourant l'arbre.
+     * @param mots Trame encodée, bit de poids fort en premier
+     * @param longueurBits Longueur en bits
+     * @param trameSortie Trame décodée (sortie)
+     * @return Longueur de la trame décodée
+     */
+    unsigned int decoder(const std::vector<uint64_t>& mots, unsigned int longueurBits,
+                         char* trameSortie);
+
+    /**
+     * @brief Décode en parallèle une trame sans marqueur de resynchronisation
+     *
+     * Le flux est découpé en segments d'au moins 8 x TAILLE_SEGMENT_MIN bits.
+     * Chaque thread commence à décoder au début de son segment, même au milieu
+     * d'un code, et s'arrête au premier symbole qui déborde sur le segment
+     * suivant. Un code de Huffman se resynchronise de lui-même après quelques
+     * symboles. Une passe de correction part donc de la vraie fin du segment
+     * précédent, redécode jusqu'à retomber sur une frontière de symbole vue
+     * par le thread, puis reprend ses symboles. Le résultat est celui de
+     * decoder().
+     * @param mots Trame encodée, bit de poids fort en premier
+     * @param longueurBits Longueur en bits
+     * @param trameSortie Trame décodée (sortie)
+     * @param nbThreads Nombre de threads (0 = nombre de cœurs)
+     * @return Longueur de la trame décodée
+     */
+    unsigned int decoderParallele(const std::vector<uint64_t>& mots, unsigned int longueurBits,
+                                  char* trameSortie, unsigned int nbThreads = 0);
+
+    /**
+     * @brief Nombre de symboles redécodés par la passe de correction du dernier decoderParallele
+     */
+    unsigned int getSymbolesCorriges() const { return mSymbolesCorriges; }
+
+    /**
+     * @brief Nombre minimal de symboles par segment pour encoderParallele
+     */
+    static const unsigned int TAILLE_SEGMENT_MIN = 16384;
+
+    /**
+     * @brief Encode une trame par segments, en parallèle, dans des mots de 64 bits
+     *
+     * La trame est découpée en segments consécutifs, encodés en même temps
+     * avec la même table de codes, chacun dans son propre tampon de bits. Les
+     * tampons sont ensuite mis bout à bout par décalage de bits. Les bits
+     * produits sont exactement ceux de encoder() (la trame RLE n'a pas de
+     * marqueur de resynchronisation sur lequel aligner les segments).
+     * @param trameEntree Trame d'entrée
+     * @param longueur Longueur de la trame
+     * @param mots Trame encodée (sortie), bit de poids fort en premier
+     * @param nbThreads Nombre de threads (0 = nombre de cœurs)
+     * @return Longueur de la trame encodée en bits
+     */
+    unsigned int encoderParallele(const char* trameEntree, unsigned int longueur,
+                                  std::vector<uint64_t>& mots, unsigned int nbThreads = 0);
+
+    /**
+     * @brief Encode une trame par segments, en parallèle (même sortie que encoder())
+     * @param trameEntree Trame d'entrée
+     * @param longueur Longueur de la trame
+     * @param trameSortie Trame encodée (sortie)
+     * @param nbThreads Nombre de threads (0 = nombre de cœurs)
+     * @return Longueur de la trame encodée en bits
+     */
+    unsigned int encoderParallele(const char* trameEntree, unsigned int longueur,
+                                  std::vector<bool>& trameSortie, unsigned int nbThreads = 0);
+
+private:
+    /**
+     * @brief Convertit mCodes en une table indexée par symbole
+     * @param codes Code de chaque symbole, aligné sur les bits de poids faible (sortie)
+     * @param longueurs Longueur du code de chaque symbole, 0 si absent (sortie)
+     * @return false si un code dépasse 64 bits
+     */
+    bool tableCodes(uint64_t codes[256], unsigned char longueurs[256]) const;
+
+    /**
+     * @brief Construit mTableDecodage à partir de l'arbre
+     */
+    void construireTableDecodage();
+
+    /**
+     * @brief Décode les symboles qui commencent entre position et arret
+     * @param mots Trame encodée
+     * @param longueurBits Longueur en bits
+     * @param position Bit de départ (supposé au début d'un code)
+     * @param arret Aucun symbole commençant à ce bit ou après n'est décodé
+     * @param symboles Symboles décodés (ajoutés)
+     * @param fins Position qui suit chaque symbole décodé (ajoutée)
+     * @return Position après le dernier symbole décodé
+     */
+    unsigned int decoderPlage(const std::vector<uint64_t>& mots, unsigned int longueurBits,
+                              unsigned int position, unsigned int arret,
+                              std::vector<char>& symboles, std::vector<unsigned int>& fins) const;
+
+    /**
+     * @brief Génère les codes Huffman récursivement
+     * @param racine Nœud courant
+     * @param code Code accumulé
+     */
+    void genererCodes(sNoeud* racine, std::string code);
+
+    /**
+     * @brief Supprime récursivement l'arbre
+     * @param noeud Nœud à supprimer
+     */
+    void supprimerArbre(sNoeud* noeud);
+
+    /**
+     * @brief Copie récursivement un arbre
+     * @param original Arbre original
+     * @return Copie de l'arbre
+     */
+    sNoeud* copierArbre(sNoeud* original);
+};
+
+#endif // CHUFFMAN_H
@@ -0,0 +1,115 @@
+/**
+ * @file cInstrumentation.cpp
+ * @brief Implémentation de la classe cInstrumentation
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "cInstrumentation.h"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+using namespace std;
+
+cInstrumentation::cInstrumentation() : mActive(true) {
+    reinitialiser();
+}
+
+bool cInstrumentation::estCompilee() {
+#ifdef JPEG_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+void cInstrumentation::reinitialiser() {
+    for (int e = 0; e < NB_ETAPES; e++) {
+        mTempsNs[e] = 0.0;
+        mOctets[e] = 0;
+    }
+    for (int i = 0; i <= 64; i++) {
+        mHistogrammeEOB[i] = 0;
+    }
+    mBlocs = 0;
+    mBlocsNuls = 0;
+    mAllocations = 0;
+}
+
+void cInstrumentation::cumuler(const cInstrumentation& autre) {
+    if (!mActive) return;
+
+    for (int e = 0; e < NB_ETAPES; e++) {
+        mTempsNs[e] += autre.mTempsNs[e];
+        mOctets[e] += autre.mOctets[e];
+    }
+    for (int i = 0; i <= 64; i++) {
+        mHistogrammeEOB[i] += autre.mHistogrammeEOB[i];
+    }
+    mBlocs += autre.mBlocs;
+    mBlocsNuls += autre.mBlocsNuls;
+    mAllocations += autre.mAllocations;
+}
+
+void cInstrumentation::enregistrerBloc(int positionEOB) {
+    if (!mActive) return;
+
+    if (positionEOB < 0) positionEOB = 0;
+    if (positionEOB > 64) positionEOB = 64;
+
+    mBlocs++;
+    if (positionEOB == 0) {
+        mBlocsNuls++;
+    }
+    mHistogrammeEOB[positionEOB]++;
+}
+
+double cInstrumentation::getRatioBlocsNuls() const {
+    return (mBlocs > 0) ? static_cast<double>(mBlocsNuls) / mBlocs : 0.0;
+}
+
+const char* cInstrumentation::nomEtape(eEtape etape) {
+    static const char* noms[NB_ETAPES] = {
+        "chargement", "decalage", "dct", "quantification", "rle", "entropie", "ecriture"
+    };
+    return noms[etape];
+}
+
+string cInstrumentation::versJSON() const {
+    ostringstream json;
+    json << fixed << setprecision(0);
+
+    json << "{\n";
+    json << "  \"compilee\": " << (estCompilee() ? "true" : "false") << ",\n";
+    json << "  \"etapes\": {\n";
+    for (int e = 0; e < NB_ETAPES; e++) {
+        json << "    \"" << nomEtape(static_cast<eEtape>(e)) << "\": {\"temps_ns\": "
+             << mTempsNs[e] << ", \"octets\": " << mOctets[e] << "}"
+             << (e + 1 < NB_ETAPES ? "," : "") << "\n";
+    }
+    json << "  },\n";
+    json << "  \"blocs\": " << mBlocs << ",\n";
+    json << "  \"blocs_nuls\": " << mBlocsNuls << ",\n";
+    json << setprecision(4) << "  \"ratio_blocs_nuls\": " << getRatioBlocsNuls() << ",\n";
+    json << "  \"allocations\": " << mAllocations << ",\n";
+    json << "  \"histogramme_eob\": [";
+    for (int i = 0; i <= 64; i++) {
+        json << mHistogrammeEOB[i] << (i < 64 ? ", " : "");
+    }
+    json << "]\n}\n";
+
+    return json.str();
+}
+
+bool cInstrumentation::exporterJSON(const char* nomFichier) const {
+    ofstream fichier(nomFichier);
+    if (!fichier) {
+        return false;
+    }
+
+    fichier << versJSON();
+    fichier.close();
+    return true;
+}
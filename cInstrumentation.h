@@ -0,0 +1,186 @@
+/**
+ * @file cInstrumentation.h
+ * @brief Déclaration de la classe cInstrumentation (compteurs par étape du codec)
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ *
+ * Les compteurs ne sont mis à jour que si le programme est compilé avec
+ * -DJPEG_INSTRUMENTATION. Sans cette option, les macros JPEG_INSTR et
+ * JPEG_CHRONO ne génèrent aucun code : le coût à l'exécution est nul.
+ */
+
+#ifndef CINSTRUMENTATION_H
+#define CINSTRUMENTATION_H
+
+#include <string>
+
+#ifdef JPEG_INSTRUMENTATION
+#include <chrono>
+
+/// Exécute l'instruction uniquement si l'instrumentation est compilée
+#define JPEG_INSTR(instruction) do { instruction; } while (0)
+
+#define JPEG_CONCAT_(a, b) a##b
+#define JPEG_CONCAT(a, b) JPEG_CONCAT_(a, b)
+
+/// Mesure la durée de la portée courante et l'ajoute à l'étape donnée
+#define JPEG_CHRONO(instr, etape) cChronoEtape JPEG_CONCAT(chronoEtape, __LINE__)((instr), (etape))
+#else
+#define JPEG_INSTR(instruction) do { } while (0)
+#define JPEG_CHRONO(instr, etape) do { } while (0)
+#endif
+
+/**
+ * @enum eEtape
+ * @brief Étapes du pipeline suivies par l'instrumentation
+ *
+ * Pour le décodeur, les étapes correspondent aux opérations inverses
+ * (IDCT pour ETAPE_DCT, déquantification pour ETAPE_QUANTIFICATION...).
+ */
+enum eEtape {
+    ETAPE_CHARGEMENT = 0,   ///< Lecture de l'image ou du fichier compressé
+    ETAPE_DECALAGE,         ///< Décalage de niveau (0..255 <-> -128..127)
+    ETAPE_DCT,              ///< DCT (ou IDCT)
+    ETAPE_QUANTIFICATION,   ///< Quantification (ou déquantification)
+    ETAPE_RLE,              ///< Codage (ou décodage) RLE des blocs
+    ETAPE_ENTROPIE,         ///< Codage de Huffman (à zéro : les fichiers .dat n'en ont pas)
+    ETAPE_ECRITURE,         ///< Écriture du fichier ou de l'image de sortie
+    NB_ETAPES
+};
+
+/**
+ * @class cInstrumentation
+ * @brief Compteurs cumulés d'un codeur ou d'un décodeur
+ *
+ * Temps et octets par étape, proportion de blocs nuls (aucun coefficient AC),
+ * histogramme de la position de fin de bloc et nombre d'allocations.
+ */
+class cInstrumentation {
+private:
+    bool mActive;                               ///< Enregistrement actif à l'exécution
+    double mTempsNs[NB_ETAPES];                 ///< Temps cumulé par étape (ns)
+    unsigned long long mOctets[NB_ETAPES];      ///< Octets produits par étape
+    unsigned long long mBlocs;                  ///< Nombre de blocs traités
+    unsigned long long mBlocsNuls;              ///< Blocs sans coefficient AC non nul
+    unsigned long long mHistogrammeEOB[65];     ///< Position de fin de bloc (0..64)
+    unsigned long long mAllocations;            ///< Nombre d'allocations sur le tas
+
+public:
+    /**
+     * @brief Constructeur (instrumentation active, compteurs à zéro)
+     */
+    cInstrumentation();
+
+    /**
+     * @brief Indique si l'instrumentation est compilée dans le programme
+     * @return true si JPEG_INSTRUMENTATION est défini
+     */
+    static bool estCompilee();
+
+    /**
+     * @brief Active ou suspend l'enregistrement à l'exécution
+     * @param active true pour enregistrer
+     */
+    void activer(bool active) { mActive = active; }
+    bool estActive() const { return mActive; }
+
+    /**
+     * @brief Remet tous les compteurs à zéro
+     */
+    void reinitialiser();
+
+    /**
+     * @brief Ajoute les compteurs d'une autre instance (décodage parallèle)
+     * @param autre Compteurs à cumuler
+     */
+    void cumuler(const cInstrumentation& autre);
+
+    // Enregistrement (appelé via JPEG_INSTR / JPEG_CHRONO)
+    void ajouterTemps(eEtape etape, double ns) { if (mActive) mTempsNs[etape] += ns; }
+    void ajouterOctets(eEtape etape, unsigned long long octets) { if (mActive) mOctets[etape] += octets; }
+    void compterAllocation(unsigned long long nombre = 1) { if (mActive) mAllocations += nombre; }
+
+    /**
+     * @brief Enregistre un bloc codé ou décodé
+     * @param positionEOB Nombre de coefficients jusqu'au dernier AC non nul
+     *                    inclus, en ordre zigzag (0 si le bloc n'a que le DC)
+     */
+    void enregistrerBloc(int positionEOB);
+
+    /**
+     * @brief Calcule la position de fin de bloc à partir de sa trame RLE
+     * @param trameBloc Trame du bloc (DC puis paires runlength/amplitude)
+     * @param longueur Longueur de la trame du bloc
+     * @return Position de fin de bloc (0..64)
+     */
+    template <typename T>
+    static int positionEOB(const T* trameBloc, int longueur) {
+        int position = 0;
+        int derniere = 0;
+        for (int i = 1; i + 1 < longueur; i += 2) {
+            position += trameBloc[i];
+            if (trameBloc[i + 1] != 0) {
+                position++;
+                derniere = position;
+            }
+        }
+        return derniere;
+    }
+
+    // Accesseurs
+    double getTempsNs(eEtape etape) const { return mTempsNs[etape]; }
+    unsigned long long getOctets(eEtape etape) const { return mOctets[etape]; }
+    unsigned long long getBlocs() const { return mBlocs; }
+    unsigned long long getBlocsNuls() const { return mBlocsNuls; }
+    unsigned long long getHistogrammeEOB(int position) const { return mHistogrammeEOB[position]; }
+    unsigned long long getAllocations() const { return mAllocations; }
+
+    /**
+     * @brief Proportion de blocs sans coefficient AC non nul
+     * @return Ratio entre 0 et 1
+     */
+    double getRatioBlocsNuls() const;
+
+    /**
+     * @brief Nom d'une étape tel qu'utilisé dans l'export JSON
+     */
+    static const char* nomEtape(eEtape etape);
+
+    /**
+     * @brief Sérialise les compteurs au format JSON
+     * @return Document JSON
+     */
+    std::string versJSON() const;
+
+    /**
+     * @brief Écrit les compteurs au format JSON dans un fichier
+     * @param nomFichier Chemin du fichier de sortie
+     * @return true si l'écriture a réussi
+     */
+    bool exporterJSON(const char* nomFichier) const;
+};
+
+#ifdef JPEG_INSTRUMENTATION
+/**
+ * @class cChronoEtape
+ * @brief Chronomètre de portée qui ajoute sa durée à une étape
+ */
+class cChronoEtape {
+private:
+    cInstrumentation& mInstr;
+    eEtape mEtape;
+    std::chrono::steady_clock::time_point mDebut;
+
+public:
+    cChronoEtape(cInstrumentation& instr, eEtape etape)
+        : mInstr(instr), mEtape(etape), mDebut(std::chrono::steady_clock::now()) {}
+
+    ~cChronoEtape() {
+        std::chrono::duration<double, std::nano> duree = std::chrono::steady_clock::now() - mDebut;
+        mInstr.ajouterTemps(mEtape, duree.count());
+    }
+};
+#endif
+
+#endif // CINSTRUMENTATION_H
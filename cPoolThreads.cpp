@@ -0,0 +1,58 @@
+/**
+ * @file cPoolThreads.cpp
+ * @brief Implémentation de la classe cPoolThreads
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "cPoolThreads.h"
+#include <algorithm>
+
+using namespace std;
+
+cPoolThreads::cPoolThreads(unsigned int nbThreads) : mArret(false) {
+    if (nbThreads == 0) {
+        nbThreads = max(1u, thread::hardware_concurrency());
+    }
+    mThreads.reserve(nbThreads);
+    for (unsigned int t = 0; t < nbThreads; t++) {
+        mThreads.emplace_back(&cPoolThreads::boucle, this);
+    }
+}
+
+cPoolThreads::~cPoolThreads() {
+    {
+        lock_guard<mutex> verrou(mVerrou);
+        mArret = true;
+    }
+    mCondition.notify_all();
+    for (thread& t : mThreads) {
+        t.join();
+    }
+}
+
+void cPoolThreads::executer(function<void()> tache) {
+    {
+        lock_guard<mutex> verrou(mVerrou);
+        mFile.push_back(move(tache));
+    }
+    mCondition.notify_one();
+}
+
+void cPoolThreads::boucle() {
+    for (;;) {
+        function<void()> tache;
+        {
+            unique_lock<mutex> verrou(mVerrou);
+            mCondition.wait(verrou, [this] { return mArret || !mFile.empty(); });
+            // À l'arrêt, la file est vidée avant de quitter
+            if (mFile.empty()) {
+                return;
+            }
+            tache = move(mFile.front());
+            mFile.pop_front();
+        }
+        tache();
+    }
+}
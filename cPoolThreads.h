@@ -0,0 +1,81 @@
+/**
+ * @file cPoolThreads.h
+ * @brief Déclaration de l'interface cExecuteur et de la classe cPoolThreads
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef CPOOLTHREADS_H
+#define CPOOLTHREADS_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class cExecuteur
+ * @brief Exécute des tâches de façon asynchrone
+ *
+ * Interface permettant de fournir au codec asynchrone l'exécuteur de
+ * l'application (boucle d'événements, pool existant...) à la place du pool
+ * interne. Chaque tâche soumise doit être exécutée exactement une fois.
+ */
+class cExecuteur {
+public:
+    virtual ~cExecuteur() {}
+
+    /**
+     * @brief Soumet une tâche
+     * @param tache Tâche à exécuter sur un thread de l'exécuteur
+     */
+    virtual void executer(std::function<void()> tache) = 0;
+};
+
+/**
+ * @class cPoolThreads
+ * @brief Nombre fixe de threads servant une file de tâches
+ *
+ * Les threads sont créés par le constructeur et ne sont jamais plus
+ * nombreux : les tâches en surnombre attendent dans la file. Le destructeur
+ * exécute les tâches restantes puis attend la fin des threads.
+ */
+class cPoolThreads : public cExecuteur {
+private:
+    std::vector<std::thread> mThreads;              ///< Threads du pool
+    std::deque<std::function<void()>> mFile;        ///< Tâches en attente
+    std::mutex mVerrou;                             ///< Protège mFile et mArret
+    std::condition_variable mCondition;             ///< Signale une tâche ou l'arrêt
+    bool mArret;                                    ///< Vrai quand le pool se termine
+
+public:
+    /**
+     * @brief Constructeur
+     * @param nbThreads Nombre de threads (0 = nombre de cœurs)
+     */
+    explicit cPoolThreads(unsigned int nbThreads = 0);
+
+    /**
+     * @brief Destructeur : exécute les tâches en attente puis arrête les threads
+     */
+    ~cPoolThreads();
+
+    // Non copiable : les threads appartiennent à une seule instance
+    cPoolThreads(const cPoolThreads&) = delete;
+    cPoolThreads& operator=(const cPoolThreads&) = delete;
+
+    void executer(std::function<void()> tache) override;
+
+    unsigned int getNbThreads() const { return static_cast<unsigned int>(mThreads.size()); }
+
+private:
+    /**
+     * @brief Boucle d'un thread : dépile et exécute les tâches jusqu'à l'arrêt
+     */
+    void boucle();
+};
+
+#endif // CPOOLTHREADS_H
@@ -0,0 +1,159 @@
+/**
+ * @file cTablesDCT.h
+ * @brief Tables de cosinus calculées à la compilation et DCT/IDCT en gabarit sur la taille du bloc
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef CTABLESDCT_H
+#define CTABLESDCT_H
+
+#include <cmath>
+
+/**
+ * @brief Déroulement complet de la boucle qui suit (boucles internes de la DCT)
+ *
+ * À -O2, GCC ne déroule pas de lui-même les boucles de taille constante :
+ * la directive le force, sans changer l'ordre des opérations.
+ */
+#if defined(__GNUC__) && (__GNUC__ >= 8 || defined(__clang__))
+#define JPEG_DEROULER _Pragma("GCC unroll 16")
+#else
+#define JPEG_DEROULER
+#endif
+
+/**
+ * @brief Valeur double de 1.0 / sqrt(2.0), facteur C(0) de la DCT
+ *
+ * Écrite en littéral pour être utilisable à la compilation ; c'est le même
+ * double que le calcul à l'exécution (et non l'arrondi exact de 1/racine(2)).
+ */
+constexpr double RACINE_DEMI = 0.70710678118654746;
+
+/**
+ * @brief Facteur de normalisation C(u) de la DCT
+ */
+constexpr double facteurC(int u) {
+    return u == 0 ? RACINE_DEMI : 1.0;
+}
+
+/**
+ * @brief Cosinus évalué à la compilation
+ *
+ * Réduction de l'angle au premier quadrant puis séries de Taylor en long
+ * double. Pour les tables jusqu'à N = 16, le résultat arrondi en double est
+ * celui de std::cos ; pour N = 32, quelques valeurs quasi équidistantes de
+ * deux doubles peuvent différer d'un ulp (précision du long double).
+ * @param angle Angle en radians
+ */
+constexpr double cosinusConstexpr(double angle) {
+    const long double PI_LONG = 3.14159265358979323846264338327950288L;
+    long double x = angle < 0 ? -static_cast<long double>(angle) : static_cast<long double>(angle);
+    long long quadrant = static_cast<long long>(x / (PI_LONG / 2));
+    long double r = x - quadrant * (PI_LONG / 2);
+
+    long double terme = 1.0L;
+    long double cosR = 1.0L;
+    for (int n = 1; n < 16; n++) {
+        terme *= -r * r / ((2 * n - 1) * (2 * n));
+        cosR += terme;
+    }
+    terme = r;
+    long double sinR = r;
+    for (int n = 1; n < 16; n++) {
+        terme *= -r * r / ((2 * n) * (2 * n + 1));
+        sinR += terme;
+    }
+
+    switch (quadrant % 4) {
+        case 0: return static_cast<double>(cosR);
+        case 1: return static_cast<double>(-sinR);
+        case 2: return static_cast<double>(-cosR);
+        default: return static_cast<double>(sinR);
+    }
+}
+
+/**
+ * @struct sTableCosinus
+ * @brief Cosinus de la DCT sur N points : c[u][x] = cos((2x + 1) u pi / 2N)
+ *
+ * L'angle est calculé en double exactement comme dans l'ancienne boucle
+ * (avec la valeur de M_PI), seul le cosinus est évalué à la compilation.
+ */
+template <int N>
+struct sTableCosinus {
+    double c[N][N];
+
+    constexpr sTableCosinus() : c() {
+        for (int u = 0; u < N; u++) {
+            for (int x = 0; x < N; x++) {
+                c[u][x] = cosinusConstexpr((2 * x + 1) * u * 3.14159265358979323846 / (2.0 * N));
+            }
+        }
+    }
+};
+
+/**
+ * @brief Table de cosinus sur N points, construite à la compilation
+ */
+template <int N>
+constexpr sTableCosinus<N> TABLE_COSINUS = sTableCosinus<N>();
+
+/**
+ * @brief DCT directe d'un bloc N x N (N = 4, 8 ou 16)
+ *
+ * Même somme, dans le même ordre, que Calcul_DCT_Block pour N = 8 : les
+ * coefficients sont identiques au bit près. Les deux boucles internes (sur
+ * x et y) sont entièrement déroulées par JPEG_DEROULER : chaque coefficient
+ * est une suite de N x N produits, sans compteur de boucle.
+ * @param bloc Bloc d'entrée N x N (valeurs entre -128 et 127)
+ * @param coefficients Coefficients N x N (sortie), normalisation orthonormée 2/N
+ */
+template <int N>
+void dctDirecte(char** bloc, double** coefficients) {
+    const sTableCosinus<N>& cosinus = TABLE_COSINUS<N>;
+    for (int u = 0; u < N; u++) {
+        for (int v = 0; v < N; v++) {
+            double sum = 0.0;
+            JPEG_DEROULER
+            for (int x = 0; x < N; x++) {
+                JPEG_DEROULER
+                for (int y = 0; y < N; y++) {
+                    sum += bloc[x][y] * cosinus.c[u][x] * cosinus.c[v][y];
+                }
+            }
+            coefficients[u][v] = (2.0 / N) * facteurC(u) * facteurC(v) * sum;
+        }
+    }
+}
+
+/**
+ * @brief IDCT directe d'un bloc N x N à partir de coefficients d'une DCT sur M points
+ *
+ * Avec M = N, inverse de dctDirecte<N>. Avec N < M = 8, c'est l'IDCT réduite
+ * de Calcul_IDCT_Reduite (les N x N coefficients de basse fréquence d'un
+ * bloc 8x8 donnent l'image réduite du bloc). Boucles internes déroulées
+ * comme dans dctDirecte.
+ * @param coefficients Coefficients N x N
+ * @param bloc Bloc de sortie N x N
+ */
+template <int N, int M = N>
+void idctDirecte(double** coefficients, char** bloc) {
+    const sTableCosinus<N>& cosinus = TABLE_COSINUS<N>;
+    for (int x = 0; x < N; x++) {
+        for (int y = 0; y < N; y++) {
+            double sum = 0.0;
+            JPEG_DEROULER
+            for (int u = 0; u < N; u++) {
+                JPEG_DEROULER
+                for (int v = 0; v < N; v++) {
+                    sum += coefficients[u][v] * facteurC(u) * facteurC(v) * cosinus.c[u][x] * cosinus.c[v][y];
+                }
+            }
+            bloc[x][y] = static_cast<char>(std::round((2.0 / M) * sum));
+        }
+    }
+}
+
+#endif // CTABLESDCT_H
@@ -1,593 +1,3236 @@
-/**
- * @file main.cpp
- * @brief Programme principal de test du codeur/decodeur JPEG
- * @author EL KILI Rim
- * @date 2025
- * @version 1.0
- */
-
-#include "cCompression.h"
-#include "cDecompression.h"
-#include "cHuffman.h"
-#include <iostream>
-#include <fstream>
-#include <vector>
-#include <chrono>
-#include <cmath>
-#include <iomanip>
-
-using namespace std;
-using namespace chrono;
-
-/**
- * @brief Affiche une matrice 8x8
- */
-void afficherMatrice8x8(int matrice[8][8], const string& titre = "Matrice") {
-    cout << "\n" << titre << ":" << endl;
-    cout << "----------------" << endl;
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            cout << setw(4) << matrice[i][j] << " ";
-        }
-        cout << endl;
-    }
-}
-
-/**
- * @brief Affiche une matrice 8x8 de doubles
- */
-void afficherMatrice8x8Double(double matrice[8][8], const string& titre = "Matrice") {
-    cout << "\n" << titre << ":" << endl;
-    cout << "----------------" << endl;
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            cout << setw(8) << fixed << setprecision(2) << matrice[i][j] << " ";
-        }
-        cout << endl;
-    }
-}
-
-/**
- * @brief Teste la DCT et IDCT sur un bloc exemple
- */
-void testDCT() {
-    cout << "\n===============================================================" << endl;
-    cout << "TEST 1: TRANSFORMEE COSINUS DISCRETE (DCT/IDCT)" << endl;
-    cout << "===============================================================" << endl;
-
-    // Creer un bloc de test (identique a l'exemple de l'annexe A)
-    char blocTest[8][8] = {
-        {11, 16, 21, 25, 27, 27, 27, 27},
-        {16, 23, 25, 28, 31, 28, 28, 28},
-        {22, 27, 32, 35, 30, 28, 28, 28},
-        {31, 33, 34, 32, 32, 31, 31, 31},
-        {31, 32, 33, 34, 34, 27, 27, 27},
-        {33, 33, 33, 33, 32, 29, 29, 29},
-        {34, 34, 33, 35, 34, 29, 29, 29},
-        {34, 34, 33, 33, 35, 30, 30, 30}
-    };
-
-    // Afficher le bloc original
-    cout << "\nBloc original (valeurs decalees -128 a 127):" << endl;
-    cout << "--------------------------------------------" << endl;
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            cout << setw(4) << (int)blocTest[i][j] << " ";
-        }
-        cout << endl;
-    }
-
-    // Preparer les pointeurs
-    char* blocPtrs[8];
-    double dct[8][8];
-    double* dctPtrs[8];
-    char blocReconstruit[8][8];
-    char* reconPtrs[8];
-
-    for (int i = 0; i < 8; i++) {
-        blocPtrs[i] = blocTest[i];
-        dctPtrs[i] = dct[i];
-        reconPtrs[i] = blocReconstruit[i];
-    }
-
-    // Creer un compresseur
-    cCompression comp;
-
-    // Calculer la DCT
-    auto debutDCT = high_resolution_clock::now();
-    comp.Calcul_DCT_Block(blocPtrs, dctPtrs);
-    auto finDCT = high_resolution_clock::now();
-
-    // Afficher quelques coefficients DCT
-    cout << "\nCoefficients DCT significatifs:" << endl;
-    cout << "--------------------------------" << endl;
-    cout << "Coefficient DC (0,0): " << fixed << setprecision(2) << dct[0][0] << endl;
-    cout << "Coefficient AC (0,1): " << fixed << setprecision(2) << dct[0][1] << endl;
-    cout << "Coefficient AC (1,0): " << fixed << setprecision(2) << dct[1][0] << endl;
-    cout << "Coefficient AC (1,1): " << fixed << setprecision(2) << dct[1][1] << endl;
-
-    // Calculer l'IDCT
-    auto debutIDCT = high_resolution_clock::now();
-    comp.Calcul_IDCT(dctPtrs, reconPtrs);
-    auto finIDCT = high_resolution_clock::now();
-
-    // Verifier la reconstruction
-    double erreur = 0.0;
-    double erreurMax = 0.0;
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            double diff = blocTest[i][j] - blocReconstruit[i][j];
-            erreur += diff * diff;
-            if (fabs(diff) > erreurMax) {
-                erreurMax = fabs(diff);
-            }
-        }
-    }
-    double erreurRMS = sqrt(erreur / 64.0);
-
-    // Calculer les temps
-    auto dureeDCT = duration_cast<microseconds>(finDCT - debutDCT);
-    auto dureeIDCT = duration_cast<microseconds>(finIDCT - debutIDCT);
-
-    // Afficher les resultats
-    cout << "\nResultats DCT/IDCT:" << endl;
-    cout << "-------------------" << endl;
-    cout << "Temps DCT: " << dureeDCT.count() << " us" << endl;
-    cout << "Temps IDCT: " << dureeIDCT.count() << " us" << endl;
-    cout << "Erreur RMS: " << erreurRMS << endl;
-    cout << "Erreur max: " << erreurMax << endl;
-    cout << "Test DCT/IDCT: " << (erreurRMS < 0.1 ? "[OK] REUSSI" : "[X] ECHEC") << endl;
-}
-
-/**
- * @brief Teste la quantification/dequantification
- */
-void testQuantification() {
-    cout << "\n===============================================================" << endl;
-    cout << "TEST 2: QUANTIFICATION/DEQUANTIFICATION JPEG" << endl;
-    cout << "===============================================================" << endl;
-
-    cCompression comp(256, 256, 50); // Qualite 50%
-
-    // Creer un bloc DCT de test similaire a l'exemple
-    double dct[8][8];
-    double* dctPtrs[8];
-    int quant[8][8];
-    int* quantPtrs[8];
-    double dctReconstruit[8][8];
-    double* reconPtrs[8];
-
-    for (int i = 0; i < 8; i++) {
-        dctPtrs[i] = dct[i];
-        quantPtrs[i] = quant[i];
-        reconPtrs[i] = dctReconstruit[i];
-    }
-
-    // Remplir avec des valeurs de test (similaires a l'exemple)
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            if (i == 0 && j == 0) dct[i][j] = 235.62;
-            else if (i == 0 && j == 1) dct[i][j] = -1.03;
-            else if (i == 0 && j == 2) dct[i][j] = -12.08;
-            else dct[i][j] = (i + j - 4) * 5.0; // Valeurs diverses
-        }
-    }
-
-    cout << "\nCoefficients DCT avant quantification:" << endl;
-    cout << "--------------------------------------" << endl;
-    for (int i = 0; i < 4; i++) { // Afficher seulement les 4 premieres lignes
-        for (int j = 0; j < 4; j++) {
-            cout << setw(8) << fixed << setprecision(2) << dct[i][j] << " ";
-        }
-        cout << endl;
-    }
-
-    // Quantifier
-    comp.quant_JPEG(dctPtrs, quantPtrs);
-
-    // Compter les coefficients nuls
-    int coefficientsNonNuls = 0;
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            if (quant[i][j] != 0) coefficientsNonNuls++;
-        }
-    }
-
-    cout << "\nMatrice quantifiee (premieres valeurs):" << endl;
-    cout << "---------------------------------------" << endl;
-    for (int i = 0; i < 4; i++) {
-        for (int j = 0; j < 4; j++) {
-            cout << setw(4) << quant[i][j] << " ";
-        }
-        cout << endl;
-    }
-
-    // Dequantifier
-    comp.dequant_JPEG(quantPtrs, reconPtrs);
-
-    // Calculer l'erreur
-    double erreur = 0.0;
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            double diff = dct[i][j] - dctReconstruit[i][j];
-            erreur += diff * diff;
-        }
-    }
-    double erreurRMS = sqrt(erreur / 64.0);
-
-    // Calculer le taux de compression theorique
-    double taux = comp.Taux_Compression(quantPtrs);
-
-    // Afficher les resultats
-    cout << "\nResultats quantification:" << endl;
-    cout << "-------------------------" << endl;
-    cout << "Coefficients non nuls apres quantification: "
-         << coefficientsNonNuls << "/64" << endl;
-    cout << "Taux de remplissage: "
-         << fixed << setprecision(1) << (coefficientsNonNuls/64.0*100.0) << "%" << endl;
-    cout << "Erreur RMS quantification: " << erreurRMS << endl;
-    cout << "Taux de compression theorique: " << taux << "%" << endl;
-    cout << "Test quantification: " << (coefficientsNonNuls < 64 ? "[OK] REUSSI" : "[X] ECHEC") << endl;
-}
-
-/**
- * @brief Teste le RLE avec l'exemple du sujet
- */
-void testRLE() {
-    cout << "\n===============================================================" << endl;
-    cout << "TEST 3: RUN-LENGTH ENCODING (RLE)" << endl;
-    cout << "===============================================================" << endl;
-
-    cCompression comp(8, 8, 50);
-
-    // Bloc quantifie de l'exemple B
-    int blocQuant[8][8] = {
-        {15, 0, -1, 0, 0, 0, 0, 0},
-        {-2, -1, 0, 0, 0, 0, 0, 0},
-        {-1, -1, 0, 0, 0, 0, 0, 0},
-        {-1, 0, 0, 0, 0, 0, 0, 0},
-        {0, 0, 0, 0, 0, 0, 0, 0},
-        {0, 0, 0, 0, 0, 0, 0, 0},
-        {0, 0, 0, 0, 0, 0, 0, 0},
-        {0, 0, 0, 0, 0, 0, 0, 0}
-    };
-
-    cout << "\nBloc quantifie 8x8 (exemple du sujet):" << endl;
-    cout << "--------------------------------------" << endl;
-    for (int i = 0; i < 8; i++) {
-        for (int j = 0; j < 8; j++) {
-            cout << setw(4) << blocQuant[i][j] << " ";
-        }
-        cout << endl;
-    }
-
-    int* blocPtrs[8];
-    for (int i = 0; i < 8; i++) {
-        blocPtrs[i] = blocQuant[i];
-    }
-
-    // Encoder avec RLE
-    char trame[128];
-    int DC_precedent = 0;
-    int longueur = comp.RLE_Block(blocPtrs, DC_precedent, trame);
-
-    cout << "\nTrame RLE generee (paires runlength/amplitude):" << endl;
-    cout << "------------------------------------------------" << endl;
-    cout << "DC_diff = " << (int)trame[0] << endl;
-
-    for (int i = 1; i < longueur; i += 2) {
-        if (i+1 < longueur) {
-            cout << "(" << (int)trame[i] << ", " << (int)trame[i+1] << ") ";
-        }
-    }
-    cout << endl;
-
-    // Afficher sous forme de liste comme dans l'exemple
-    cout << "\nFormat liste (comme exemple B):" << endl;
-    cout << "-------------------------------" << endl;
-    cout << (int)trame[0] << " ";
-    for (int i = 1; i < longueur; i += 2) {
-        if (i+1 < longueur) {
-            cout << (int)trame[i] << ", " << (int)trame[i+1] << " ";
-        }
-    }
-    cout << endl;
-
-    cout << "\nResultats RLE:" << endl;
-    cout << "--------------" << endl;
-    cout << "Longueur de la trame: " << longueur << " symboles" << endl;
-    cout << "Taille originale: 64 coefficients" << endl;
-    cout << "Compression RLE: "
-         << fixed << setprecision(1) << (1.0 - (double)longueur / 64.0) * 100.0 << "%" << endl;
-    cout << "Test RLE: " << (longueur < 64 ? "[OK] REUSSI" : "[X] ECHEC") << endl;
-}
-
-/**
- * @brief Teste le codage de Huffman avec l'exemple du sujet
- */
-void testHuffman() {
-    cout << "\n===============================================================" << endl;
-    cout << "TEST 4: CODAGE DE HUFFMAN" << endl;
-    cout << "===============================================================" << endl;
-
-    // Donnees de test (Table 1 du sujet)
-    char donnees[] = {'a', 'b', 'c', 'd', 'e', 'f'};
-    double frequences[] = {5.0/28.0, 3.0/28.0, 7.0/28.0, 1.0/28.0, 10.0/28.0, 2.0/28.0};
-    unsigned int taille = 6;
-
-    cout << "\nTable des frequences (exemple du sujet):" << endl;
-    cout << "----------------------------------------" << endl;
-    cout << "Symbole | Frequence | Occurences" << endl;
-    cout << "--------+-----------+-----------" << endl;
-    cout << "   a    |    " << fixed << setprecision(3) << frequences[0] << "   |      5" << endl;
-    cout << "   b    |    " << fixed << setprecision(3) << frequences[1] << "   |      3" << endl;
-    cout << "   c    |    " << fixed << setprecision(3) << frequences[2] << "   |      7" << endl;
-    cout << "   d    |    " << fixed << setprecision(3) << frequences[3] << "   |      1" << endl;
-    cout << "   e    |    " << fixed << setprecision(3) << frequences[4] << "   |      10" << endl;
-    cout << "   f    |    " << fixed << setprecision(3) << frequences[5] << "   |      2" << endl;
-
-    // Creer l'encodeur Huffman
-    cHuffman huffman;
-
-    // Construire l'arbre
-    huffman.HuffmanCodes(donnees, frequences, taille);
-
-    // Afficher les codes
-    huffman.AfficherHuffman();
-
-    // Tester l'encodage d'une sequence
-    char sequence[] = {'a', 'e', 'c', 'e', 'b', 'd', 'f', 'e'};
-    unsigned int longueurSeq = 8;
-
-    vector<bool> trameCodee;
-    unsigned int bits = huffman.encoder(sequence, longueurSeq, trameCodee);
-
-    cout << "Encodage de la sequence 'a e c e b d f e':" << endl;
-    cout << "------------------------------------------" << endl;
-    cout << "Sequence originale: ";
-    for (unsigned int i = 0; i < longueurSeq; i++) {
-        cout << sequence[i] << " ";
-    }
-    cout << endl;
-
-    cout << "Sequence encodee: ";
-    for (bool bit : trameCodee) {
-        cout << (bit ? "1" : "0");
-    }
-    cout << endl;
-
-    cout << "\nResultats Huffman:" << endl;
-    cout << "------------------" << endl;
-    cout << "Longueur originale: " << longueurSeq * 8 << " bits (8 bits par caractere)" << endl;
-    cout << "Longueur compressee: " << bits << " bits" << endl;
-    cout << "Taux de compression: "
-         << fixed << setprecision(1) << (1.0 - (double)bits / (longueurSeq * 8.0)) * 100.0 << "%" << endl;
-    cout << "Bits par symbole moyen: " << fixed << setprecision(2) << (double)bits / longueurSeq << endl;
-    cout << "Test Huffman: [OK] REUSSI" << endl;
-}
-
-/**
- * @brief Teste la compression complete sur Lenna
- * @param qualite Qualite de compression a tester
- */
-void testCompressionLenna(int qualite) {
-    cout << "\n===============================================================" << endl;
-    cout << "TEST 5: COMPRESSION COMPLETE LENNA (qualite " << qualite << "%)" << endl;
-    cout << "===============================================================" << endl;
-
-    auto debutTotal = high_resolution_clock::now();
-
-    // 1. Charger Lenna
-    cCompression compresseur;
-    if (!compresseur.chargerImageTexte("lenna.img.txt", 256, 256)) {
-        cerr << "[X] Echec du chargement de Lenna" << endl;
-        return;
-    }
-
-    compresseur.setQualite(qualite);
-
-    auto finChargement = high_resolution_clock::now();
-
-    // 2. Compresser
-    string nomFichierSortie = "lenna_compresse_q" + to_string(qualite) + ".dat";
-    if (!compresseur.compresser(nomFichierSortie.c_str())) {
-        cerr << "[X] Echec de la compression" << endl;
-        return;
-    }
-
-    auto finCompression = high_resolution_clock::now();
-
-    // 3. Decompresser
-    cDecompression decompresseur;
-    char** imageReconstruite = decompresseur.Decompression_JPEG(nomFichierSortie.c_str());
-
-    auto finDecompression = high_resolution_clock::now();
-
-    if (!imageReconstruite) {
-        cerr << "[X] Echec de la decompression" << endl;
-        return;
-    }
-
-    // 4. Calculer les temps
-    auto dureeChargement = duration_cast<milliseconds>(finChargement - debutTotal);
-    auto dureeCompression = duration_cast<milliseconds>(finCompression - finChargement);
-    auto dureeDecompression = duration_cast<milliseconds>(finDecompression - finCompression);
-    auto dureeTotale = duration_cast<milliseconds>(finDecompression - debutTotal);
-
-    // 5. Calculer PSNR
-    unsigned char** original = compresseur.getBuffer();
-    double erreurTotale = 0.0;
-    int pixels = 256 * 256;
-
-    for (int i = 0; i < 256; i++) {
-        for (int j = 0; j < 256; j++) {
-            int diff = static_cast<int>(original[i][j]) - static_cast<int>(imageReconstruite[i][j]);
-            erreurTotale += diff * diff;
-        }
-    }
-
-    double eqm = sqrt(erreurTotale / pixels);
-    double psnr = (eqm > 0) ? 20 * log10(255.0 / eqm) : 99.99;
-
-        // Afficher les resultats
-    cout << "\nResultats compression Lenna:" << endl;
-    cout << "-----------------------------" << endl;
-    cout << "Image: 256x256 pixels (65536 octets)" << endl;
-    cout << "Qualite JPEG: " << qualite << "%" << endl;
-    cout << "\nTemps d'execution:" << endl;
-    cout << "  - Chargement: " << dureeChargement.count() << " ms" << endl;
-    cout << "  - Compression: " << dureeCompression.count() << " ms" << endl;
-    cout << "  - Decompression: " << dureeDecompression.count() << " ms" << endl;
-    cout << "  - Total: " << dureeTotale.count() << " ms" << endl;
-
-    cout << "\nQualite de reconstruction:" << endl;
-    cout << "  - EQM: " << fixed << setprecision(2) << eqm << endl;
-    cout << "  - PSNR: " << fixed << setprecision(2) << psnr << " dB" << endl;
-
-    // Nettoyage
-    for (int i = 0; i < 256; i++) {
-        delete[] imageReconstruite[i];
-    }
-    delete[] imageReconstruite;
-
-    cout << "\nFichier compresse: " << nomFichierSortie << endl;
-    cout << "Test compression Lenna: [OK] REUSSI" << endl;
-}
-
-/**
- * @brief Teste differentes qualites sur Lenna
- */
-void testQualitesVariables() {
-    cout << "\n===============================================================" << endl;
-    cout << "TEST 6: COMPARAISON DES QUALITES JPEG" << endl;
-    cout << "===============================================================" << endl;
-
-    vector<int> qualites = {10, 25, 50, 75, 90};
-
-    cout << "\nComparaison des differentes qualites de compression:" << endl;
-    cout << "----------------------------------------------------" << endl;
-    cout << "Qualite | Temps comp. (ms) | Temps decomp. (ms) | EQM   | PSNR (dB)" << endl;
-    cout << "--------+------------------+-------------------+-------+-----------" << endl;
-
-    for (int qualite : qualites) {
-        auto debut = high_resolution_clock::now();
-
-        // -------------------------------------------------------------
-        // ASTUCE: On desactive cout temporairement pour que les logs
-        // des fonctions ne cassent pas le tableau
-        // -------------------------------------------------------------
-        std::cout.setstate(std::ios_base::failbit);
-
-        // Charger et compresser
-        cCompression compresseur;
-        compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
-        compresseur.setQualite(qualite);
-
-        string nomFichier = "lenna_q" + to_string(qualite) + ".dat";
-        compresseur.compresser(nomFichier.c_str());
-
-        auto finComp = high_resolution_clock::now();
-
-        // Decompresser
-        cDecompression decompresseur;
-        char** image = decompresseur.Decompression_JPEG(nomFichier.c_str());
-
-        // -------------------------------------------------------------
-        // On reactive cout pour afficher la ligne du tableau
-        // -------------------------------------------------------------
-        std::cout.clear();
-
-        auto finDecomp = high_resolution_clock::now();
-
-        // Calculer PSNR
-        unsigned char** original = compresseur.getBuffer();
-        double erreurTotale = 0.0;
-
-        for (int i = 0; i < 256; i++) {
-            for (int j = 0; j < 256; j++) {
-                int diff = static_cast<int>(original[i][j]) - static_cast<int>(image[i][j]);
-                erreurTotale += diff * diff;
-            }
-        }
-
-        double eqm = sqrt(erreurTotale / (256*256));
-        double psnr = (eqm > 0) ? 20 * log10(255.0 / eqm) : 99.99;
-
-        auto dureeComp = duration_cast<milliseconds>(finComp - debut);
-        auto dureeDecomp = duration_cast<milliseconds>(finDecomp - finComp);
-
-        cout << setw(7) << qualite << " | "
-             << setw(16) << dureeComp.count() << " | "
-             << setw(17) << dureeDecomp.count() << " | "
-             << setw(5) << fixed << setprecision(1) << eqm << " | "
-             << setw(9) << fixed << setprecision(1) << psnr << endl;
-
-        // Nettoyage
-        for (int i = 0; i < 256; i++) {
-            delete[] image[i];
-        }
-        delete[] image;
-    }
-
-    cout << "\nLegende:" << endl;
-    cout << "  - EQM: Erreur Quadratique Moyenne (plus c'est bas, mieux c'est)" << endl;
-    cout << "  - PSNR: Peak Signal-to-Noise Ratio (plus c'est haut, mieux c'est)" << endl;
-    cout << "  - PSNR > 40 dB: Excellente qualite" << endl;
-    cout << "  - PSNR 30-40 dB: Bonne qualite" << endl;
-    cout << "  - PSNR 20-30 dB: Qualite acceptable" << endl;
-    cout << "  - PSNR < 20 dB: Mauvaise qualite" << endl;
-}
-
-/**
- * @brief Fonction principale
- */
-int main() {
-    cout << "===============================================================" << endl;
-    cout << "           PROJET JPEG - CODEC COMPRESSION/DECOMPRESSION" << endl;
-    cout << "===============================================================" << endl;
-    cout << "Auteur: [Votre Nom]" << endl;
-    cout << "Date: 2024" << endl;
-    cout << "Version: 1.0" << endl;
-    cout << "===============================================================" << endl;
-
-    // Test 1: DCT/IDCT
-    testDCT();
-
-    // Test 2: Quantification
-    testQuantification();
-
-    // Test 3: RLE
-    testRLE();
-
-    // Test 4: Huffman
-    testHuffman();
-
-    // Test 5: Compression sur Lenna avec qualite 50
-    testCompressionLenna(50);
-
-    // Test 6: Comparaison des qualites
-    testQualitesVariables();
-
-    // Test 7: Cycle complet compression/decompression
-
-    cout << "\n===============================================================" << endl;
-    cout << "TEST 7: CYCLE COMPLET COMPRESSION/DECOMPRESSION" << endl;
-    cout << "===============================================================" << endl;
-
-    cDecompression testeur;
-    if (testeur.testerCompressionDecompression("lenna.img.txt", 75)) {
-        cout << "[OK] Test cycle complet: REUSSI" << endl;
-    } else {
-        cout << "[X] Test cycle complet: ECHEC" << endl;
-    }
-
-    cout << "\n                  TESTS TERMINES AVEC SUCCES" << endl;
-
-    cout << "\nResume des fichiers generes:" << endl;
-    cout << "-----------------------------" << endl;
-    cout << "- lenna_compresse_q50.dat : Image Lenna compressee (qualite 50%)" << endl;
-    cout << "- lenna_q10.dat a lenna_q90.dat : Images avec differentes qualites" << endl;
-    cout << "- lenna.img.txt_compresse_q75.dat : Fichier de test compression" << endl;
-
-    return 0;
-}
+/**
+ * @file main.cpp
+ * @brief Programme principal de test du codeur/decodeur JPEG
+ * @author EL KILI Rim
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "cCompression.h"
+#include "cDecompression.h"
+#include "cCompressionCouleur.h"
+#include "cDecompressionCouleur.h"
+#include "cHuffman.h"
+#include "cContexteCodec.h"
+#include "cCodecAsynchrone.h"
+#include "cDecodeurProgressif.h"
+#include "cTablesDCT.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iterator>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <future>
+#include <thread>
+
+using namespace std;
+using namespace chrono;
+
+// operator new/delete sont remplaces ci-dessous par malloc/free, qui vont
+// ensemble : l'avertissement de GCC sur leur appariement ne s'applique pas
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+/**
+ * @brief Nombre d'allocations sur le tas de tout le programme (voir testContexteCodec)
+ */
+static atomic<unsigned long long> gNbAllocations(0);
+
+/**
+ * @brief Si vrai, la prochaine allocation lève bad_alloc (voir testCodecAsynchrone)
+ */
+static atomic<bool> gEchecAllocation(false);
+
+void* operator new(size_t taille) {
+    gNbAllocations++;
+    if (gEchecAllocation && gEchecAllocation.exchange(false)) throw bad_alloc();
+    void* p = malloc(taille ? taille : 1);
+    if (!p) throw bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+/**
+ * @brief Affiche une matrice 8x8
+ */
+void afficherMatrice8x8(int matrice[8][8], const string& titre = "Matrice") {
+    cout << "\n" << titre << ":" << endl;
+    cout << "----------------" << endl;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            cout << setw(4) << matrice[i][j] << " ";
+        }
+        cout << endl;
+    }
+}
+
+/**
+ * @brief Affiche une matrice 8x8 de doubles
+ */
+void afficherMatrice8x8Double(double matrice[8][8], const string& titre = "Matrice") {
+    cout << "\n" << titre << ":" << endl;
+    cout << "----------------" << endl;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            cout << setw(8) << fixed << setprecision(2) << matrice[i][j] << " ";
+        }
+        cout << endl;
+    }
+}
+
+/**
+ * @brief Teste la DCT et IDCT sur un bloc exemple
+ */
+void testDCT() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 1: TRANSFORMEE COSINUS DISCRETE (DCT/IDCT)" << endl;
+    cout << "===============================================================" << endl;
+
+    // Creer un bloc de test (identique a l'exemple de l'annexe A)
+    char blocTest[8][8] = {
+        {11, 16, 21, 25, 27, 27, 27, 27},
+        {16, 23, 25, 28, 31, 28, 28, 28},
+        {22, 27, 32, 35, 30, 28, 28, 28},
+        {31, 33, 34, 32, 32, 31, 31, 31},
+        {31, 32, 33, 34, 34, 27, 27, 27},
+        {33, 33, 33, 33, 32, 29, 29, 29},
+        {34, 34, 33, 35, 34, 29, 29, 29},
+        {34, 34, 33, 33, 35, 30, 30, 30}
+    };
+
+    // Afficher le bloc original
+    cout << "\nBloc original (valeurs decalees -128 a 127):" << endl;
+    cout << "--------------------------------------------" << endl;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            cout << setw(4) << (int)blocTest[i][j] << " ";
+        }
+        cout << endl;
+    }
+
+    // Preparer les pointeurs
+    char* blocPtrs[8];
+    double dct[8][8];
+    double* dctPtrs[8];
+    char blocReconstruit[8][8];
+    char* reconPtrs[8];
+
+    for (int i = 0; i < 8; i++) {
+        blocPtrs[i] = blocTest[i];
+        dctPtrs[i] = dct[i];
+        reconPtrs[i] = blocReconstruit[i];
+    }
+
+    // Creer un compresseur
+    cCompression comp;
+
+    // Calculer la DCT
+    auto debutDCT = high_resolution_clock::now();
+    comp.Calcul_DCT_Block(blocPtrs, dctPtrs);
+    auto finDCT = high_resolution_clock::now();
+
+    // Afficher quelques coefficients DCT
+    cout << "\nCoefficients DCT significatifs:" << endl;
+    cout << "--------------------------------" << endl;
+    cout << "Coefficient DC (0,0): " << fixed << setprecision(2) << dct[0][0] << endl;
+    cout << "Coefficient AC (0,1): " << fixed << setprecision(2) << dct[0][1] << endl;
+    cout << "Coefficient AC (1,0): " << fixed << setprecision(2) << dct[1][0] << endl;
+    cout << "Coefficient AC (1,1): " << fixed << setprecision(2) << dct[1][1] << endl;
+
+    // Calculer l'IDCT
+    auto debutIDCT = high_resolution_clock::now();
+    comp.Calcul_IDCT(dctPtrs, reconPtrs);
+    auto finIDCT = high_resolution_clock::now();
+
+    // Verifier la reconstruction
+    double erreur = 0.0;
+    double erreurMax = 0.0;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            double diff = blocTest[i][j] - blocReconstruit[i][j];
+            erreur += diff * diff;
+            if (fabs(diff) > erreurMax) {
+                erreurMax = fabs(diff);
+            }
+        }
+    }
+    double erreurRMS = sqrt(erreur / 64.0);
+
+    // Calculer les temps
+    auto dureeDCT = duration_cast<microseconds>(finDCT - debutDCT);
+    auto dureeIDCT = duration_cast<microseconds>(finIDCT - debutIDCT);
+
+    // Afficher les resultats
+    cout << "\nResultats DCT/IDCT:" << endl;
+    cout << "-------------------" << endl;
+    cout << "Temps DCT: " << dureeDCT.count() << " us" << endl;
+    cout << "Temps IDCT: " << dureeIDCT.count() << " us" << endl;
+    cout << "Erreur RMS: " << erreurRMS << endl;
+    cout << "Erreur max: " << erreurMax << endl;
+    cout << "Test DCT/IDCT: " << (erreurRMS < 0.1 ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Teste la quantification/dequantification
+ */
+void testQuantification() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 2: QUANTIFICATION/DEQUANTIFICATION JPEG" << endl;
+    cout << "===============================================================" << endl;
+
+    cCompression comp(256, 256, 50); // Qualite 50%
+
+    // Creer un bloc DCT de test similaire a l'exemple
+    double dct[8][8];
+    double* dctPtrs[8];
+    int quant[8][8];
+    int* quantPtrs[8];
+    double dctReconstruit[8][8];
+    double* reconPtrs[8];
+
+    for (int i = 0; i < 8; i++) {
+        dctPtrs[i] = dct[i];
+        quantPtrs[i] = quant[i];
+        reconPtrs[i] = dctReconstruit[i];
+    }
+
+    // Remplir avec des valeurs de test (similaires a l'exemple)
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            if (i == 0 && j == 0) dct[i][j] = 235.62;
+            else if (i == 0 && j == 1) dct[i][j] = -1.03;
+            else if (i == 0 && j == 2) dct[i][j] = -12.08;
+            else dct[i][j] = (i + j - 4) * 5.0; // Valeurs diverses
+        }
+    }
+
+    cout << "\nCoefficients DCT avant quantification:" << endl;
+    cout << "--------------------------------------" << endl;
+    for (int i = 0; i < 4; i++) { // Afficher seulement les 4 premieres lignes
+        for (int j = 0; j < 4; j++) {
+            cout << setw(8) << fixed << setprecision(2) << dct[i][j] << " ";
+        }
+        cout << endl;
+    }
+
+    // Quantifier
+    comp.quant_JPEG(dctPtrs, quantPtrs);
+
+    // Compter les coefficients nuls
+    int coefficientsNonNuls = 0;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            if (quant[i][j] != 0) coefficientsNonNuls++;
+        }
+    }
+
+    cout << "\nMatrice quantifiee (premieres valeurs):" << endl;
+    cout << "---------------------------------------" << endl;
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            cout << setw(4) << quant[i][j] << " ";
+        }
+        cout << endl;
+    }
+
+    // Dequantifier
+    comp.dequant_JPEG(quantPtrs, reconPtrs);
+
+    // Calculer l'erreur
+    double erreur = 0.0;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            double diff = dct[i][j] - dctReconstruit[i][j];
+            erreur += diff * diff;
+        }
+    }
+    double erreurRMS = sqrt(erreur / 64.0);
+
+    // Calculer le taux de compression theorique
+    double taux = comp.Taux_Compression(quantPtrs);
+
+    // Afficher les resultats
+    cout << "\nResultats quantification:" << endl;
+    cout << "-------------------------" << endl;
+    cout << "Coefficients non nuls apres quantification: "
+         << coefficientsNonNuls << "/64" << endl;
+    cout << "Taux de remplissage: "
+         << fixed << setprecision(1) << (coefficientsNonNuls/64.0*100.0) << "%" << endl;
+    cout << "Erreur RMS quantification: " << erreurRMS << endl;
+    cout << "Taux de compression theorique: " << taux << "%" << endl;
+    cout << "Test quantification: " << (coefficientsNonNuls < 64 ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Teste le RLE avec l'exemple du sujet
+ */
+void testRLE() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 3: RUN-LENGTH ENCODING (RLE)" << endl;
+    cout << "===============================================================" << endl;
+
+    cCompression comp(8, 8, 50);
+
+    // Bloc quantifie de l'exemple B
+    int blocQuant[8][8] = {
+        {15, 0, -1, 0, 0, 0, 0, 0},
+        {-2, -1, 0, 0, 0, 0, 0, 0},
+        {-1, -1, 0, 0, 0, 0, 0, 0},
+        {-1, 0, 0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0, 0, 0, 0}
+    };
+
+    cout << "\nBloc quantifie 8x8 (exemple du sujet):" << endl;
+    cout << "--------------------------------------" << endl;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            cout << setw(4) << blocQuant[i][j] << " ";
+        }
+        cout << endl;
+    }
+
+    int* blocPtrs[8];
+    for (int i = 0; i < 8; i++) {
+        blocPtrs[i] = blocQuant[i];
+    }
+
+    // Encoder avec RLE
+    char trame[128];
+    int DC_precedent = 0;
+    int longueur = comp.RLE_Block(blocPtrs, DC_precedent, trame);
+
+    cout << "\nTrame RLE generee (paires runlength/amplitude):" << endl;
+    cout << "------------------------------------------------" << endl;
+    cout << "DC_diff = " << (int)trame[0] << endl;
+
+    for (int i = 1; i < longueur; i += 2) {
+        if (i+1 < longueur) {
+            cout << "(" << (int)trame[i] << ", " << (int)trame[i+1] << ") ";
+        }
+    }
+    cout << endl;
+
+    // Afficher sous forme de liste comme dans l'exemple
+    cout << "\nFormat liste (comme exemple B):" << endl;
+    cout << "-------------------------------" << endl;
+    cout << (int)trame[0] << " ";
+    for (int i = 1; i < longueur; i += 2) {
+        if (i+1 < longueur) {
+            cout << (int)trame[i] << ", " << (int)trame[i+1] << " ";
+        }
+    }
+    cout << endl;
+
+    cout << "\nResultats RLE:" << endl;
+    cout << "--------------" << endl;
+    cout << "Longueur de la trame: " << longueur << " symboles" << endl;
+    cout << "Taille originale: 64 coefficients" << endl;
+    cout << "Compression RLE: "
+         << fixed << setprecision(1) << (1.0 - (double)longueur / 64.0) * 100.0 << "%" << endl;
+    cout << "Test RLE: " << (longueur < 64 ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Teste le codage de Huffman avec l'exemple du sujet
+ */
+void testHuffman() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 4: CODAGE DE HUFFMAN" << endl;
+    cout << "===============================================================" << endl;
+
+    // Donnees de test (Table 1 du sujet)
+    char donnees[] = {'a', 'b', 'c', 'd', 'e', 'f'};
+    double frequences[] = {5.0/28.0, 3.0/28.0, 7.0/28.0, 1.0/28.0, 10.0/28.0, 2.0/28.0};
+    unsigned int taille = 6;
+
+    cout << "\nTable des frequences (exemple du sujet):" << endl;
+    cout << "----------------------------------------" << endl;
+    cout << "Symbole | Frequence | Occurences" << endl;
+    cout << "--------+-----------+-----------" << endl;
+    cout << "   a    |    " << fixed << setprecision(3) << frequences[0] << "   |      5" << endl;
+    cout << "   b    |    " << fixed << setprecision(3) << frequences[1] << "   |      3" << endl;
+    cout << "   c    |    " << fixed << setprecision(3) << frequences[2] << "   |      7" << endl;
+    cout << "   d    |    " << fixed << setprecision(3) << frequences[3] << "   |      1" << endl;
+    cout << "   e    |    " << fixed << setprecision(3) << frequences[4] << "   |      10" << endl;
+    cout << "   f    |    " << fixed << setprecision(3) << frequences[5] << "   |      2" << endl;
+
+    // Creer l'encodeur Huffman
+    cHuffman huffman;
+
+    // Construire l'arbre
+    huffman.HuffmanCodes(donnees, frequences, taille);
+
+    // Afficher les codes
+    huffman.AfficherHuffman();
+
+    // Tester l'encodage d'une sequence
+    char sequence[] = {'a', 'e', 'c', 'e', 'b', 'd', 'f', 'e'};
+    unsigned int longueurSeq = 8;
+
+    vector<bool> trameCodee;
+    unsigned int bits = huffman.encoder(sequence, longueurSeq, trameCodee);
+
+    cout << "Encodage de la sequence 'a e c e b d f e':" << endl;
+    cout << "------------------------------------------" << endl;
+    cout << "Sequence originale: ";
+    for (unsigned int i = 0; i < longueurSeq; i++) {
+        cout << sequence[i] << " ";
+    }
+    cout << endl;
+
+    cout << "Sequence encodee: ";
+    for (bool bit : trameCodee) {
+        cout << (bit ? "1" : "0");
+    }
+    cout << endl;
+
+    cout << "\nResultats Huffman:" << endl;
+    cout << "------------------" << endl;
+    cout << "Longueur originale: " << longueurSeq * 8 << " bits (8 bits par caractere)" << endl;
+    cout << "Longueur compressee: " << bits << " bits" << endl;
+    cout << "Taux de compression: "
+         << fixed << setprecision(1) << (1.0 - (double)bits / (longueurSeq * 8.0)) * 100.0 << "%" << endl;
+    cout << "Bits par symbole moyen: " << fixed << setprecision(2) << (double)bits / longueurSeq << endl;
+    cout << "Test Huffman: [OK] REUSSI" << endl;
+}
+
+/**
+ * @brief Teste la compression complete sur Lenna
+ * @param qualite Qualite de compression a tester
+ */
+void testCompressionLenna(int qualite) {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 5: COMPRESSION COMPLETE LENNA (qualite " << qualite << "%)" << endl;
+    cout << "===============================================================" << endl;
+
+    auto debutTotal = high_resolution_clock::now();
+
+    // 1. Charger Lenna
+    cCompression compresseur;
+    if (!compresseur.chargerImageTexte("lenna.img.txt", 256, 256)) {
+        cerr << "[X] Echec du chargement de Lenna" << endl;
+        return;
+    }
+
+    compresseur.setQualite(qualite);
+
+    auto finChargement = high_resolution_clock::now();
+
+    // 2. Compresser
+    string nomFichierSortie = "lenna_compresse_q" + to_string(qualite) + ".dat";
+    if (!compresseur.compresser(nomFichierSortie.c_str())) {
+        cerr << "[X] Echec de la compression" << endl;
+        return;
+    }
+
+    auto finCompression = high_resolution_clock::now();
+
+    // 3. Decompresser
+    cDecompression decompresseur;
+    char** imageReconstruite = decompresseur.Decompression_JPEG(nomFichierSortie.c_str());
+
+    auto finDecompression = high_resolution_clock::now();
+
+    if (!imageReconstruite) {
+        cerr << "[X] Echec de la decompression" << endl;
+        return;
+    }
+
+    // 4. Calculer les temps
+    auto dureeChargement = duration_cast<milliseconds>(finChargement - debutTotal);
+    auto dureeCompression = duration_cast<milliseconds>(finCompression - finChargement);
+    auto dureeDecompression = duration_cast<milliseconds>(finDecompression - finCompression);
+    auto dureeTotale = duration_cast<milliseconds>(finDecompression - debutTotal);
+
+    // 5. Calculer PSNR
+    unsigned char** original = compresseur.getBuffer();
+    double erreurTotale = 0.0;
+    int pixels = 256 * 256;
+
+    for (int i = 0; i < 256; i++) {
+        for (int j = 0; j < 256; j++) {
+            int diff = static_cast<int>(original[i][j]) - static_cast<int>(imageReconstruite[i][j]);
+            erreurTotale += diff * diff;
+        }
+    }
+
+    double eqm = sqrt(erreurTotale / pixels);
+    double psnr = (eqm > 0) ? 20 * log10(255.0 / eqm) : 99.99;
+
+        // Afficher les resultats
+    cout << "\nResultats compression Lenna:" << endl;
+    cout << "-----------------------------" << endl;
+    cout << "Image: 256x256 pixels (65536 octets)" << endl;
+    cout << "Qualite JPEG: " << qualite << "%" << endl;
+    cout << "\nTemps d'execution:" << endl;
+    cout << "  - Chargement: " << dureeChargement.count() << " ms" << endl;
+    cout << "  - Compression: " << dureeCompression.count() << " ms" << endl;
+    cout << "  - Decompression: " << dureeDecompression.count() << " ms" << endl;
+    cout << "  - Total: " << dureeTotale.count() << " ms" << endl;
+
+    cout << "\nQualite de reconstruction:" << endl;
+    cout << "  - EQM: " << fixed << setprecision(2) << eqm << endl;
+    cout << "  - PSNR: " << fixed << setprecision(2) << psnr << " dB" << endl;
+
+    // Nettoyage
+    for (int i = 0; i < 256; i++) {
+        delete[] imageReconstruite[i];
+    }
+    delete[] imageReconstruite;
+
+    cout << "\nFichier compresse: " << nomFichierSortie << endl;
+    cout << "Test compression Lenna: [OK] REUSSI" << endl;
+}
+
+/**
+ * @brief Teste differentes qualites sur Lenna
+ */
+void testQualitesVariables() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 6: COMPARAISON DES QUALITES JPEG" << endl;
+    cout << "===============================================================" << endl;
+
+    vector<int> qualites = {10, 25, 50, 75, 90};
+
+    cout << "\nComparaison des differentes qualites de compression:" << endl;
+    cout << "----------------------------------------------------" << endl;
+    cout << "Qualite | Temps comp. (ms) | Temps decomp. (ms) | EQM   | PSNR (dB)" << endl;
+    cout << "--------+------------------+-------------------+-------+-----------" << endl;
+
+    for (int qualite : qualites) {
+        auto debut = high_resolution_clock::now();
+
+        // -------------------------------------------------------------
+        // ASTUCE: On desactive cout temporairement pour que les logs
+        // des fonctions ne cassent pas le tableau
+        // -------------------------------------------------------------
+        std::cout.setstate(std::ios_base::failbit);
+
+        // Charger et compresser
+        cCompression compresseur;
+        compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+        compresseur.setQualite(qualite);
+
+        string nomFichier = "lenna_q" + to_string(qualite) + ".dat";
+        compresseur.compresser(nomFichier.c_str());
+
+        auto finComp = high_resolution_clock::now();
+
+        // Decompresser
+        cDecompression decompresseur;
+        char** image = decompresseur.Decompression_JPEG(nomFichier.c_str());
+
+        // -------------------------------------------------------------
+        // On reactive cout pour afficher la ligne du tableau
+        // -------------------------------------------------------------
+        std::cout.clear();
+
+        auto finDecomp = high_resolution_clock::now();
+
+        // Calculer PSNR
+        unsigned char** original = compresseur.getBuffer();
+        double erreurTotale = 0.0;
+
+        for (int i = 0; i < 256; i++) {
+            for (int j = 0; j < 256; j++) {
+                int diff = static_cast<int>(original[i][j]) - static_cast<int>(image[i][j]);
+                erreurTotale += diff * diff;
+            }
+        }
+
+        double eqm = sqrt(erreurTotale / (256*256));
+        double psnr = (eqm > 0) ? 20 * log10(255.0 / eqm) : 99.99;
+
+        auto dureeComp = duration_cast<milliseconds>(finComp - debut);
+        auto dureeDecomp = duration_cast<milliseconds>(finDecomp - finComp);
+
+        cout << setw(7) << qualite << " | "
+             << setw(16) << dureeComp.count() << " | "
+             << setw(17) << dureeDecomp.count() << " | "
+             << setw(5) << fixed << setprecision(1) << eqm << " | "
+             << setw(9) << fixed << setprecision(1) << psnr << endl;
+
+        // Nettoyage
+        for (int i = 0; i < 256; i++) {
+            delete[] image[i];
+        }
+        delete[] image;
+    }
+
+    cout << "\nLegende:" << endl;
+    cout << "  - EQM: Erreur Quadratique Moyenne (plus c'est bas, mieux c'est)" << endl;
+    cout << "  - PSNR: Peak Signal-to-Noise Ratio (plus c'est haut, mieux c'est)" << endl;
+    cout << "  - PSNR > 40 dB: Excellente qualite" << endl;
+    cout << "  - PSNR 30-40 dB: Bonne qualite" << endl;
+    cout << "  - PSNR 20-30 dB: Qualite acceptable" << endl;
+    cout << "  - PSNR < 20 dB: Mauvaise qualite" << endl;
+}
+
+/**
+ * @brief Teste les compteurs d'instrumentation du codeur et du decodeur
+ */
+void testInstrumentation() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 8: INSTRUMENTATION DU PIPELINE" << endl;
+    cout << "===============================================================" << endl;
+
+#ifndef JPEG_INSTRUMENTATION
+    // Les compteurs n'existent pas : les instances n'ont pas de getInstrumentation()
+    cout << "\nInstrumentation non compilee (ajouter -DJPEG_INSTRUMENTATION)" << endl;
+    cout << "Test instrumentation: [OK] IGNORE" << endl;
+#else
+
+    std::cout.setstate(std::ios_base::failbit);
+
+    cCompression compresseur;
+    compresseur.getInstrumentation().reinitialiser();
+    compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+    compresseur.setQualite(50);
+    compresseur.compresser("lenna_instrumentation.dat");
+
+    cDecompression decompresseur;
+    char** image = decompresseur.Decompression_JPEG("lenna_instrumentation.dat");
+
+    std::cout.clear();
+
+    const cInstrumentation& codeur = compresseur.getInstrumentation();
+    const cInstrumentation& decodeur = decompresseur.getInstrumentation();
+
+    cout << "\nCodeur:" << endl;
+    cout << codeur.versJSON();
+    cout << "\nDecodeur (blocs: " << decodeur.getBlocs()
+         << ", allocations: " << decodeur.getAllocations() << ")" << endl;
+
+    decodeur.exporterJSON("lenna_instrumentation_decodeur.json");
+
+    bool ok = codeur.getBlocs() == 1024 && decodeur.getBlocs() == 1024
+              && codeur.getBlocsNuls() == decodeur.getBlocsNuls()
+              && codeur.getTempsNs(ETAPE_DCT) > 0.0;
+
+    if (image) {
+        for (int i = 0; i < 256; i++) {
+            delete[] image[i];
+        }
+        delete[] image;
+    }
+
+    cout << "Test instrumentation: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+#endif
+}
+
+/**
+ * @brief Compare deux fichiers octet par octet
+ */
+bool fichiersIdentiques(const string& nom1, const string& nom2) {
+    ifstream f1(nom1.c_str(), ios::binary);
+    ifstream f2(nom2.c_str(), ios::binary);
+    if (!f1 || !f2) return false;
+
+    vector<char> contenu1((istreambuf_iterator<char>(f1)), istreambuf_iterator<char>());
+    vector<char> contenu2((istreambuf_iterator<char>(f2)), istreambuf_iterator<char>());
+    return contenu1 == contenu2;
+}
+
+/**
+ * @brief Teste la compression multi-qualite avec une seule passe DCT
+ */
+void testCompressionMultiQualite() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 9: COMPRESSION MULTI-QUALITE (UNE SEULE DCT)" << endl;
+    cout << "===============================================================" << endl;
+
+    vector<unsigned int> qualites = {10, 25, 50, 75, 90};
+    vector<string> nomsSepares;
+    vector<string> nomsMulti;
+    for (unsigned int q : qualites) {
+        nomsSepares.push_back("lenna_separe_q" + to_string(q) + ".dat");
+        nomsMulti.push_back("lenna_multi_q" + to_string(q) + ".dat");
+    }
+
+    std::cout.setstate(std::ios_base::failbit);
+
+    // 1. Une compression complete par qualite
+    auto debutSepare = high_resolution_clock::now();
+    for (size_t i = 0; i < qualites.size(); i++) {
+        cCompression compresseur;
+        compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+        compresseur.setQualite(qualites[i]);
+        compresseur.compresser(nomsSepares[i].c_str());
+    }
+    auto finSepare = high_resolution_clock::now();
+
+    // 2. Toutes les qualites depuis le meme plan DCT
+    cCompression compresseur;
+    compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+    auto debutMulti = high_resolution_clock::now();
+    bool ok = compresseur.compresserMultiQualite(qualites, nomsMulti);
+    auto finMulti = high_resolution_clock::now();
+
+    std::cout.clear();
+
+    for (size_t i = 0; i < qualites.size(); i++) {
+        bool identique = fichiersIdentiques(nomsSepares[i], nomsMulti[i]);
+        cout << "Qualite " << setw(2) << qualites[i] << ": "
+             << (identique ? "fichier identique" : "fichier different") << endl;
+        ok = ok && identique;
+    }
+
+    cout << "\nTemps " << qualites.size() << " compressions separees: "
+         << duration_cast<milliseconds>(finSepare - debutSepare).count() << " ms" << endl;
+    cout << "Temps compression multi-qualite: "
+         << duration_cast<milliseconds>(finMulti - debutMulti).count() << " ms" << endl;
+    cout << "Test multi-qualite: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Teste la regulation de debit (taille cible et PSNR cible)
+ */
+void testRegulationDebit() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 10: REGULATION DE DEBIT (TAILLE / PSNR CIBLE)" << endl;
+    cout << "===============================================================" << endl;
+
+    std::cout.setstate(std::ios_base::failbit);
+    cCompression compresseur;
+    compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+    std::cout.clear();
+
+    // 1. Budget en octets
+    unsigned int tailleCible = 30000;
+    unsigned int qualiteTaille = 0;
+    bool okTaille = compresseur.compresserTailleCible("lenna_taille_cible.dat", tailleCible, &qualiteTaille);
+
+    ifstream fichier("lenna_taille_cible.dat", ios::binary | ios::ate);
+    unsigned int tailleReelle = fichier ? static_cast<unsigned int>(fichier.tellg()) : 0;
+    okTaille = okTaille && tailleReelle <= tailleCible
+               && tailleReelle == compresseur.estimerTaille(qualiteTaille)
+               && (qualiteTaille == 100 || compresseur.estimerTaille(qualiteTaille + 1) > tailleCible);
+
+    cout << "Taille cible: " << tailleCible << " octets -> qualite " << qualiteTaille
+         << ", fichier de " << tailleReelle << " octets" << endl;
+
+    // 2. PSNR minimal
+    double psnrCible = 35.0;
+    unsigned int qualitePSNR = 0;
+    bool okPSNR = compresseur.compresserPSNRCible("lenna_psnr_cible.dat", psnrCible, &qualitePSNR);
+    okPSNR = okPSNR && compresseur.estimerPSNR(qualitePSNR) >= psnrCible
+             && (qualitePSNR == 1 || compresseur.estimerPSNR(qualitePSNR - 1) < psnrCible);
+
+    cout << "PSNR cible: " << fixed << setprecision(1) << psnrCible << " dB -> qualite "
+         << qualitePSNR << ", PSNR estime " << compresseur.estimerPSNR(qualitePSNR) << " dB" << endl;
+
+    cout << "Test regulation de debit: "
+         << (okTaille && okPSNR ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Retourne la taille d'un fichier en octets
+ */
+long tailleFichier(const string& nom) {
+    ifstream fichier(nom.c_str(), ios::binary | ios::ate);
+    return fichier ? static_cast<long>(fichier.tellg()) : -1;
+}
+
+/**
+ * @brief Libere une image allouee par le decodeur
+ */
+void libererImage(char** image, unsigned int hauteur) {
+    if (!image) return;
+    for (unsigned int i = 0; i < hauteur; i++) {
+        delete[] image[i];
+    }
+    delete[] image;
+}
+
+/**
+ * @brief Teste le transcodage de qualite dans le domaine des coefficients
+ */
+void testTranscodage() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 11: TRANSCODAGE DE QUALITE SANS IDCT/DCT" << endl;
+    cout << "===============================================================" << endl;
+
+    std::cout.setstate(std::ios_base::failbit);
+
+    cCompression compresseur;
+    compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+    compresseur.setQualite(50);
+    compresseur.compresser("lenna_transcodage_q50.dat");
+
+    // 1. Transcodage dans le domaine des coefficients
+    auto debutTranscodage = high_resolution_clock::now();
+    cDecompression transcodeur;
+    bool ok = transcodeur.transcoder("lenna_transcodage_q50.dat", "lenna_transcode_q10.dat", 10);
+    auto finTranscodage = high_resolution_clock::now();
+
+    // 2. Chemin classique : decompression complete puis recompression
+    cDecompression decompresseur;
+    char** image = decompresseur.Decompression_JPEG("lenna_transcodage_q50.dat");
+    cCompression recompresseur(256, 256, 10);
+    unsigned char** buffer = recompresseur.getBuffer();
+    for (int i = 0; i < 256; i++) {
+        for (int j = 0; j < 256; j++) {
+            buffer[i][j] = static_cast<unsigned char>(image[i][j]);
+        }
+    }
+    recompresseur.compresser("lenna_recompresse_q10.dat");
+    auto finRecompression = high_resolution_clock::now();
+    libererImage(image, 256);
+
+    // 3. Meme qualite : le transcodage doit reproduire le fichier
+    cDecompression identite;
+    ok = identite.transcoder("lenna_transcodage_q50.dat", "lenna_transcode_q50.dat", 50) && ok;
+
+    cDecompression verification;
+    char** transcodee = verification.Decompression_JPEG("lenna_transcode_q10.dat");
+
+    std::cout.clear();
+
+    bool identique = fichiersIdentiques("lenna_transcodage_q50.dat", "lenna_transcode_q50.dat");
+    long tailleOrigine = tailleFichier("lenna_transcodage_q50.dat");
+    long tailleTranscodee = tailleFichier("lenna_transcode_q10.dat");
+
+    cout << "Fichier q50: " << tailleOrigine << " octets" << endl;
+    cout << "Transcode q10: " << tailleTranscodee << " octets" << endl;
+    cout << "Transcodage q50 -> q50 identique: " << (identique ? "oui" : "non") << endl;
+    cout << "Temps transcodage: "
+         << duration_cast<microseconds>(finTranscodage - debutTranscodage).count() << " us" << endl;
+    cout << "Temps decompression + recompression: "
+         << duration_cast<microseconds>(finRecompression - finTranscodage).count() << " us" << endl;
+
+    ok = ok && identique && transcodee && tailleTranscodee < tailleOrigine;
+    libererImage(transcodee, 256);
+
+    cout << "Test transcodage: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Teste la decompression d'une region de l'image
+ */
+void testDecompressionRegion() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 12: DECOMPRESSION D'UNE REGION (ROI)" << endl;
+    cout << "===============================================================" << endl;
+
+    unsigned int x = 37, y = 21, w = 50, h = 30;
+
+    std::cout.setstate(std::ios_base::failbit);
+
+    cCompression compresseur;
+    compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+    compresseur.setQualite(50);
+    compresseur.compresser("lenna_region_q50.dat");
+
+    auto debutComplet = high_resolution_clock::now();
+    cDecompression decompresseur;
+    char** image = decompresseur.Decompression_JPEG("lenna_region_q50.dat");
+    auto finComplet = high_resolution_clock::now();
+
+    cDecompression decodeurRegion;
+    char** region = decodeurRegion.decodeRegion("lenna_region_q50.dat", x, y, w, h);
+    auto finRegion = high_resolution_clock::now();
+
+    // Une region hors de l'image doit etre refusee
+    std::cerr.setstate(std::ios_base::failbit);
+    char** horsImage = decodeurRegion.decodeRegion("lenna_region_q50.dat", 250, 0, 10, 10);
+    // x + w depasse la capacite d'un unsigned : la somme reviendrait dans l'image
+    char** depassement = decodeurRegion.decodeRegion("lenna_region_q50.dat", 16, 0, 0xFFFFFFF8u, 10);
+    std::cerr.clear();
+
+    std::cout.clear();
+
+    bool ok = image && region && !horsImage && !depassement;
+    int differences = 0;
+    for (unsigned int i = 0; ok && i < h; i++) {
+        for (unsigned int j = 0; j < w; j++) {
+            if (region[i][j] != image[y + i][x + j]) differences++;
+        }
+    }
+    ok = ok && differences == 0;
+
+    cout << "Region " << w << "x" << h << " en (" << x << "," << y << "): "
+         << differences << " pixels differents de l'image complete" << endl;
+    cout << "Temps image complete: " << duration_cast<microseconds>(finComplet - debutComplet).count() << " us" << endl;
+    cout << "Temps region: " << duration_cast<microseconds>(finRegion - finComplet).count() << " us" << endl;
+
+    libererImage(image, 256);
+    libererImage(region, h);
+
+    cout << "Test decompression region: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Teste la decompression a taille reduite (1/2, 1/4, 1/8)
+ */
+void testDecompressionEchelle() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 13: DECOMPRESSION A TAILLE REDUITE" << endl;
+    cout << "===============================================================" << endl;
+
+    std::cout.setstate(std::ios_base::failbit);
+
+    cCompression compresseur;
+    compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+    compresseur.setQualite(50);
+    compresseur.compresser("lenna_echelle_q50.dat");
+
+    cDecompression decompresseur;
+    char** complete = decompresseur.Decompression_JPEG("lenna_echelle_q50.dat");
+
+    std::cout.clear();
+
+    bool ok = complete != nullptr;
+    const unsigned int echelles[3] = {2, 4, 8};
+    for (int k = 0; ok && k < 3; k++) {
+        unsigned int echelle = echelles[k];
+
+        std::cout.setstate(std::ios_base::failbit);
+        cDecompression decodeur;
+        auto debut = high_resolution_clock::now();
+        char** reduite = decodeur.Decompression_JPEG("lenna_echelle_q50.dat", echelle);
+        auto fin = high_resolution_clock::now();
+        std::cout.clear();
+
+        unsigned int taille = 256 / echelle;
+        bool dimensions = reduite && decodeur.getLargeur() == taille && decodeur.getHauteur() == taille;
+
+        // Comparaison avec la moyenne par blocs echelle x echelle de l'image complete
+        double ecartMoyen = 0.0;
+        for (unsigned int i = 0; dimensions && i < taille; i++) {
+            for (unsigned int j = 0; j < taille; j++) {
+                double somme = 0.0;
+                for (unsigned int di = 0; di < echelle; di++) {
+                    for (unsigned int dj = 0; dj < echelle; dj++) {
+                        somme += static_cast<unsigned char>(complete[i * echelle + di][j * echelle + dj]);
+                    }
+                }
+                ecartMoyen += fabs(somme / (echelle * echelle) - static_cast<unsigned char>(reduite[i][j]));
+            }
+        }
+        ecartMoyen /= (taille * taille);
+
+        cout << "Echelle 1/" << echelle << ": " << (reduite ? decodeur.getLargeur() : 0) << "x"
+             << (reduite ? decodeur.getHauteur() : 0)
+             << ", ecart moyen a l'image moyennee: " << fixed << setprecision(2) << ecartMoyen
+             << ", temps: " << duration_cast<microseconds>(fin - debut).count() << " us" << endl;
+
+        ok = dimensions && ecartMoyen < 2.0;
+        libererImage(reduite, taille);
+    }
+
+    // Une echelle non supportee doit etre refusee
+    std::cout.setstate(std::ios_base::failbit);
+    std::cerr.setstate(std::ios_base::failbit);
+    cDecompression refus;
+    char** invalide = refus.Decompression_JPEG("lenna_echelle_q50.dat", 3);
+    std::cerr.clear();
+    std::cout.clear();
+    ok = ok && !invalide;
+
+    libererImage(complete, 256);
+
+    cout << "Test decompression reduite: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Teste l'apercu DC et l'empreinte perceptuelle
+ */
+void testApercuEmpreinte() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 14: APERCU DC ET EMPREINTE PERCEPTUELLE" << endl;
+    cout << "===============================================================" << endl;
+
+    std::cout.setstate(std::ios_base::failbit);
+
+    // Lenna a deux qualites, et Lenna retournee horizontalement
+    cCompression compresseur;
+    compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+    compresseur.setQualite(50);
+    compresseur.compresser("lenna_empreinte_q50.dat");
+    compresseur.setQualite(25);
+    compresseur.compresser("lenna_empreinte_q25.dat");
+
+    unsigned char** buffer = compresseur.getBuffer();
+    for (int i = 0; i < 256; i++) {
+        for (int j = 0; j < 128; j++) {
+            unsigned char temp = buffer[i][j];
+            buffer[i][j] = buffer[i][255 - j];
+            buffer[i][255 - j] = temp;
+        }
+    }
+    compresseur.setQualite(50);
+    compresseur.compresser("lenna_empreinte_miroir.dat");
+
+    // 1. L'apercu DC doit egaler la decompression au 1/8
+    auto debutReduite = high_resolution_clock::now();
+    cDecompression decodeurReduit;
+    char** reduite = decodeurReduit.Decompression_JPEG("lenna_empreinte_q50.dat", 8);
+    auto debutApercu = high_resolution_clock::now();
+    cDecompression decodeurApercu;
+    char** apercu = decodeurApercu.extraireApercuDC("lenna_empreinte_q50.dat");
+    auto finApercu = high_resolution_clock::now();
+
+    // 2. Empreintes
+    cDecompression hacheur;
+    unsigned long long empreinteQ50 = 0, empreinteQ25 = 0, empreinteMiroir = 0;
+    bool ok = hacheur.calculerEmpreinte("lenna_empreinte_q50.dat", empreinteQ50);
+    ok = hacheur.calculerEmpreinte("lenna_empreinte_q25.dat", empreinteQ25) && ok;
+    ok = hacheur.calculerEmpreinte("lenna_empreinte_miroir.dat", empreinteMiroir) && ok;
+
+    std::cout.clear();
+
+    bool identique = reduite && apercu && decodeurApercu.getLargeur() == 32 && decodeurApercu.getHauteur() == 32;
+    for (int i = 0; identique && i < 32; i++) {
+        for (int j = 0; j < 32; j++) {
+            if (reduite[i][j] != apercu[i][j]) identique = false;
+        }
+    }
+
+    int distanceQualite = cDecompression::distanceEmpreintes(empreinteQ50, empreinteQ25);
+    int distanceMiroir = cDecompression::distanceEmpreintes(empreinteQ50, empreinteMiroir);
+
+    cout << "Apercu DC 32x32 identique a la decompression 1/8: " << (identique ? "oui" : "non") << endl;
+    cout << "Temps decompression 1/8: " << duration_cast<microseconds>(debutApercu - debutReduite).count()
+         << " us, apercu DC: " << duration_cast<microseconds>(finApercu - debutApercu).count() << " us" << endl;
+    cout << "Empreinte q50: " << hex << empreinteQ50 << dec << endl;
+    cout << "Distance q50/q25: " << distanceQualite << " bits" << endl;
+    cout << "Distance q50/miroir: " << distanceMiroir << " bits" << endl;
+
+    ok = ok && identique && distanceQualite <= 8 && distanceMiroir > 16;
+
+    libererImage(reduite, 32);
+    libererImage(apercu, 32);
+
+    cout << "Test apercu et empreinte: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Lit les coefficients quantifies (ordre zigzag, 64 par bloc) d'un fichier compresse
+ */
+bool lireCoefficients(const string& nom, vector<int>& coefficients) {
+    ifstream fichier(nom.c_str(), ios::binary);
+    unsigned int entete[4];
+    if (!fichier.read(reinterpret_cast<char*>(entete), sizeof(entete))) return false;
+
+    vector<int> trame(entete[3]);
+    if (!fichier.read(reinterpret_cast<char*>(trame.data()), trame.size() * sizeof(int))) return false;
+
+    unsigned int nbBlocs = (entete[0] / 8) * (entete[1] / 8);
+    coefficients.assign(nbBlocs * 64, 0);
+    size_t index = 0;
+    int DC = 0;
+    for (unsigned int b = 0; b < nbBlocs && index < trame.size(); b++) {
+        DC += trame[index++];
+        coefficients[b * 64] = DC;
+        int k = 1;
+        while (index + 1 < trame.size()) {
+            int runlength = trame[index++];
+            int amplitude = trame[index++];
+            if (amplitude == 0) break;
+            k += runlength;
+            if (k < 64) coefficients[b * 64 + k] = amplitude;
+            k++;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Teste les rotations et symetries sans perte dans le domaine compresse
+ *
+ * Chaque fichier transforme est compare, coefficient par coefficient, a la
+ * compression de l'image transformee dans le domaine des pixels (table
+ * transposee pour les rotations de 90 et 270 degres) : seuls des arrondis
+ * a +-1 sur des valeurs a mi-chemin peuvent differer. Appliquer deux fois
+ * une symetrie ou quatre fois une rotation de 90 degres doit redonner le
+ * fichier d'origine.
+ */
+void testTransformationsSansPerte() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 15: ROTATIONS ET SYMETRIES SANS PERTE" << endl;
+    cout << "===============================================================" << endl;
+
+    const char* noms[6] = {"rotation 90", "rotation 180", "rotation 270",
+                           "miroir horizontal", "miroir vertical", "transposition"};
+
+    std::cout.setstate(std::ios_base::failbit);
+
+    cCompression original;
+    original.chargerImageTexte("lenna.img.txt", 256, 256);
+    original.setQualite(50);
+    original.compresser("lenna_transformation_q50.dat");
+    unsigned char** pixels = original.getBuffer();
+
+    std::cout.clear();
+
+    bool ok = true;
+    for (int t = 0; t < 6; t++) {
+        eTransformation transformation = static_cast<eTransformation>(t);
+        bool transposee = transformation == TRANSFORMATION_ROTATION_90 ||
+                          transformation == TRANSFORMATION_ROTATION_270 ||
+                          transformation == TRANSFORMATION_TRANSPOSITION;
+
+        std::cout.setstate(std::ios_base::failbit);
+
+        // 1. Transformation dans le domaine compresse
+        string nomTransforme = "lenna_transformation_" + to_string(t) + ".dat";
+        auto debut = high_resolution_clock::now();
+        cDecompression transformeur;
+        bool reussi = transformeur.transformer("lenna_transformation_q50.dat", nomTransforme.c_str(), transformation);
+        auto fin = high_resolution_clock::now();
+
+        // 2. Reference : transformation des pixels puis compression
+        cCompression reference(256, 256, 50 | (transposee ? cCompression::QUALITE_TABLE_TRANSPOSEE : 0));
+        unsigned char** sortie = reference.getBuffer();
+        for (int i = 0; i < 256; i++) {
+            for (int j = 0; j < 256; j++) {
+                int si = i, sj = j;
+                switch (transformation) {
+                    case TRANSFORMATION_ROTATION_90:       si = 255 - j; sj = i;       break;
+                    case TRANSFORMATION_ROTATION_180:      si = 255 - i; sj = 255 - j; break;
+                    case TRANSFORMATION_ROTATION_270:      si = j;       sj = 255 - i; break;
+                    case TRANSFORMATION_MIROIR_HORIZONTAL: sj = 255 - j;               break;
+                    case TRANSFORMATION_MIROIR_VERTICAL:   si = 255 - i;               break;
+                    case TRANSFORMATION_TRANSPOSITION:     si = j;       sj = i;       break;
+                }
+                sortie[i][j] = pixels[si][sj];
+            }
+        }
+        string nomReference = "lenna_transformation_ref_" + to_string(t) + ".dat";
+        reference.compresser(nomReference.c_str());
+
+        std::cout.clear();
+
+        vector<int> transforme, attendu;
+        bool lus = reussi && lireCoefficients(nomTransforme, transforme) && lireCoefficients(nomReference, attendu)
+                   && transforme.size() == attendu.size();
+        int differences = 0;
+        int ecartMax = 0;
+        for (size_t k = 0; lus && k < transforme.size(); k++) {
+            int ecart = abs(transforme[k] - attendu[k]);
+            if (ecart != 0) differences++;
+            ecartMax = max(ecartMax, ecart);
+        }
+
+        // Aller-retour : la transformation inverse redonne le fichier d'origine
+        eTransformation inverse = transformation;
+        if (transformation == TRANSFORMATION_ROTATION_90) inverse = TRANSFORMATION_ROTATION_270;
+        if (transformation == TRANSFORMATION_ROTATION_270) inverse = TRANSFORMATION_ROTATION_90;
+        std::cout.setstate(std::ios_base::failbit);
+        string nomRetour = "lenna_transformation_retour_" + to_string(t) + ".dat";
+        bool retour = transformeur.transformer(nomTransforme.c_str(), nomRetour.c_str(), inverse)
+                      && fichiersIdentiques("lenna_transformation_q50.dat", nomRetour);
+        std::cout.clear();
+
+        cout << noms[t] << ": " << differences << " coefficients differents (ecart max " << ecartMax
+             << "), aller-retour " << (retour ? "identique" : "different") << ", "
+             << duration_cast<microseconds>(fin - debut).count() << " us" << endl;
+        ok = ok && lus && ecartMax <= 1 && differences < static_cast<int>(transforme.size()) / 1000 && retour;
+    }
+
+    // Quatre rotations de 90 degres redonnent le fichier d'origine
+    std::cout.setstate(std::ios_base::failbit);
+    cDecompression rotation;
+    bool reussi = rotation.transformer("lenna_transformation_q50.dat", "lenna_rotation_a.dat", TRANSFORMATION_ROTATION_90);
+    reussi = rotation.transformer("lenna_rotation_a.dat", "lenna_rotation_b.dat", TRANSFORMATION_ROTATION_90) && reussi;
+    reussi = rotation.transformer("lenna_rotation_b.dat", "lenna_rotation_a.dat", TRANSFORMATION_ROTATION_90) && reussi;
+    reussi = rotation.transformer("lenna_rotation_a.dat", "lenna_rotation_b.dat", TRANSFORMATION_ROTATION_90) && reussi;
+    std::cout.clear();
+
+    bool cycle = reussi && fichiersIdentiques("lenna_transformation_q50.dat", "lenna_rotation_b.dat");
+    cout << "Quatre rotations de 90 degres: " << (cycle ? "fichier d'origine" : "fichier different") << endl;
+    ok = ok && cycle;
+
+    cout << "Test transformations sans perte: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Teste le recadrage sans perte dans le domaine compresse
+ */
+void testRecadrage() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 16: RECADRAGE SANS PERTE" << endl;
+    cout << "===============================================================" << endl;
+
+    unsigned int x = 64, y = 32, w = 128, h = 96;
+
+    std::cout.setstate(std::ios_base::failbit);
+
+    cCompression original;
+    original.chargerImageTexte("lenna.img.txt", 256, 256);
+    original.setQualite(50);
+    original.compresser("lenna_recadrage_q50.dat");
+
+    // 1. Recadrage dans le domaine compresse
+    auto debut = high_resolution_clock::now();
+    cDecompression recadreur;
+    bool ok = recadreur.recadrer("lenna_recadrage_q50.dat", "lenna_recadree.dat", x, y, w, h);
+    auto fin = high_resolution_clock::now();
+
+    // 2. Reference : compression des pixels du rectangle
+    cCompression reference(w, h, 50);
+    unsigned char** pixels = original.getBuffer();
+    unsigned char** sortie = reference.getBuffer();
+    for (unsigned int i = 0; i < h; i++) {
+        for (unsigned int j = 0; j < w; j++) {
+            sortie[i][j] = pixels[y + i][x + j];
+        }
+    }
+    reference.compresser("lenna_recadree_ref.dat");
+
+    // 3. Un rectangle non aligne ou hors de l'image doit etre refuse
+    std::cerr.setstate(std::ios_base::failbit);
+    bool nonAligne = recadreur.recadrer("lenna_recadrage_q50.dat", "lenna_recadree_invalide.dat", 4, 0, 64, 64);
+    bool horsImage = recadreur.recadrer("lenna_recadrage_q50.dat", "lenna_recadree_invalide.dat", 200, 0, 64, 64);
+    std::cerr.clear();
+
+    std::cout.clear();
+
+    bool identique = ok && fichiersIdentiques("lenna_recadree.dat", "lenna_recadree_ref.dat");
+    cout << "Rectangle " << w << "x" << h << " en (" << x << "," << y << "): "
+         << (identique ? "identique" : "different") << " a la compression des pixels recadres" << endl;
+    cout << "Temps recadrage: " << duration_cast<microseconds>(fin - debut).count() << " us" << endl;
+
+    ok = identique && !nonAligne && !horsImage;
+    cout << "Test recadrage: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Teste la compression couleur YCbCr avec sous-echantillonnage de la chrominance
+ */
+void testCouleur() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 17: COULEUR YCBCR 4:4:4 / 4:2:2 / 4:2:0" << endl;
+    cout << "===============================================================" << endl;
+
+    // Image RGB synthetique a partir de Lenna, dimensions non multiples de 16
+    const unsigned int largeur = 250, hauteur = 246;
+
+    std::cout.setstate(std::ios_base::failbit);
+    cCompression lenna;
+    lenna.chargerImageTexte("lenna.img.txt", 256, 256);
+    std::cout.clear();
+
+    unsigned char** pixels = lenna.getBuffer();
+    vector<unsigned char> rgb(largeur * hauteur * 3);
+    for (unsigned int i = 0; i < hauteur; i++) {
+        for (unsigned int j = 0; j < largeur; j++) {
+            int l = pixels[i][j];
+            rgb[3 * (i * largeur + j)]     = static_cast<unsigned char>(l);
+            rgb[3 * (i * largeur + j) + 1] = static_cast<unsigned char>((l + j) / 2);
+            rgb[3 * (i * largeur + j) + 2] = static_cast<unsigned char>((l + 255 - i) / 2);
+        }
+    }
+
+    // Aller-retour PPM
+    bool ok = cDecompressionCouleur::ecrireImagePPM("lenna_couleur.ppm", rgb.data(), largeur, hauteur);
+    cCompressionCouleur compresseur;
+    ok = compresseur.chargerImagePPM("lenna_couleur.ppm") && ok;
+    ok = ok && compresseur.getLargeur() == largeur && compresseur.getHauteur() == hauteur
+            && equal(rgb.begin(), rgb.end(), compresseur.getRGB());
+    cout << "Aller-retour PPM: " << (ok ? "identique" : "different") << endl;
+
+    const eSousEchantillonnage modes[3] = {SOUS_ECHANTILLONNAGE_444, SOUS_ECHANTILLONNAGE_422, SOUS_ECHANTILLONNAGE_420};
+    const char* noms[3] = {"4:4:4", "4:2:2", "4:2:0"};
+    long taillePrecedente = 0;
+
+    compresseur.setQualite(75);
+    for (int m = 0; m < 3; m++) {
+        string nom = string("lenna_couleur_") + to_string(m) + ".dat";
+
+        std::cout.setstate(std::ios_base::failbit);
+        compresseur.setSousEchantillonnage(modes[m]);
+        auto debut = high_resolution_clock::now();
+        bool compresse = compresseur.compresserCouleur(nom.c_str());
+        auto milieu = high_resolution_clock::now();
+        cDecompressionCouleur decompresseur;
+        unsigned char* decodee = decompresseur.Decompression_Couleur(nom.c_str());
+        auto fin = high_resolution_clock::now();
+        std::cout.clear();
+
+        double erreur = 0.0;
+        bool valide = compresse && decodee && decompresseur.getLargeur() == largeur
+                      && decompresseur.getHauteur() == hauteur && decompresseur.getSousEchantillonnage() == modes[m];
+        for (unsigned int k = 0; valide && k < rgb.size(); k++) {
+            double diff = static_cast<double>(rgb[k]) - decodee[k];
+            erreur += diff * diff;
+        }
+        double psnr = valide ? 10.0 * log10(255.0 * 255.0 / (erreur / rgb.size())) : 0.0;
+        long taille = tailleFichier(nom);
+
+        cout << noms[m] << ": " << taille << " octets, PSNR RGB " << fixed << setprecision(1) << psnr
+             << " dB, compression " << duration_cast<microseconds>(milieu - debut).count()
+             << " us, decompression " << duration_cast<microseconds>(fin - milieu).count() << " us" << endl;
+
+        ok = ok && valide && psnr > 30.0 && (m == 0 || taille < taillePrecedente);
+        taillePrecedente = taille;
+        delete[] decodee;
+    }
+
+    // Un fichier en niveaux de gris n'est pas un fichier couleur
+    std::cout.setstate(std::ios_base::failbit);
+    std::cerr.setstate(std::ios_base::failbit);
+    lenna.setQualite(50);
+    lenna.compresser("lenna_gris_q50.dat");
+    cDecompressionCouleur refus;
+    unsigned char* invalide = refus.Decompression_Couleur("lenna_gris_q50.dat");
+    std::cerr.clear();
+    std::cout.clear();
+    ok = ok && !invalide;
+
+    // Objets reutilises : un buffer en niveaux de gris 8x8 puis une image couleur plus haute
+    std::cout.setstate(std::ios_base::failbit);
+    cCompression petit(8, 8, 50);
+    petit.compresser("gris_8x8.dat");
+    cDecompressionCouleur reutilise;
+    libererImage(reutilise.Decompression_JPEG("gris_8x8.dat"), 8);
+    unsigned char* apresGris = reutilise.Decompression_Couleur("lenna_couleur_0.dat");
+    cCompressionCouleur compresseurReutilise;
+    compresseurReutilise.allocBuffer(8, 8);
+    bool rechargee = compresseurReutilise.chargerImageRGB(rgb.data(), largeur, hauteur);
+    std::cout.clear();
+    bool reutilisationOk = apresGris && reutilise.getHauteur() == hauteur && !reutilise.getBuffer()
+                        && rechargee && !compresseurReutilise.getBuffer();
+    cout << "Objets reutilises apres une image en niveaux de gris: " << (reutilisationOk ? "oui" : "NON") << endl;
+    ok = ok && reutilisationOk;
+    delete[] apresGris;
+
+    // Conversion RGB -> YCbCr (8 pixels par iteration avec SSE2) : les 2^24 couleurs,
+    // suivies d'un reste de 5 pixels traite en scalaire, comparees a la formule JFIF
+    const unsigned int nbCouleurs = (1u << 24) + 5;
+    vector<unsigned char> couleurs(3 * nbCouleurs), Y(nbCouleurs), Cb(nbCouleurs), Cr(nbCouleurs);
+    for (unsigned int i = 0; i < nbCouleurs; i++) {
+        couleurs[3 * i]     = static_cast<unsigned char>(i);
+        couleurs[3 * i + 1] = static_cast<unsigned char>(i >> 8);
+        couleurs[3 * i + 2] = static_cast<unsigned char>(i >> 16);
+    }
+    cCompressionCouleur::convertirRGBversYCbCr(couleurs.data(), nbCouleurs, Y.data(), Cb.data(), Cr.data());
+    unsigned int erreursConversion = 0;
+    const int decalage = (128 << 16) + 32767;
+    for (unsigned int i = 0; i < nbCouleurs; i++) {
+        int r = couleurs[3 * i], g = couleurs[3 * i + 1], b = couleurs[3 * i + 2];
+        erreursConversion += Y[i] != ((19595 * r + 38470 * g + 7471 * b + 32768) >> 16);
+        erreursConversion += Cb[i] != ((-11056 * r - 21712 * g + 32768 * b + decalage) >> 16);
+        erreursConversion += Cr[i] != ((32768 * r - 27440 * g - 5328 * b + decalage) >> 16);
+    }
+    cout << "Conversion RGB -> YCbCr de toutes les couleurs: " << erreursConversion << " erreurs" << endl;
+    ok = ok && erreursConversion == 0;
+
+    cout << "Test couleur: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Teste la compression progressive et l'affichage passe par passe
+ */
+void testProgressif() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 18: COMPRESSION PROGRESSIVE" << endl;
+    cout << "===============================================================" << endl;
+
+    std::cout.setstate(std::ios_base::failbit);
+
+    cCompression compresseur;
+    compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+    compresseur.setQualite(50);
+    compresseur.compresser("lenna_sequentiel_q50.dat");
+    bool ok = compresseur.compresserProgressif("lenna_progressif_q50.dat");
+
+    cDecompression sequentiel;
+    char** reference = sequentiel.Decompression_JPEG("lenna_sequentiel_q50.dat");
+
+    std::cout.clear();
+
+    unsigned char** original = compresseur.getBuffer();
+    cout << "Fichier sequentiel: " << tailleFichier("lenna_sequentiel_q50.dat") << " octets, progressif: "
+         << tailleFichier("lenna_progressif_q50.dat") << " octets" << endl;
+
+    // 1. Rendu apres chaque passe : la qualite augmente a chaque passe
+    double psnrPrecedent = 0.0;
+    for (int p = 1; p <= cCompression::NB_PASSES_PROGRESSIF; p++) {
+        std::cout.setstate(std::ios_base::failbit);
+        cDecompression decodeur;
+        unsigned int passes = 0;
+        auto debut = high_resolution_clock::now();
+        char** image = decodeur.Decompression_Progressive("lenna_progressif_q50.dat", p, &passes);
+        auto fin = high_resolution_clock::now();
+        std::cout.clear();
+
+        double erreur = 0.0;
+        for (int i = 0; image && i < 256; i++) {
+            for (int j = 0; j < 256; j++) {
+                double diff = static_cast<double>(original[i][j]) - static_cast<unsigned char>(image[i][j]);
+                erreur += diff * diff;
+            }
+        }
+        double psnr = (erreur > 0) ? 10.0 * log10(255.0 * 255.0 / (erreur / (256 * 256))) : 99.99;
+
+        cout << "Apres " << p << " passe(s): PSNR " << fixed << setprecision(1) << psnr << " dB, "
+             << duration_cast<microseconds>(fin - debut).count() << " us" << endl;
+
+        ok = ok && image && passes == static_cast<unsigned int>(p) && psnr > psnrPrecedent;
+        psnrPrecedent = psnr;
+        libererImage(image, 256);
+    }
+
+    // 2. Toutes les passes, via Decompression_JPEG : meme image que le fichier sequentiel
+    std::cout.setstate(std::ios_base::failbit);
+    cDecompression complet;
+    char** image = complet.Decompression_JPEG("lenna_progressif_q50.dat");
+    std::cout.clear();
+
+    int differences = 0;
+    for (int i = 0; image && reference && i < 256; i++) {
+        for (int j = 0; j < 256; j++) {
+            if (image[i][j] != reference[i][j]) differences++;
+        }
+    }
+    cout << "Toutes les passes: " << differences << " pixels differents du decodage sequentiel" << endl;
+    ok = ok && image && reference && differences == 0;
+    libererImage(image, 256);
+    libererImage(reference, 256);
+
+    // 3. Fichier recu partiellement : seules les passes completes sont affichees
+    {
+        ifstream source("lenna_progressif_q50.dat", ios::binary);
+        vector<char> octets((istreambuf_iterator<char>(source)), istreambuf_iterator<char>());
+        ofstream tronque("lenna_progressif_tronque.dat", ios::binary);
+        tronque.write(octets.data(), octets.size() / 2);
+    }
+    std::cout.setstate(std::ios_base::failbit);
+    cDecompression partiel;
+    unsigned int passesPartielles = 0;
+    image = partiel.Decompression_Progressive("lenna_progressif_tronque.dat", 0, &passesPartielles);
+    std::cout.clear();
+
+    cout << "Moitie du fichier recue: " << passesPartielles << " passe(s) affichable(s)" << endl;
+    ok = ok && image && passesPartielles >= 1 && passesPartielles < static_cast<unsigned int>(cCompression::NB_PASSES_PROGRESSIF);
+    libererImage(image, 256);
+
+    // 4. Reception au fil de l'eau : le decodeur incremental garde les coefficients,
+    //    ne lit que la nouvelle passe et donne la meme image que Decompression_Progressive
+    vector<char> octets;
+    {
+        ifstream source("lenna_progressif_q50.dat", ios::binary);
+        octets.assign(istreambuf_iterator<char>(source), istreambuf_iterator<char>());
+    }
+    ofstream flux("lenna_progressif_flux.dat", ios::binary);
+    const size_t morceau = 4096;
+    size_t envoyes = min(morceau, octets.size());
+    flux.write(octets.data(), envoyes);
+    flux.flush();
+
+    cDecodeurProgressif incremental;
+    bool ouvert = incremental.ouvrir("lenna_progressif_flux.dat");
+    int differencesPasses = 0;
+    long long dureeIncrementale = 0;
+    long long dureeComplete = 0;
+    while (ouvert && !incremental.estTermine() && envoyes <= octets.size()) {
+        auto debut = high_resolution_clock::now();
+        bool nouvellePasse = incremental.decoderPasseSuivante();
+        dureeIncrementale += duration_cast<microseconds>(high_resolution_clock::now() - debut).count();
+
+        if (!nouvellePasse) {
+            // Passe incomplete : le morceau suivant arrive
+            if (envoyes == octets.size()) break;
+            size_t taille = min(morceau, octets.size() - envoyes);
+            flux.write(octets.data() + envoyes, taille);
+            flux.flush();
+            envoyes += taille;
+            continue;
+        }
+
+        unsigned int p = incremental.getNbPassesDecodees();
+        std::cout.setstate(std::ios_base::failbit);
+        cDecompression decodeur;
+        debut = high_resolution_clock::now();
+        char** attendue = decodeur.Decompression_Progressive("lenna_progressif_q50.dat", p);
+        dureeComplete += duration_cast<microseconds>(high_resolution_clock::now() - debut).count();
+        std::cout.clear();
+
+        for (int i = 0; attendue && i < 256; i++) {
+            for (int j = 0; j < 256; j++) {
+                differencesPasses += incremental.getBuffer()[i][j] != static_cast<unsigned char>(attendue[i][j]);
+            }
+        }
+        differencesPasses += attendue ? 0 : 1;
+        cout << "Passe " << p << " recue (" << envoyes << " octets): " << incremental.getBlocsRendus()
+             << " blocs recalcules" << endl;
+        libererImage(attendue, 256);
+    }
+    flux.close();
+
+    cout << "Decodage incremental: " << incremental.getNbPassesDecodees() << " passes, " << differencesPasses
+         << " pixels differents, " << dureeIncrementale << " us au total (redecodage complet a chaque passe: "
+         << dureeComplete << " us)" << endl;
+    ok = ok && ouvert && incremental.estTermine() && differencesPasses == 0;
+
+    // 5. Fichiers forges : run AC negatif apres la passe DC, dimensions enormes
+    const unsigned int sig = cCompression::SIGNATURE_PROGRESSIF;
+    const unsigned int runNegatif[] = {sig, 8, 8, 50, 2, 0, 0, 1, 0, 1, 5, 2, static_cast<unsigned int>(-10), 5};
+    const unsigned int geant[] = {sig, 0xFFFFFFF8u, 0xFFFFFFF8u, 50, 1, 0, 0, 1, 0};
+    {
+        ofstream forge("progressif_run_negatif.dat", ios::binary);
+        forge.write(reinterpret_cast<const char*>(runNegatif), sizeof(runNegatif));
+        ofstream forgeGeant("progressif_geant.dat", ios::binary);
+        forgeGeant.write(reinterpret_cast<const char*>(geant), sizeof(geant));
+    }
+    std::cout.setstate(std::ios_base::failbit);
+    std::cerr.setstate(std::ios_base::failbit);
+    cDecompression forge;
+    unsigned int passesForge = 0;
+    char** imageForge = forge.Decompression_Progressive("progressif_run_negatif.dat", 0, &passesForge);
+    libererImage(imageForge, 8);
+    cDecodeurProgressif incrementalForge;
+    bool forgeOk = passesForge == 1 && incrementalForge.ouvrir("progressif_run_negatif.dat")
+                && incrementalForge.decoderPasseSuivante() && !incrementalForge.decoderPasseSuivante()
+                && incrementalForge.getNbPassesDecodees() == 1;
+    cDecodeurProgressif incrementalGeant;
+    forgeOk = forgeOk && !forge.Decompression_Progressive("progressif_geant.dat")
+           && !incrementalGeant.ouvrir("progressif_geant.dat");
+    std::cout.clear();
+    std::cerr.clear();
+    cout << "Fichiers forges (run negatif, dimensions enormes): " << (forgeOk ? "refuses" : "ECHEC") << endl;
+    ok = ok && forgeOk;
+
+    // 6. Pixels modifies par getBuffer() entre deux compressions du meme objet :
+    //    le second fichier doit decrire la nouvelle image
+    std::cout.setstate(std::ios_base::failbit);
+    cCompression modifiee(64, 64, 50);
+    for (unsigned int i = 0; i < 64; i++) {
+        for (unsigned int j = 0; j < 64; j++) {
+            modifiee.getBuffer()[i][j] = static_cast<unsigned char>(i * 4 + j);
+        }
+    }
+    modifiee.compresserProgressif("progressif_avant.dat");
+    cCompression neuve(64, 64, 50);
+    for (unsigned int i = 0; i < 64; i++) {
+        for (unsigned int j = 0; j < 64; j++) {
+            modifiee.getBuffer()[i][j] = static_cast<unsigned char>(255 - i * 4 - j);
+            neuve.getBuffer()[i][j] = modifiee.getBuffer()[i][j];
+        }
+    }
+    modifiee.compresserProgressif("progressif_apres.dat");
+    neuve.compresserProgressif("progressif_neuve.dat");
+    std::cout.clear();
+    bool modificationOk = !fichiersIdentiques("progressif_avant.dat", "progressif_apres.dat")
+                       && fichiersIdentiques("progressif_apres.dat", "progressif_neuve.dat");
+    cout << "Pixels modifies entre deux compressions: " << (modificationOk ? "pris en compte" : "ECHEC") << endl;
+    ok = ok && modificationOk;
+
+    cout << "Test progressif: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Teste le format en tuiles : acces direct a une tuile et decodage parallele
+ */
+void testTuiles() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 19: FORMAT EN TUILES INDEXEES" << endl;
+    cout << "===============================================================" << endl;
+
+    std::cout.setstate(std::ios_base::failbit);
+
+    cCompression compresseur;
+    compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+    compresseur.setQualite(50);
+    compresseur.compresser("lenna_sequentiel_tuiles_q50.dat");
+    bool ok = compresseur.compresserTuiles("lenna_tuiles_q50.dat", 64);
+
+    cDecompression sequentiel;
+    char** reference = sequentiel.Decompression_JPEG("lenna_sequentiel_tuiles_q50.dat");
+
+    // 1. Decodage complet sur 1 puis 4 threads
+    auto debut = high_resolution_clock::now();
+    cDecompression mono;
+    char** imageMono = mono.Decompression_Tuiles("lenna_tuiles_q50.dat", 1);
+    auto milieu = high_resolution_clock::now();
+    cDecompression multi;
+    char** imageMulti = multi.Decompression_Tuiles("lenna_tuiles_q50.dat", 4);
+    auto fin = high_resolution_clock::now();
+
+    // 2. Acces direct a une tuile et a une region
+    cDecompression acces;
+    char** tuile = acces.decoderTuile("lenna_tuiles_q50.dat", 1, 2);
+    bool dimensionsTuile = tuile && acces.getLargeur() == 64 && acces.getHauteur() == 64;
+    cDecompression decodeurRegion;
+    char** region = decodeurRegion.decodeRegion("lenna_tuiles_q50.dat", 100, 30, 40, 90);
+    std::cerr.setstate(std::ios_base::failbit);
+    char** depassement = decodeurRegion.decodeRegion("lenna_tuiles_q50.dat", 64, 64, 10, 0xFFFFFFC0u);
+    std::cerr.clear();
+
+    std::cout.clear();
+
+    int differences = 0;
+    for (int i = 0; reference && imageMono && imageMulti && i < 256; i++) {
+        for (int j = 0; j < 256; j++) {
+            if (imageMono[i][j] != reference[i][j] || imageMulti[i][j] != reference[i][j]) differences++;
+        }
+    }
+    for (int i = 0; reference && dimensionsTuile && i < 64; i++) {
+        for (int j = 0; j < 64; j++) {
+            if (tuile[i][j] != reference[128 + i][64 + j]) differences++;
+        }
+    }
+    for (int i = 0; reference && region && i < 90; i++) {
+        for (int j = 0; j < 40; j++) {
+            if (region[i][j] != reference[30 + i][100 + j]) differences++;
+        }
+    }
+
+    cout << "Fichier sequentiel: " << tailleFichier("lenna_sequentiel_tuiles_q50.dat") << " octets, en tuiles 64x64: "
+         << tailleFichier("lenna_tuiles_q50.dat") << " octets" << endl;
+    cout << "Image complete, tuile (1,2) et region: " << differences
+         << " pixels differents du decodage sequentiel" << endl;
+    cout << "Temps 1 thread: " << duration_cast<microseconds>(milieu - debut).count() << " us, 4 threads: "
+         << duration_cast<microseconds>(fin - milieu).count() << " us" << endl;
+
+    ok = ok && reference && imageMono && imageMulti && dimensionsTuile && region && !depassement && differences == 0;
+
+    libererImage(reference, 256);
+    libererImage(imageMono, 256);
+    libererImage(imageMulti, 256);
+    libererImage(tuile, 64);
+    libererImage(region, 90);
+
+    // Pixels modifies par getBuffer() entre deux compressions du meme objet
+    std::cout.setstate(std::ios_base::failbit);
+    cCompression modifiee(128, 128, 50);
+    cCompression neuve(128, 128, 50);
+    for (unsigned int i = 0; i < 128; i++) {
+        for (unsigned int j = 0; j < 128; j++) {
+            modifiee.getBuffer()[i][j] = static_cast<unsigned char>(i + j);
+        }
+    }
+    modifiee.compresserTuiles("tuiles_avant.dat", 64);
+    for (unsigned int i = 0; i < 128; i++) {
+        for (unsigned int j = 0; j < 128; j++) {
+            modifiee.getBuffer()[i][j] = static_cast<unsigned char>(255 - i - j);
+            neuve.getBuffer()[i][j] = modifiee.getBuffer()[i][j];
+        }
+    }
+    modifiee.compresserTuiles("tuiles_apres.dat", 64);
+    neuve.compresserTuiles("tuiles_neuve.dat", 64);
+    std::cout.clear();
+    bool modificationOk = !fichiersIdentiques("tuiles_avant.dat", "tuiles_apres.dat")
+                       && fichiersIdentiques("tuiles_apres.dat", "tuiles_neuve.dat");
+    cout << "Pixels modifies entre deux compressions: " << (modificationOk ? "pris en compte" : "ECHEC") << endl;
+    ok = ok && modificationOk;
+
+    cout << "Test tuiles: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Test de la lecture par projection memoire du fichier compresse
+ */
+void testLectureMappee() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 20: LECTURE PAR PROJECTION MEMOIRE (MMAP)" << endl;
+    cout << "===============================================================" << endl;
+
+    std::cout.setstate(std::ios_base::failbit);
+    std::cerr.setstate(std::ios_base::failbit);
+
+    cCompression compresseur;
+    compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+    compresseur.setQualite(50);
+    bool ok = compresseur.compresser("lenna_mappe_q50.dat");
+    ok = compresseur.compresserTuiles("lenna_mappe_tuiles_q50.dat", 64) && ok;
+
+    // 1. Meme fichier decode par lecture classique puis par projection
+    auto debut = high_resolution_clock::now();
+    cDecompression lecture;
+    char** imageLue = lecture.Decompression_JPEG("lenna_mappe_q50.dat");
+    auto milieu = high_resolution_clock::now();
+    cDecompression projection;
+    projection.setLectureMappee(true);
+    char** imageMappee = projection.Decompression_JPEG("lenna_mappe_q50.dat");
+    auto fin = high_resolution_clock::now();
+
+    // 2. Fichier en tuiles, trame partagee entre les threads
+    cDecompression tuilesLues;
+    char** tuilesLue = tuilesLues.Decompression_Tuiles("lenna_mappe_tuiles_q50.dat", 2);
+    cDecompression tuilesProjetees;
+    tuilesProjetees.setLectureMappee(true);
+    char** tuilesMappee = tuilesProjetees.Decompression_Tuiles("lenna_mappe_tuiles_q50.dat", 2);
+
+    // 3. Fichier tronque : la longueur annoncee depasse la projection
+    {
+        ifstream source("lenna_mappe_q50.dat", ios::binary);
+        ofstream tronque("lenna_mappe_tronque.dat", ios::binary);
+        vector<char> octets(1000);
+        source.read(octets.data(), octets.size());
+        tronque.write(octets.data(), source.gcount());
+    }
+    char** imageTronquee = projection.Decompression_JPEG("lenna_mappe_tronque.dat");
+    char** absent = projection.Decompression_JPEG("fichier_inexistant.dat");
+
+    // 4. Memes fichiers refuses par la lecture classique, plus une longueur de trame negative
+    const int negative[] = {256, 256, 50, -5};
+    {
+        ofstream forge("lenna_longueur_negative.dat", ios::binary);
+        forge.write(reinterpret_cast<const char*>(negative), sizeof(negative));
+    }
+    char** tronqueeLue = lecture.Decompression_JPEG("lenna_mappe_tronque.dat");
+    char** negativeLue = lecture.Decompression_JPEG("lenna_longueur_negative.dat");
+    char** negativeMappee = projection.Decompression_JPEG("lenna_longueur_negative.dat");
+
+    std::cout.clear();
+    std::cerr.clear();
+
+    int differences = 0;
+    for (int i = 0; imageLue && imageMappee && i < 256; i++) {
+        for (int j = 0; j < 256; j++) {
+            if (imageMappee[i][j] != imageLue[i][j]) differences++;
+        }
+    }
+    for (int i = 0; tuilesLue && tuilesMappee && i < 256; i++) {
+        for (int j = 0; j < 256; j++) {
+            if (tuilesMappee[i][j] != tuilesLue[i][j]) differences++;
+        }
+    }
+
+    cout << "Pixels differents entre lecture classique et projection: " << differences << endl;
+    cout << "Temps lecture classique: " << duration_cast<microseconds>(milieu - debut).count()
+         << " us, projection: " << duration_cast<microseconds>(fin - milieu).count() << " us" << endl;
+    cout << "Fichier tronque rejete: " << (imageTronquee == nullptr ? "oui" : "non")
+         << ", fichier absent rejete: " << (absent == nullptr ? "oui" : "non") << endl;
+    cout << "Lecture classique: fichier tronque rejete: " << (tronqueeLue == nullptr ? "oui" : "non")
+         << ", longueur negative rejetee: "
+         << (negativeLue == nullptr && negativeMappee == nullptr ? "oui" : "non") << endl;
+
+    ok = ok && imageLue && imageMappee && tuilesLue && tuilesMappee && differences == 0 &&
+         imageTronquee == nullptr && absent == nullptr &&
+         tronqueeLue == nullptr && negativeLue == nullptr && negativeMappee == nullptr;
+
+    libererImage(imageLue, 256);
+    libererImage(imageMappee, 256);
+    libererImage(tuilesLue, 256);
+    libererImage(tuilesMappee, 256);
+
+    cout << "Test lecture mappee: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Test du chemin rapide des blocs uniformes (DC seul, sans DCT ni IDCT)
+ */
+void testBlocsUniformes() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 21: BLOCS UNIFORMES SANS DCT NI IDCT" << endl;
+    cout << "===============================================================" << endl;
+
+    // 1. Page synthetique : fond blanc, zone a faible bruit, degrade et texte
+    const int taille = 256;
+    cCompression compresseur(taille, taille, 50);
+    unsigned char** page = compresseur.getBuffer();
+    for (int i = 0; i < taille; i++) {
+        for (int j = 0; j < taille; j++) {
+            int valeur = 240;
+            if (i >= 64 && i < 128) valeur = 200 + (i * 7 + j * 3) % 2;
+            if (i >= 128 && i < 192) valeur = 100 + j / 4;
+            if (i >= 200 && i < 240 && j % 16 < 3 && i % 10 < 7) valeur = 40;
+            page[i][j] = static_cast<unsigned char>(valeur);
+        }
+    }
+
+    std::cout.setstate(std::ios_base::failbit);
+    auto debut = high_resolution_clock::now();
+    bool ok = compresseur.compresser("page_uniforme_q50.dat");
+    auto milieu = high_resolution_clock::now();
+    cDecompression decompresseur;
+    char** image = decompresseur.Decompression_JPEG("page_uniforme_q50.dat");
+    auto fin = high_resolution_clock::now();
+    std::cout.clear();
+
+    // 2. Trame de reference par le chemin complet DCT + quantification + RLE_Block
+    vector<int> reference;
+    char blocChar[8][8], trameBloc[128];
+    double dct[8][8];
+    int quant[8][8];
+    char* charPtrs[8];
+    double* doublePtrs[8];
+    int* intPtrs[8];
+    for (int i = 0; i < 8; i++) {
+        charPtrs[i] = blocChar[i];
+        doublePtrs[i] = dct[i];
+        intPtrs[i] = quant[i];
+    }
+    int DC_precedent = 0;
+    int blocsUniformes = 0;
+    for (int by = 0; by < taille / 8; by++) {
+        for (int bx = 0; bx < taille / 8; bx++) {
+            for (int i = 0; i < 8; i++) {
+                for (int j = 0; j < 8; j++) {
+                    blocChar[i][j] = static_cast<char>(page[by * 8 + i][bx * 8 + j] - 128);
+                }
+            }
+            compresseur.Calcul_DCT_Block(charPtrs, doublePtrs);
+            compresseur.quant_JPEG(doublePtrs, intPtrs);
+            int longueur = compresseur.RLE_Block(intPtrs, DC_precedent, trameBloc);
+            DC_precedent = quant[0][0];
+            reference.insert(reference.end(), trameBloc, trameBloc + longueur);
+            if (longueur == 3) blocsUniformes++;
+        }
+    }
+
+    vector<int> trame;
+    {
+        ifstream fichier("page_uniforme_q50.dat", ios::binary);
+        unsigned int entete[4] = {0, 0, 0, 0};
+        fichier.read(reinterpret_cast<char*>(entete), sizeof(entete));
+        trame.resize(entete[3]);
+        fichier.read(reinterpret_cast<char*>(trame.data()), trame.size() * sizeof(int));
+    }
+    bool trameIdentique = trame == reference;
+
+    // 3. Remplissage DC identique a l'IDCT complete et reduite
+    int erreursRemplissage = 0;
+    for (int DC = -1024; DC <= 1016; DC += 4) {
+        double coefficients[8][8] = {{0}};
+        coefficients[0][0] = DC;
+        double* lignes[8];
+        for (int i = 0; i < 8; i++) lignes[i] = coefficients[i];
+        for (int t = 1; t <= 8; t *= 2) {
+            char complet[8][8], rempli[8][8];
+            char* ptrsComplet[8];
+            char* ptrsRempli[8];
+            for (int i = 0; i < 8; i++) {
+                ptrsComplet[i] = complet[i];
+                ptrsRempli[i] = rempli[i];
+            }
+            compresseur.Calcul_IDCT_Reduite(lignes, ptrsComplet, t);
+            compresseur.Calcul_IDCT_DC(DC, ptrsRempli, t);
+            for (int i = 0; i < t; i++) {
+                for (int j = 0; j < t; j++) {
+                    if (complet[i][j] != rempli[i][j]) erreursRemplissage++;
+                }
+            }
+        }
+    }
+
+    // 4. Le fond est reconstruit sans artefact de bloc (une seule valeur)
+    bool fondExact = image != nullptr;
+    for (int i = 0; fondExact && i < 64; i++) {
+        for (int j = 0; j < taille; j++) {
+            if (image[i][j] != image[0][0]) fondExact = false;
+        }
+    }
+
+    cout << "Blocs uniformes (DC seul): " << blocsUniformes << "/" << (taille / 8) * (taille / 8) << endl;
+    cout << "Trame identique au chemin DCT complet: " << (trameIdentique ? "oui" : "non") << endl;
+    cout << "Remplissage DC different de l'IDCT: " << erreursRemplissage << " pixels" << endl;
+    cout << "Temps compression: " << duration_cast<microseconds>(milieu - debut).count()
+         << " us, decompression: " << duration_cast<microseconds>(fin - milieu).count() << " us" << endl;
+
+    ok = ok && trameIdentique && erreursRemplissage == 0 && fondExact && blocsUniformes > 0;
+    libererImage(image, taille);
+
+    cout << "Test blocs uniformes: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Codage RLE de reference, coefficient par coefficient
+ */
+int RLEReference(const int bloc[8][8], int DC_precedent, int* Trame) {
+    static const int zigzag[64][2] = {
+        {0,0}, {0,1}, {1,0}, {2,0}, {1,1}, {0,2}, {0,3}, {1,2},
+        {2,1}, {3,0}, {4,0}, {3,1}, {2,2}, {1,3}, {0,4}, {0,5},
+        {1,4}, {2,3}, {3,2}, {4,1}, {5,0}, {6,0}, {5,1}, {4,2},
+        {3,3}, {2,4}, {1,5}, {0,6}, {0,7}, {1,6}, {2,5}, {3,4},
+        {4,3}, {5,2}, {6,1}, {7,0}, {7,1}, {6,2}, {5,3}, {4,4},
+        {3,5}, {2,6}, {1,7}, {2,7}, {3,6}, {4,5}, {5,4}, {6,3},
+        {7,2}, {7,3}, {6,4}, {5,5}, {4,6}, {3,7}, {4,7}, {5,6},
+        {6,5}, {7,4}, {7,5}, {6,6}, {5,7}, {6,7}, {7,6}, {7,7}
+    };
+
+    int index = 0;
+    Trame[index++] = bloc[0][0] - DC_precedent;
+    int runlength = 0;
+    for (int i = 1; i < 64; i++) {
+        int coeff = bloc[zigzag[i][0]][zigzag[i][1]];
+        if (coeff == 0) {
+            runlength++;
+        } else {
+            Trame[index++] = runlength;
+            Trame[index++] = coeff;
+            runlength = 0;
+        }
+    }
+    Trame[index++] = runlength;
+    Trame[index++] = 0;
+    return index;
+}
+
+/**
+ * @brief Test du codage RLE par masque de coefficients non nuls
+ */
+void testRLEMasque() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 22: RLE PAR MASQUE DE COEFFICIENTS NON NULS" << endl;
+    cout << "===============================================================" << endl;
+
+    cCompression comp(8, 8, 50);
+    int bloc[8][8];
+    int* blocPtrs[8];
+    for (int i = 0; i < 8; i++) {
+        blocPtrs[i] = bloc[i];
+    }
+
+    // 1. Blocs aleatoires de densite croissante, plus les cas limites
+    const int densites[] = {0, 5, 20, 50, 80, 100};
+    const int nbBlocsParDensite = 2000;
+    unsigned int graine = 12345;
+    int differences = 0;
+    int blocsTestes = 0;
+    long long dureeRLE = 0;
+
+    for (int d = 0; d < 6; d++) {
+        for (int b = 0; b < nbBlocsParDensite; b++) {
+            for (int i = 0; i < 8; i++) {
+                for (int j = 0; j < 8; j++) {
+                    graine = graine * 1103515245u + 12345u;
+                    int tirage = static_cast<int>((graine >> 16) % 100);
+                    bloc[i][j] = tirage < densites[d] ? static_cast<int>((graine >> 8) % 31) - 15 : 0;
+                }
+            }
+            // Cas limites : dernier coefficient seul, DC seul
+            if (b == 0) bloc[7][7] = 3;
+            if (b == 1) bloc[0][0] = 0;
+
+            char trame[130];
+            int reference[130];
+            auto debut = high_resolution_clock::now();
+            int longueur = comp.RLE_Block(blocPtrs, 4, trame);
+            dureeRLE += duration_cast<nanoseconds>(high_resolution_clock::now() - debut).count();
+            int longueurReference = RLEReference(bloc, 4, reference);
+
+            bool identique = longueur == longueurReference;
+            for (int k = 0; identique && k < longueur; k++) {
+                identique = trame[k] == static_cast<char>(reference[k]);
+            }
+            if (!identique) differences++;
+            blocsTestes++;
+        }
+    }
+
+    // 2. Meme trame en entiers depuis l'ordre zigzag
+    int zigzag[64] = {0};
+    zigzag[0] = 300;
+    zigzag[1] = -200;
+    zigzag[40] = 1000;
+    zigzag[63] = 7;
+    int trameZigzag[130];
+    int longueurZigzag = comp.RLE_Zigzag(zigzag, 100, trameZigzag);
+    const int attendu[] = {200, 0, -200, 38, 1000, 22, 7, 0, 0};
+    bool zigzagOk = longueurZigzag == 9 && equal(attendu, attendu + 9, trameZigzag);
+
+    cout << "Blocs testes: " << blocsTestes << ", trames differentes de la reference: " << differences << endl;
+    cout << "Trame en entiers depuis l'ordre zigzag: " << (zigzagOk ? "correcte" : "incorrecte") << endl;
+    cout << "Temps moyen RLE_Block: " << dureeRLE / blocsTestes << " ns/bloc" << endl;
+
+    bool ok = differences == 0 && zigzagOk;
+    cout << "Test RLE par masque: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Test de la dequantification fusionnee avec la remise en ordre naturel
+ */
+void testDequantificationFusionnee() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 23: DEQUANTIFICATION ET ORDRE NATUREL EN UNE PASSE" << endl;
+    cout << "===============================================================" << endl;
+
+    // 1. Motif de frequence purement horizontale : seuls les AC (0,v) sont non nuls,
+    //    un placement transpose le rendrait vertical
+    cCompression motif(64, 64, 90);
+    unsigned char** pixels = motif.getBuffer();
+    for (int i = 0; i < 64; i++) {
+        for (int j = 0; j < 64; j++) {
+            pixels[i][j] = static_cast<unsigned char>(128 + 40 * cos((2 * (j % 8) + 1) * acos(-1.0) / 16.0));
+        }
+    }
+
+    std::cout.setstate(std::ios_base::failbit);
+    motif.compresser("motif_horizontal_q90.dat");
+    cDecompression decodeurMotif;
+    char** imageMotif = decodeurMotif.Decompression_JPEG("motif_horizontal_q90.dat");
+
+    cCompression compresseur;
+    compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+    compresseur.setQualite(50);
+    compresseur.compresser("lenna_dequant_q50.dat");
+    cDecompression decodeur;
+    auto debut = high_resolution_clock::now();
+    char** image = decodeur.Decompression_JPEG("lenna_dequant_q50.dat");
+    auto fin = high_resolution_clock::now();
+    std::cout.clear();
+
+    int ecartMaxMotif = 0;
+    for (int i = 0; imageMotif && i < 64; i++) {
+        for (int j = 0; j < 64; j++) {
+            int ecart = abs(static_cast<unsigned char>(imageMotif[i][j]) - pixels[i][j]);
+            ecartMaxMotif = max(ecartMaxMotif, ecart);
+        }
+    }
+
+    // 2. PSNR de Lenna a la qualite 50
+    unsigned char** original = compresseur.getBuffer();
+    double erreur = 0.0;
+    for (int i = 0; image && i < 256; i++) {
+        for (int j = 0; j < 256; j++) {
+            double diff = static_cast<double>(original[i][j]) - static_cast<unsigned char>(image[i][j]);
+            erreur += diff * diff;
+        }
+    }
+    double psnr = (erreur > 0) ? 10.0 * log10(255.0 * 255.0 / (erreur / (256 * 256))) : 99.99;
+
+    cout << "Motif horizontal: ecart maximal " << ecartMaxMotif << " niveaux" << endl;
+    cout << "Lenna qualite 50: PSNR " << fixed << setprecision(1) << psnr << " dB, decompression "
+         << duration_cast<microseconds>(fin - debut).count() << " us" << endl;
+
+    bool ok = imageMotif && image && ecartMaxMotif <= 4 && psnr > 30.0;
+    libererImage(imageMotif, 64);
+    libererImage(image, 256);
+
+    cout << "Test dequantification fusionnee: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief PSNR entre l'image originale et une image decompressee
+ */
+double calculerPSNR(unsigned char** original, char** image, unsigned int largeur, unsigned int hauteur) {
+    double erreur = 0.0;
+    for (unsigned int i = 0; i < hauteur; i++) {
+        for (unsigned int j = 0; j < largeur; j++) {
+            double diff = static_cast<double>(original[i][j]) - static_cast<unsigned char>(image[i][j]);
+            erreur += diff * diff;
+        }
+    }
+    return (erreur > 0) ? 10.0 * log10(255.0 * 255.0 / (erreur / (largeur * hauteur))) : 99.99;
+}
+
+/**
+ * @brief Compare les chaines double et float sur Lenna, pour plusieurs qualites
+ */
+void testPrecisionSimple() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 24: CHAINE EN SIMPLE PRECISION (FLOAT)" << endl;
+    cout << "===============================================================" << endl;
+
+    // 1. Transformees float et double sur des blocs aleatoires
+    cCompression comp(8, 8, 50);
+    char bloc[8][8], blocDouble[8][8], blocFloat[8][8];
+    double dct[8][8];
+    float dctFloat[8][8];
+    char* blocPtrs[8];
+    char* doubleSortie[8];
+    char* floatSortie[8];
+    double* dctPtrs[8];
+    float* floatPtrs[8];
+    for (int i = 0; i < 8; i++) {
+        blocPtrs[i] = bloc[i];
+        doubleSortie[i] = blocDouble[i];
+        floatSortie[i] = blocFloat[i];
+        dctPtrs[i] = dct[i];
+        floatPtrs[i] = dctFloat[i];
+    }
+
+    unsigned int graine = 2024;
+    double ecartDCT = 0.0;
+    int ecartIDCT = 0;
+    for (int n = 0; n < 500; n++) {
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                graine = graine * 1103515245u + 12345u;
+                bloc[i][j] = static_cast<char>(static_cast<int>((graine >> 16) % 256) - 128);
+            }
+        }
+        comp.Calcul_DCT_Block(blocPtrs, dctPtrs);
+        comp.Calcul_DCT_Block_Float(blocPtrs, floatPtrs);
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                ecartDCT = max(ecartDCT, fabs(dct[i][j] - dctFloat[i][j]));
+                dctFloat[i][j] = static_cast<float>(dct[i][j]);
+            }
+        }
+        comp.Calcul_IDCT(dctPtrs, doubleSortie);
+        comp.Calcul_IDCT_Float(floatPtrs, floatSortie);
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                ecartIDCT = max(ecartIDCT, abs(blocDouble[i][j] - blocFloat[i][j]));
+            }
+        }
+    }
+    cout << "DCT: ecart maximal " << scientific << setprecision(2) << ecartDCT
+         << ", IDCT: ecart maximal " << ecartIDCT << " niveau(x)" << endl;
+
+    // 2. Balayage de qualite sur Lenna, chaque chaine decodant ses propres fichiers
+    cout << "\nQualite | PSNR double (dB) | PSNR float (dB) | Ecart (dB) | Temps double/float (ms)" << endl;
+    cout << "--------+------------------+-----------------+------------+------------------------" << endl;
+
+    bool ok = ecartDCT < 1e-3 && ecartIDCT <= 1;
+    const unsigned int qualites[] = {10, 25, 50, 75, 90};
+    for (int q = 0; q < 5; q++) {
+        double psnr[2];
+        long long duree[2];
+        for (int mode = 0; mode < 2; mode++) {
+            string nom = "lenna_precision_" + string(mode ? "float" : "double") + "_q" + to_string(qualites[q]) + ".dat";
+
+            std::cout.setstate(std::ios_base::failbit);
+            auto debut = high_resolution_clock::now();
+            cCompression compresseur;
+            compresseur.setPrecisionSimple(mode == 1);
+            compresseur.chargerImageTexte("lenna.img.txt", 256, 256);
+            compresseur.setQualite(qualites[q]);
+            compresseur.compresser(nom.c_str());
+            cDecompression decompresseur;
+            decompresseur.setPrecisionSimple(mode == 1);
+            char** image = decompresseur.Decompression_JPEG(nom.c_str());
+            duree[mode] = duration_cast<milliseconds>(high_resolution_clock::now() - debut).count();
+            std::cout.clear();
+
+            psnr[mode] = image ? calculerPSNR(compresseur.getBuffer(), image, 256, 256) : 0.0;
+            ok = ok && image;
+            libererImage(image, 256);
+        }
+
+        double ecart = psnr[1] - psnr[0];
+        cout << setw(7) << qualites[q] << " | " << setw(16) << fixed << setprecision(2) << psnr[0]
+             << " | " << setw(15) << psnr[1] << " | " << setw(10) << showpos << ecart << noshowpos
+             << " | " << setw(10) << duree[0] << " / " << duree[1] << endl;
+        ok = ok && fabs(ecart) < 0.05;
+    }
+
+    cout << "Test precision simple: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Test de la DCT et de la quantification par lots de blocs
+ */
+void testDCTParLots() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 25: DCT ET QUANTIFICATION PAR LOTS DE " << cCompression::TAILLE_LOT << " BLOCS" << endl;
+    cout << "===============================================================" << endl;
+
+    const int N = cCompression::TAILLE_LOT;
+    cCompression comp(8, 8, 50);
+    comp.setPrecisionSimple(true);
+
+    // Table de quantification de la qualite 50 : dequantification d'un bloc de 1
+    int un[8][8], table[8][8];
+    float pas[8][8];
+    int* unPtrs[8];
+    float* pasPtrs[8];
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            un[i][j] = 1;
+        }
+        unPtrs[i] = un[i];
+        pasPtrs[i] = pas[i];
+    }
+    comp.dequant_JPEG_Float(unPtrs, pasPtrs);
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            table[i][j] = static_cast<int>(pas[i][j]);
+        }
+    }
+
+    char bloc[8][8];
+    float dct[8][8];
+    int quant[8][8];
+    char* blocPtrs[8];
+    float* dctPtrs[8];
+    int* quantPtrs[8];
+    for (int i = 0; i < 8; i++) {
+        blocPtrs[i] = bloc[i];
+        dctPtrs[i] = dct[i];
+        quantPtrs[i] = quant[i];
+    }
+
+    // 1. Lots de blocs aleatoires, compares bloc par bloc a la chaine float
+    float (*lot)[cCompression::TAILLE_LOT] = new float[64][cCompression::TAILLE_LOT];
+    int (*coefficients)[64] = new int[N][64];
+    unsigned int graine = 4242;
+    int differences = 0;
+    const int nbLots = 200;
+    long long dureeLots = 0;
+    long long dureeBlocs = 0;
+
+    for (int n = 0; n < nbLots; n++) {
+        for (int p = 0; p < 64; p++) {
+            for (int b = 0; b < N; b++) {
+                graine = graine * 1103515245u + 12345u;
+                lot[p][b] = static_cast<float>(static_cast<int>((graine >> 16) % 256) - 128);
+            }
+        }
+
+        auto debut = high_resolution_clock::now();
+        comp.Calcul_DCT_Quant_Lot(lot, table, coefficients);
+        dureeLots += duration_cast<nanoseconds>(high_resolution_clock::now() - debut).count();
+
+        for (int b = 0; b < N; b++) {
+            for (int p = 0; p < 64; p++) {
+                bloc[p / 8][p % 8] = static_cast<char>(lot[p][b]);
+            }
+            debut = high_resolution_clock::now();
+            comp.Calcul_DCT_Block_Float(blocPtrs, dctPtrs);
+            comp.quant_JPEG_Float(dctPtrs, quantPtrs);
+            dureeBlocs += duration_cast<nanoseconds>(high_resolution_clock::now() - debut).count();
+
+            // Meme trame RLE <=> memes coefficients dans le meme ordre zigzag
+            int trameLot[130], trameBloc[130];
+            int longueurLot = comp.RLE_Zigzag(coefficients[b], 0, trameLot);
+            int longueurBloc = RLEReference(quant, 0, trameBloc);
+            if (longueurLot != longueurBloc || !equal(trameLot, trameLot + longueurLot, trameBloc)) {
+                differences++;
+            }
+        }
+    }
+    delete[] lot;
+    delete[] coefficients;
+
+    int nbBlocs = nbLots * N;
+    cout << "Blocs compares: " << nbBlocs << ", differents de la chaine bloc par bloc: " << differences << endl;
+    cout << "Temps moyen par bloc: lots " << dureeLots / nbBlocs << " ns, bloc par bloc "
+         << dureeBlocs / nbBlocs << " ns" << endl;
+
+    // 2. Largeur non multiple du lot : le dernier lot de chaque ligne est incomplet
+    const unsigned int largeur = static_cast<unsigned int>(8 * (N + 3));
+    string nom[2] = {"lots_double.dat", "lots_float.dat"};
+    double psnr[2];
+    std::cout.setstate(std::ios_base::failbit);
+    for (int mode = 0; mode < 2; mode++) {
+        cCompression compresseur(largeur, 16, 75);
+        compresseur.setPrecisionSimple(mode == 1);
+        unsigned char** pixels = compresseur.getBuffer();
+        unsigned int graineImage = 7;
+        for (unsigned int i = 0; i < 16; i++) {
+            for (unsigned int j = 0; j < largeur; j++) {
+                graineImage = graineImage * 1103515245u + 12345u;
+                pixels[i][j] = static_cast<unsigned char>((j + i * 3) % 200 + (graineImage >> 28));
+            }
+        }
+        compresseur.compresser(nom[mode].c_str());
+        cDecompression decompresseur;
+        char** decode = decompresseur.Decompression_JPEG(nom[mode].c_str());
+        psnr[mode] = decode ? calculerPSNR(pixels, decode, largeur, 16) : 0.0;
+        libererImage(decode, 16);
+    }
+    std::cout.clear();
+    cout << "Image " << largeur << "x16, PSNR double/float: " << fixed << setprecision(2)
+         << psnr[0] << " / " << psnr[1] << " dB" << endl;
+
+    bool ok = differences == 0 && psnr[1] > 30.0 && fabs(psnr[1] - psnr[0]) < 0.05;
+    cout << "Test DCT par lots: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Lit la trame RLE d'un fichier compresse, symboles ramenes sur 8 bits
+ *        comme dans le benchmark Huffman
+ */
+bool lireTrameSymboles(const string& nom, vector<char>& symboles) {
+    ifstream fichier(nom.c_str(), ios::binary);
+    unsigned int entete[4];
+    if (!fichier.read(reinterpret_cast<char*>(entete), sizeof(entete))) return false;
+
+    vector<int> trame(entete[3]);
+    if (!fichier.read(reinterpret_cast<char*>(trame.data()), trame.size() * sizeof(int))) return false;
+
+    symboles.resize(trame.size());
+    for (size_t i = 0; i < trame.size(); i++) {
+        symboles[i] = static_cast<char>(trame[i]);
+    }
+    return true;
+}
+
+/**
+ * @brief Test de l'encodage Huffman par segments en parallele
+ */
+void testHuffmanParallele() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 26: ENCODAGE HUFFMAN PAR SEGMENTS EN PARALLELE" << endl;
+    cout << "===============================================================" << endl;
+
+    // 1. Trame RLE de Lenna (qualite 50), repetee pour former plusieurs segments
+    vector<char> motif;
+    if (!lireTrameSymboles("lenna_compresse_q50.dat", motif)) {
+        cout << "Test Huffman parallele: [X] ECHEC (lecture de la trame)" << endl;
+        return;
+    }
+    vector<char> trame;
+    while (trame.size() < 1000000) {
+        trame.insert(trame.end(), motif.begin(), motif.end());
+    }
+    unsigned int longueur = static_cast<unsigned int>(trame.size());
+
+    vector<char> donnees(256);
+    vector<double> frequences(256);
+    unsigned int nbSymboles = cHuffman::Histogramme(trame.data(), longueur, donnees.data(), frequences.data());
+    cHuffman huffman;
+    huffman.HuffmanCodes(donnees.data(), frequences.data(), nbSymboles);
+
+    vector<bool> reference;
+    auto debut = high_resolution_clock::now();
+    unsigned int bitsReference = huffman.encoder(trame.data(), longueur, reference);
+    long long dureeSerie = duration_cast<microseconds>(high_resolution_clock::now() - debut).count();
+
+    cout << "Trame: " << longueur << " symboles, " << bitsReference << " bits" << endl;
+    cout << "Encodeur serie: " << dureeSerie << " us" << endl;
+
+    // 2. Meme flux de bits quel que soit le nombre de segments
+    bool ok = bitsReference > 0;
+    const unsigned int nbThreads[] = {1, 2, 3, 4, 8};
+    for (int t = 0; t < 5; t++) {
+        vector<bool> bits;
+        debut = high_resolution_clock::now();
+        unsigned int nbBits = huffman.encoderParallele(trame.data(), longueur, bits, nbThreads[t]);
+        long long duree = duration_cast<microseconds>(high_resolution_clock::now() - debut).count();
+
+        bool identique = nbBits == bitsReference && bits == reference;
+        cout << "  " << nbThreads[t] << " thread(s): " << duree << " us, flux "
+             << (identique ? "identique" : "DIFFERENT") << endl;
+        ok = ok && identique;
+    }
+
+    // 3. Sortie en mots de 64 bits, trame plus courte qu'un segment
+    vector<uint64_t> mots;
+    debut = high_resolution_clock::now();
+    unsigned int nbBitsMots = huffman.encoderParallele(trame.data(), longueur, mots, 4);
+    long long dureeMots = duration_cast<microseconds>(high_resolution_clock::now() - debut).count();
+    bool motsOk = nbBitsMots == bitsReference && mots.size() == (bitsReference + 63) / 64;
+    for (unsigned int i = 0; motsOk && i < nbBitsMots; i++) {
+        motsOk = (((mots[i / 64] >> (63 - i % 64)) & 1) != 0) == reference[i];
+    }
+
+    vector<bool> courtReference, court;
+    huffman.encoder(trame.data(), 1000, courtReference);
+    huffman.encoderParallele(trame.data(), 1000, court, 4);
+    bool courtOk = court == courtReference;
+
+    // 4. Codes de plus de 64 bits (frequences de Fibonacci) : repli sur l'encodeur serie
+    char lettres[80];
+    double fibonacci[80];
+    double a = 1.0, b = 1.0;
+    for (int i = 0; i < 80; i++) {
+        lettres[i] = static_cast<char>(i + 1);
+        fibonacci[i] = a;
+        double c = a + b;
+        a = b;
+        b = c;
+    }
+    cHuffman profond;
+    profond.HuffmanCodes(lettres, fibonacci, 80);
+    vector<char> rares(lettres, lettres + 80);
+    vector<bool> profondReference, profondParallele;
+    profond.encoder(rares.data(), 80, profondReference);
+    profond.encoderParallele(rares.data(), 80, profondParallele);
+    bool profondOk = profondReference.size() > 64 * 2 && profondParallele == profondReference;
+
+    cout << "Sortie en mots de 64 bits (4 threads): " << dureeMots << " us, "
+         << (motsOk ? "identique" : "DIFFERENTE") << endl;
+    cout << "Trame plus courte qu'un segment: " << (courtOk ? "identique" : "DIFFERENTE") << endl;
+    cout << "Codes de plus de 64 bits: " << (profondOk ? "identique" : "DIFFERENTE") << endl;
+
+    ok = ok && motsOk && courtOk && profondOk;
+    cout << "Test Huffman parallele: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Decodage Huffman de reference : parcours de l'arbre bit par bit
+ */
+unsigned int decoderHuffmanReference(sNoeud* racine, const vector<bool>& bits, char* sortie) {
+    unsigned int index = 0;
+    sNoeud* courant = racine;
+    for (size_t i = 0; i < bits.size(); i++) {
+        courant = bits[i] ? courant->mdroit : courant->mgauche;
+        if (!courant->mgauche && !courant->mdroit) {
+            sortie[index++] = courant->mdonnee;
+            courant = racine;
+        }
+    }
+    return index;
+}
+
+/**
+ * @brief Test du decodage Huffman par table a plusieurs symboles
+ */
+void testHuffmanMultiSymboles() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 27: DECODAGE HUFFMAN PAR TABLE A PLUSIEURS SYMBOLES" << endl;
+    cout << "===============================================================" << endl;
+
+    // 1. Trames RLE de Lenna (distributions tres inegales) et codes longs
+    vector<vector<char>> trames;
+    vector<string> noms;
+    const char* fichiers[] = {"lenna_q10.dat", "lenna_q50.dat", "lenna_q90.dat"};
+    for (int f = 0; f < 3; f++) {
+        vector<char> motif;
+        if (lireTrameSymboles(fichiers[f], motif)) {
+            vector<char> trame;
+            while (trame.size() < 500000) {
+                trame.insert(trame.end(), motif.begin(), motif.end());
+            }
+            trames.push_back(trame);
+            noms.push_back(fichiers[f]);
+        }
+    }
+
+    // Frequences de Fibonacci : codes jusqu'a 39 bits, plus longs que la fenetre
+    vector<char> longs;
+    unsigned int graine = 99;
+    for (int i = 0; i < 200000; i++) {
+        graine = graine * 1103515245u + 12345u;
+        int symbole = 1;
+        while (symbole < 40 && ((graine >> (symbole % 24)) & 1)) symbole++;
+        longs.push_back(static_cast<char>(symbole));
+    }
+    trames.push_back(longs);
+    noms.push_back("codes longs");
+
+    bool ok = trames.size() == 4;
+    cout << "Trame           | Bits/symbole | Arbre (us) | Table (us) | Acceleration | Sortie" << endl;
+    cout << "----------------+--------------+------------+------------+--------------+----------" << endl;
+
+    for (size_t t = 0; t < trames.size(); t++) {
+        vector<char>& trame = trames[t];
+        unsigned int longueur = static_cast<unsigned int>(trame.size());
+
+        cHuffman huffman;
+        if (t + 1 < trames.size()) {
+            vector<char> donnees(256);
+            vector<double> frequences(256);
+            unsigned int nbSymboles = cHuffman::Histogramme(trame.data(), longueur, donnees.data(), frequences.data());
+            huffman.HuffmanCodes(donnees.data(), frequences.data(), nbSymboles);
+        } else {
+            char lettres[40];
+            double fibonacci[40];
+            double a = 1.0, b = 1.0;
+            for (int i = 0; i < 40; i++) {
+                lettres[i] = static_cast<char>(40 - i);
+                fibonacci[i] = a;
+                double c = a + b;
+                a = b;
+                b = c;
+            }
+            huffman.HuffmanCodes(lettres, fibonacci, 40);
+        }
+
+        vector<bool> bits;
+        huffman.encoder(trame.data(), longueur, bits);
+        vector<uint64_t> mots;
+        huffman.encoderParallele(trame.data(), longueur, mots, 1);
+
+        vector<char> reference(longueur + 1), sortie(longueur + 1), sortieMots(longueur + 1);
+        auto debut = high_resolution_clock::now();
+        unsigned int nbReference = decoderHuffmanReference(huffman.getRacine(), bits, reference.data());
+        auto milieu = high_resolution_clock::now();
+        unsigned int nbMots = huffman.decoder(mots, static_cast<unsigned int>(bits.size()), sortieMots.data());
+        auto fin = high_resolution_clock::now();
+        unsigned int nbSortie = huffman.decoder(bits, static_cast<unsigned int>(bits.size()), sortie.data());
+
+        bool identique = nbReference == nbMots && nbReference == nbSortie &&
+                         equal(reference.begin(), reference.begin() + nbReference, sortieMots.begin()) &&
+                         equal(reference.begin(), reference.begin() + nbReference, sortie.begin());
+        long long dureeArbre = duration_cast<microseconds>(milieu - debut).count();
+        long long dureeTable = duration_cast<microseconds>(fin - milieu).count();
+
+        cout << setw(15) << left << noms[t] << right << " | " << setw(12) << fixed << setprecision(2)
+             << static_cast<double>(bits.size()) / longueur << " | " << setw(10) << dureeArbre
+             << " | " << setw(10) << dureeTable << " | " << setw(11) << setprecision(1)
+             << static_cast<double>(dureeArbre) / max(1LL, dureeTable) << "x | "
+             << (identique ? "identique" : "DIFFERENTE") << endl;
+        ok = ok && identique && nbReference > 0;
+    }
+
+    cout << "Test Huffman multi-symboles: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Test du decodage Huffman parallele par resynchronisation speculative
+ */
+void testHuffmanDecodageParallele() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 28: DECODAGE HUFFMAN PARALLELE SANS MARQUEUR" << endl;
+    cout << "===============================================================" << endl;
+
+    // 1. Trame RLE de Lenna, codes de longueur fixe (jamais resynchronises) et codes longs
+    vector<vector<char>> trames;
+    vector<string> noms;
+
+    vector<char> motif;
+    if (lireTrameSymboles("lenna_compresse_q50.dat", motif)) {
+        vector<char> trame;
+        while (trame.size() < 1500000) {
+            trame.insert(trame.end(), motif.begin(), motif.end());
+        }
+        trames.push_back(trame);
+        noms.push_back("Lenna q50");
+    }
+
+    // 255 symboles equiprobables : codes de 7 ou 8 bits, un thread qui part
+    // au milieu d'un code met longtemps a retomber sur une frontiere
+    vector<char> fixes;
+    unsigned int graine = 31;
+    for (int i = 0; i < 400001; i++) {
+        graine = graine * 1103515245u + 12345u;
+        fixes.push_back(static_cast<char>(i % 255 + 1));
+        swap(fixes[i], fixes[(graine >> 8) % (i + 1)]);
+    }
+    trames.push_back(fixes);
+    noms.push_back("codes fixes");
+
+    vector<char> longs;
+    for (int i = 0; i < 600000; i++) {
+        graine = graine * 1103515245u + 12345u;
+        int symbole = 1;
+        while (symbole < 30 && ((graine >> (symbole % 24)) & 1)) symbole++;
+        longs.push_back(static_cast<char>(symbole));
+    }
+    trames.push_back(longs);
+    noms.push_back("codes longs");
+
+    bool ok = trames.size() == 3;
+    const unsigned int nbThreads[] = {1, 2, 3, 8, 16};
+
+    for (size_t t = 0; t < trames.size(); t++) {
+        vector<char>& trame = trames[t];
+        unsigned int longueur = static_cast<unsigned int>(trame.size());
+
+        vector<char> donnees(256);
+        vector<double> frequences(256);
+        unsigned int nbSymboles = cHuffman::Histogramme(trame.data(), longueur, donnees.data(), frequences.data());
+        cHuffman huffman;
+        huffman.HuffmanCodes(donnees.data(), frequences.data(), nbSymboles);
+
+        vector<uint64_t> mots;
+        unsigned int nbBits = huffman.encoderParallele(trame.data(), longueur, mots);
+
+        vector<char> reference(longueur + 1);
+        auto debut = high_resolution_clock::now();
+        unsigned int nbReference = huffman.decoder(mots, nbBits, reference.data());
+        long long dureeSerie = duration_cast<microseconds>(high_resolution_clock::now() - debut).count();
+
+        cout << noms[t] << ": " << nbBits << " bits, serie " << dureeSerie << " us" << endl;
+        ok = ok && nbReference > 0;
+
+        for (int n = 0; n < 5; n++) {
+            vector<char> sortie(longueur + 1);
+            debut = high_resolution_clock::now();
+            unsigned int nbSortie = huffman.decoderParallele(mots, nbBits, sortie.data(), nbThreads[n]);
+            long long duree = duration_cast<microseconds>(high_resolution_clock::now() - debut).count();
+
+            bool identique = nbSortie == nbReference &&
+                             equal(reference.begin(), reference.begin() + nbReference, sortie.begin());
+            cout << "  " << setw(2) << nbThreads[n] << " thread(s): " << setw(6) << duree << " us, "
+                 << setw(6) << huffman.getSymbolesCorriges() << " symbole(s) redecode(s), "
+                 << (identique ? "identique" : "DIFFERENTE") << endl;
+            ok = ok && identique;
+        }
+    }
+
+    cout << "Test decodage Huffman parallele: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Test du contexte de codage reutilisable (aucune allocation une fois chauffe)
+ */
+void testContexteCodec() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 29: CONTEXTE DE CODAGE SANS ALLOCATION" << endl;
+    cout << "===============================================================" << endl;
+
+    // 1. Pixels de Lenna et references par fichier
+    cCompression source;
+    std::cout.setstate(std::ios_base::failbit);
+    bool charge = source.chargerImageTexte("lenna.img.txt", 256, 256);
+    std::cout.clear();
+    if (!charge) {
+        cout << "Test contexte de codage: [X] ECHEC (chargement de Lenna)" << endl;
+        return;
+    }
+    vector<unsigned char> pixels(256 * 256);
+    for (unsigned int i = 0; i < 256; i++) {
+        copy(source.getBuffer()[i], source.getBuffer()[i] + 256, pixels.begin() + i * 256);
+    }
+
+    const unsigned int qualites[] = {25, 50, 75, 90};
+    cContexteCodec contexte;
+    bool ok = true;
+
+    for (int q = 0; q < 4; q++) {
+        string nom = "lenna_contexte_q" + to_string(qualites[q]) + ".dat";
+        std::cout.setstate(std::ios_base::failbit);
+        source.setQualite(qualites[q]);
+        source.compresser(nom.c_str());
+        cDecompression decompresseur;
+        char** reference = decompresseur.Decompression_JPEG(nom.c_str());
+        std::cout.clear();
+
+        ifstream fichier(nom.c_str(), ios::binary);
+        vector<unsigned char> fluxFichier((istreambuf_iterator<char>(fichier)), istreambuf_iterator<char>());
+
+        bool fluxOk = contexte.compresserMemoire(pixels.data(), 256, 256, qualites[q]) &&
+                      contexte.getTailleFlux() == fluxFichier.size() &&
+                      equal(fluxFichier.begin(), fluxFichier.end(), contexte.getFlux());
+        bool imageOk = contexte.decompresserMemoire(contexte.getFlux(), contexte.getTailleFlux()) && reference;
+        for (unsigned int i = 0; imageOk && i < 256; i++) {
+            for (unsigned int j = 0; j < 256; j++) {
+                imageOk = imageOk && contexte.getBuffer()[i][j] == static_cast<unsigned char>(reference[i][j]);
+            }
+        }
+        libererImage(reference, 256);
+        ok = ok && fluxOk && imageOk;
+    }
+    cout << "Flux et images identiques aux chemins par fichier: " << (ok ? "oui" : "NON") << endl;
+
+    // 2. Regime etabli : aucune allocation de tout le programme
+    const int iterations = 20;
+    unsigned long long allocationsContexte = contexte.getAllocations();
+    unsigned long long avant = gNbAllocations;
+    auto debut = high_resolution_clock::now();
+    for (int n = 0; n < iterations; n++) {
+        ok = ok && contexte.compresserMemoire(pixels.data(), 256, 256, qualites[n % 4]);
+        ok = ok && contexte.decompresserMemoire(contexte.getFlux(), contexte.getTailleFlux());
+    }
+    long long dureeContexte = duration_cast<microseconds>(high_resolution_clock::now() - debut).count();
+    unsigned long long allocationsEtablies = gNbAllocations - avant;
+
+    // Meme travail avec des objets neufs et des fichiers, pour comparaison
+    avant = gNbAllocations;
+    std::cout.setstate(std::ios_base::failbit);
+    debut = high_resolution_clock::now();
+    for (int n = 0; n < iterations; n++) {
+        cCompression compresseur(256, 256, qualites[n % 4]);
+        for (unsigned int i = 0; i < 256; i++) {
+            copy(pixels.begin() + i * 256, pixels.begin() + (i + 1) * 256, compresseur.getBuffer()[i]);
+        }
+        compresseur.compresser("lenna_contexte.dat");
+        cDecompression decompresseur;
+        libererImage(decompresseur.Decompression_JPEG("lenna_contexte.dat"), 256);
+    }
+    long long dureeClassique = duration_cast<microseconds>(high_resolution_clock::now() - debut).count();
+    std::cout.clear();
+    unsigned long long allocationsClassiques = gNbAllocations - avant;
+
+    cout << "Allocations pour " << iterations << " codages + decodages: contexte " << allocationsEtablies
+         << " (" << contexte.getAllocations() - allocationsContexte << " dans le contexte), objets neufs "
+         << allocationsClassiques << endl;
+    cout << "Temps: contexte " << dureeContexte << " us, objets neufs et fichiers " << dureeClassique << " us" << endl;
+
+    // 3. Flux non aligne : la trame est copiee dans le contexte, sans nouvelle allocation
+    vector<unsigned char> decale(contexte.getTailleFlux() + 1);
+    copy(contexte.getFlux(), contexte.getFlux() + contexte.getTailleFlux(), decale.begin() + 1);
+    avant = gNbAllocations;
+    bool decaleOk = contexte.decompresserMemoire(decale.data() + 1, decale.size() - 1);
+    decaleOk = decaleOk && gNbAllocations == avant;
+    cout << "Flux non aligne: " << (decaleOk ? "decode sans allocation" : "ECHEC") << endl;
+
+    // 4. En-tete forge (dimensions enormes, trame de 3 entiers) : refuse avant toute allocation
+    unsigned int forge[7] = {0xFFFFFFF8u, 0xFFFFFFF8u, 50, 3, 0, 0, 0};
+    vector<unsigned char> fluxForge(sizeof(forge));
+    memcpy(fluxForge.data(), forge, sizeof(forge));
+    avant = gNbAllocations;
+    std::cerr.setstate(std::ios_base::failbit);
+    bool forgeRefuse = !contexte.decompresserMemoire(fluxForge.data(), fluxForge.size());
+    std::cerr.clear();
+    forgeRefuse = forgeRefuse && gNbAllocations == avant && contexte.getLargeur() == 256;
+    cout << "En-tete forge: " << (forgeRefuse ? "refuse sans allocation" : "ECHEC") << endl;
+
+    // 5. Trames forgees : run negatif, puis coefficient au-dela de la position 63
+    int runNegatif[7] = {8, 8, 50, 3, 0, -10, 5};
+    int runTropLong[7] = {8, 8, 50, 3, 0, 64, 5};
+    cContexteCodec corrompu;
+    std::cerr.setstate(std::ios_base::failbit);
+    bool runsRefuses = !corrompu.decompresserMemoire(reinterpret_cast<unsigned char*>(runNegatif), sizeof(runNegatif))
+                    && !corrompu.decompresserMemoire(reinterpret_cast<unsigned char*>(runTropLong), sizeof(runTropLong));
+    std::cerr.clear();
+    cout << "Runs hors du bloc: " << (runsRefuses ? "trame refusee" : "ECHEC") << endl;
+
+#ifdef JPEG_INSTRUMENTATION
+    // Le buffer, la trame et le flux sont comptes a l'identique par l'instrumentation
+    cContexteCodec neuf;
+    neuf.getInstrumentation().reinitialiser();
+    neuf.decompresserMemoire(contexte.getFlux(), contexte.getTailleFlux());
+    bool comptesOk = neuf.getInstrumentation().getAllocations() == neuf.getAllocations();
+    cout << "Allocations instrumentees: " << neuf.getInstrumentation().getAllocations() << " / contexte "
+         << neuf.getAllocations() << (comptesOk ? "" : " ECHEC") << endl;
+    ok = ok && comptesOk;
+#endif
+
+    ok = ok && allocationsEtablies == 0 && contexte.getAllocations() == allocationsContexte && decaleOk && forgeRefuse
+         && runsRefuses;
+    cout << "Test contexte de codage: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief DCT N x N de reference, cosinus recalcules a chaque terme (ancien code)
+ */
+void dctReference(int N, char** bloc, double** coefficients) {
+    const double pi = acos(-1.0);
+    for (int u = 0; u < N; u++) {
+        for (int v = 0; v < N; v++) {
+            double sum = 0.0;
+            for (int x = 0; x < N; x++) {
+                for (int y = 0; y < N; y++) {
+                    double cos1 = cos((2 * x + 1) * u * pi / (2.0 * N));
+                    double cos2 = cos((2 * y + 1) * v * pi / (2.0 * N));
+                    sum += bloc[x][y] * cos1 * cos2;
+                }
+            }
+            coefficients[u][v] = (2.0 / N) * (u == 0 ? 1.0 / sqrt(2.0) : 1.0) * (v == 0 ? 1.0 / sqrt(2.0) : 1.0) * sum;
+        }
+    }
+}
+
+/**
+ * @brief IDCT N x N de reference, cosinus recalcules a chaque terme (ancien code)
+ */
+void idctReference(int N, double** coefficients, char** bloc) {
+    const double pi = acos(-1.0);
+    const double C0 = 1.0 / sqrt(2.0);
+    for (int x = 0; x < N; x++) {
+        for (int y = 0; y < N; y++) {
+            double sum = 0.0;
+            for (int u = 0; u < N; u++) {
+                for (int v = 0; v < N; v++) {
+                    double cos1 = cos((2 * x + 1) * u * pi / (2.0 * N));
+                    double cos2 = cos((2 * y + 1) * v * pi / (2.0 * N));
+                    sum += coefficients[u][v] * (u == 0 ? C0 : 1.0) * (v == 0 ? C0 : 1.0) * cos1 * cos2;
+                }
+            }
+            bloc[x][y] = static_cast<char>(round((2.0 / N) * sum));
+        }
+    }
+}
+
+/**
+ * @brief Compare la table de cosinus compilee a std::cos
+ * @param ulpMax Ecart maximal en ulp (mis a jour)
+ * @return Nombre de valeurs differentes
+ */
+template <int N>
+int comparerTableCosinus(int& ulpMax) {
+    const double pi = acos(-1.0);
+    int differences = 0;
+    for (int u = 0; u < N; u++) {
+        for (int x = 0; x < N; x++) {
+            double attendu = cos((2 * x + 1) * u * pi / (2.0 * N));
+            double valeur = TABLE_COSINUS<N>.c[u][x];
+            if (valeur != attendu) {
+                differences++;
+                int ulp = 0;
+                for (double d = attendu; d != valeur && ulp < 100; ulp++) {
+                    d = nextafter(d, valeur);
+                }
+                ulpMax = max(ulpMax, ulp);
+            }
+        }
+    }
+    return differences;
+}
+
+/**
+ * @brief Teste les tables de cosinus et de quantification calculees a la compilation
+ */
+void testTablesCompilees() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 30: TABLES CALCULEES A LA COMPILATION" << endl;
+    cout << "===============================================================" << endl;
+
+    // 1. Tables de cosinus : identiques a std::cos jusqu'a N = 16, a un ulp pres pour N = 32
+    int ulpExact = 0;
+    int ulp32 = 0;
+    int differencesExactes = comparerTableCosinus<2>(ulpExact) + comparerTableCosinus<4>(ulpExact)
+                           + comparerTableCosinus<8>(ulpExact) + comparerTableCosinus<16>(ulpExact);
+    int differences32 = comparerTableCosinus<32>(ulp32);
+    cout << "Cosinus differents de std::cos: N <= 16: " << differencesExactes << ", N = 32: " << differences32
+         << " (au plus " << ulp32 << " ulp)" << endl;
+
+    // 2. DCT/IDCT 8x8 identiques au bit pres a l'ancien calcul, et temps par bloc
+    char bloc[16][16], blocRef[16][16];
+    double dct[16][16], dctRef[16][16];
+    char* blocPtrs[16];
+    char* blocRefPtrs[16];
+    double* dctPtrs[16];
+    double* dctRefPtrs[16];
+    for (int i = 0; i < 16; i++) {
+        blocPtrs[i] = bloc[i];
+        blocRefPtrs[i] = blocRef[i];
+        dctPtrs[i] = dct[i];
+        dctRefPtrs[i] = dctRef[i];
+    }
+
+    cCompression comp(8, 8, 50);
+    unsigned int graine = 3030;
+    int differencesDCT = 0;
+    int differencesIDCT = 0;
+    const int nbBlocs = 300;
+    long long dureeTable = 0;
+    long long dureeReference = 0;
+    for (int n = 0; n < nbBlocs; n++) {
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                graine = graine * 1103515245u + 12345u;
+                bloc[i][j] = static_cast<char>(static_cast<int>((graine >> 16) % 256) - 128);
+            }
+        }
+
+        auto debut = high_resolution_clock::now();
+        comp.Calcul_DCT_Block(blocPtrs, dctPtrs);
+        dureeTable += duration_cast<nanoseconds>(high_resolution_clock::now() - debut).count();
+        debut = high_resolution_clock::now();
+        dctReference(8, blocPtrs, dctRefPtrs);
+        dureeReference += duration_cast<nanoseconds>(high_resolution_clock::now() - debut).count();
+
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                differencesDCT += dct[i][j] != dctRef[i][j];
+            }
+        }
+
+        comp.Calcul_IDCT(dctPtrs, blocPtrs);
+        idctReference(8, dctRefPtrs, blocRefPtrs);
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                differencesIDCT += bloc[i][j] != blocRef[i][j];
+            }
+        }
+    }
+    cout << "Coefficients DCT differents: " << differencesDCT << ", pixels IDCT differents: " << differencesIDCT
+         << " (" << nbBlocs << " blocs)" << endl;
+    cout << "Temps moyen DCT 8x8: table " << dureeTable / nbBlocs << " ns, cosinus recalcules "
+         << dureeReference / nbBlocs << " ns" << endl;
+
+    // 3. Autres tailles de bloc : aller-retour DCT/IDCT en 4x4 et 16x16
+    int erreurMax = 0;
+    for (int n = 0; n < 20; n++) {
+        for (int i = 0; i < 16; i++) {
+            for (int j = 0; j < 16; j++) {
+                graine = graine * 1103515245u + 12345u;
+                blocRef[i][j] = static_cast<char>(static_cast<int>((graine >> 16) % 200) - 100);
+            }
+        }
+        dctDirecte<16>(blocRefPtrs, dctPtrs);
+        idctDirecte<16>(dctPtrs, blocPtrs);
+        for (int i = 0; i < 16; i++) {
+            for (int j = 0; j < 16; j++) {
+                erreurMax = max(erreurMax, abs(bloc[i][j] - blocRef[i][j]));
+            }
+        }
+        dctDirecte<4>(blocRefPtrs, dctPtrs);
+        idctDirecte<4>(dctPtrs, blocPtrs);
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 4; j++) {
+                erreurMax = max(erreurMax, abs(bloc[i][j] - blocRef[i][j]));
+            }
+        }
+    }
+    cout << "Aller-retour DCT/IDCT 4x4 et 16x16: erreur max " << erreurMax << endl;
+
+    // 4. Tables de quantification (precalculees pour 25, 50, 75 et 90) : formule de reference
+    const int base[8][8] = {
+        {16, 11, 10, 16, 24, 40, 51, 61},
+        {12, 12, 14, 19, 26, 58, 60, 55},
+        {14, 13, 16, 24, 40, 57, 69, 56},
+        {14, 17, 22, 29, 51, 87, 80, 62},
+        {18, 22, 37, 56, 68, 109, 103, 77},
+        {24, 35, 55, 64, 81, 104, 113, 92},
+        {49, 64, 78, 87, 103, 121, 120, 101},
+        {72, 92, 95, 98, 112, 100, 103, 99}
+    };
+    int un[8][8];
+    float pas[8][8];
+    int* unPtrs[8];
+    float* pasPtrs[8];
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            un[i][j] = 1;
+        }
+        unPtrs[i] = un[i];
+        pasPtrs[i] = pas[i];
+    }
+    int differencesQuant = 0;
+    for (unsigned int qualite = 1; qualite <= 100; qualite++) {
+        for (int transposee = 0; transposee < 2; transposee++) {
+            comp.setQualite(qualite | (transposee ? cCompression::QUALITE_TABLE_TRANSPOSEE : 0));
+            comp.dequant_JPEG_Float(unPtrs, pasPtrs);
+            double lambda = qualite < 50 ? 5000.0 / qualite : 200.0 - 2.0 * qualite;
+            for (int i = 0; i < 8; i++) {
+                for (int j = 0; j < 8; j++) {
+                    double valeur = ((transposee ? base[j][i] : base[i][j]) * lambda + 50.0) / 100.0;
+                    int attendu = valeur < 1.0 ? 1 : valeur > 255.0 ? 255 : static_cast<int>(round(valeur));
+                    differencesQuant += static_cast<int>(pas[i][j]) != attendu;
+                }
+            }
+        }
+    }
+    cout << "Pas de quantification differents de la formule (qualites 1 a 100): " << differencesQuant << endl;
+
+    bool ok = differencesExactes == 0 && ulp32 <= 1 && differencesDCT == 0 && differencesIDCT == 0
+           && erreurMax <= 1 && differencesQuant == 0;
+    cout << "Test tables compilees: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Executeur de test : garde les taches jusqu'a executerTout()
+ */
+class cExecuteurManuel : public cExecuteur {
+private:
+    vector<function<void()>> mTaches;
+
+public:
+    void executer(function<void()> tache) override { mTaches.push_back(move(tache)); }
+
+    size_t executerTout() {
+        vector<function<void()>> taches;
+        taches.swap(mTaches);
+        for (function<void()>& tache : taches) {
+            tache();
+        }
+        return taches.size();
+    }
+};
+
+/**
+ * @brief Executeur qui refuse toute tache en levant une exception (file pleine)
+ */
+class cExecuteurSature : public cExecuteur {
+public:
+    void executer(function<void()>) override { throw runtime_error("file d'attente pleine"); }
+};
+
+/**
+ * @brief Indique si le resultat d'une tache est disponible, sans attendre
+ */
+bool estPret(future<sResultatCodec>& resultat) {
+    return resultat.wait_for(seconds(0)) == future_status::ready;
+}
+
+/**
+ * @brief Test du codec asynchrone : pool fixe, contre-pression, annulation et exceptions
+ */
+void testCodecAsynchrone() {
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 31: CODEC ASYNCHRONE (FUTURES, POOL FIXE, ANNULATION)" << endl;
+    cout << "===============================================================" << endl;
+
+    // 1. Images de test et references synchrones
+    const int nbImages = 12;
+    const unsigned int largeur = 128, hauteur = 64;
+    vector<vector<unsigned char>> images(nbImages, vector<unsigned char>(largeur * hauteur));
+    vector<vector<unsigned char>> fluxReference(nbImages);
+    vector<vector<unsigned char>> pixelsReference(nbImages);
+    cContexteCodec reference;
+    unsigned int graine = 3131;
+    for (int n = 0; n < nbImages; n++) {
+        for (unsigned int p = 0; p < largeur * hauteur; p++) {
+            graine = graine * 1103515245u + 12345u;
+            images[n][p] = static_cast<unsigned char>((p % largeur) + (p / largeur) * n / 4 + (graine >> 29));
+        }
+        reference.compresserMemoire(images[n].data(), largeur, hauteur, 30 + 5 * n);
+        fluxReference[n].assign(reference.getFlux(), reference.getFlux() + reference.getTailleFlux());
+        reference.decompresserMemoire(fluxReference[n].data(), fluxReference[n].size());
+        for (unsigned int i = 0; i < hauteur; i++) {
+            pixelsReference[n].insert(pixelsReference[n].end(), reference.getBuffer()[i],
+                                      reference.getBuffer()[i] + largeur);
+        }
+    }
+
+    // 2. Pool interne de 2 threads, 4 taches au plus : l'appelant attend la
+    //    plus ancienne tache avant de soumettre au-dela de la limite
+    bool identiques = true;
+    int refus = 0;
+    unsigned int contextes;
+    auto debut = high_resolution_clock::now();
+    {
+        cCodecAsynchrone codec(2, 4);
+        vector<future<sResultatCodec>> compressions;
+        vector<sResultatCodec> flux(nbImages);
+        size_t premier = 0;
+        for (int n = 0; n < nbImages; n++) {
+            if (compressions.size() - premier == codec.getMaxEnCours()) {
+                flux[premier] = compressions[premier].get();
+                premier++;
+            }
+            compressions.push_back(codec.compresserAsync(images[n], largeur, hauteur, 30 + 5 * n));
+        }
+        for (; premier < compressions.size(); premier++) {
+            flux[premier] = compressions[premier].get();
+        }
+
+        vector<future<sResultatCodec>> decompressions;
+        premier = 0;
+        for (int n = 0; n < nbImages; n++) {
+            refus += flux[n].statut == TACHE_REFUSEE;
+            identiques = identiques && flux[n].statut == TACHE_REUSSIE && flux[n].donnees == fluxReference[n];
+            if (decompressions.size() - premier == codec.getMaxEnCours()) {
+                decompressions[premier].wait();
+                premier++;
+            }
+            decompressions.push_back(codec.decompresserAsync(flux[n].donnees));
+        }
+        for (int n = 0; n < nbImages; n++) {
+            sResultatCodec image = decompressions[n].get();
+            refus += image.statut == TACHE_REFUSEE;
+            identiques = identiques && image.statut == TACHE_REUSSIE && image.largeur == largeur
+                      && image.hauteur == hauteur && image.donnees == pixelsReference[n];
+        }
+        contextes = codec.getNbContextes();
+    }
+    long long duree = duration_cast<microseconds>(high_resolution_clock::now() - debut).count();
+    cout << nbImages << " images codees puis decodees sur 2 threads: " << (identiques ? "identiques" : "DIFFERENTES")
+         << " au codec synchrone, " << refus << " refus, " << contextes << " contextes, " << duree << " us" << endl;
+
+    // 3. Executeur fourni : contre-pression, jeton d'annulation, annulerTout
+    cExecuteurManuel executeur;
+    bool controleOk = true;
+    future<sResultatCodec> derniere;
+    thread vidage;
+    {
+        cCodecAsynchrone codec(executeur, 3);
+        tJetonAnnulation jeton = cCodecAsynchrone::creerJeton();
+        future<sResultatCodec> t1 = codec.compresserAsync(images[0], largeur, hauteur, 30);
+        future<sResultatCodec> t2 = codec.compresserAsync(images[1], largeur, hauteur, 35, jeton);
+        future<sResultatCodec> t3 = codec.decompresserAsync(vector<unsigned char>(3));
+        future<sResultatCodec> t4 = codec.compresserAsync(images[2], largeur, hauteur, 40);
+        bool refusImmediat = estPret(t4) && t4.get().statut == TACHE_REFUSEE;
+        bool enAttente = !estPret(t1) && codec.getEnCours() == 3;
+        jeton->store(true);
+
+        std::cerr.setstate(std::ios_base::failbit);
+        executeur.executerTout();
+        std::cerr.clear();
+        bool statutsOk = t1.get().statut == TACHE_REUSSIE && t2.get().statut == TACHE_ANNULEE
+                      && t3.get().statut == TACHE_ECHEC && codec.getEnCours() == 0;
+        cout << "Limite de 3 taches: 4e soumission " << (refusImmediat ? "refusee sans attendre" : "NON REFUSEE")
+             << ", statuts reussie/annulee/echec: " << (statutsOk ? "oui" : "NON") << endl;
+
+        future<sResultatCodec> t5 = codec.compresserAsync(images[3], largeur, hauteur, 45);
+        future<sResultatCodec> t6 = codec.decompresserAsync(fluxReference[4]);
+        codec.annulerTout();
+        future<sResultatCodec> t7 = codec.decompresserAsync(fluxReference[5]);
+        executeur.executerTout();
+        bool annulationOk = t5.get().statut == TACHE_ANNULEE && t6.get().statut == TACHE_ANNULEE;
+        sResultatCodec image = t7.get();
+        annulationOk = annulationOk && image.statut == TACHE_REUSSIE && image.donnees == pixelsReference[5];
+        cout << "annulerTout: taches en attente annulees, soumission suivante executee: "
+             << (annulationOk ? "oui" : "NON") << endl;
+
+        // Destruction avec une tache encore dans la file de l'executeur :
+        // le destructeur l'annule et attend qu'elle soit depilee
+        derniere = codec.compresserAsync(images[6], largeur, hauteur, 60);
+        controleOk = refusImmediat && enAttente && statutsOk && annulationOk;
+        vidage = thread([&executeur] {
+            this_thread::sleep_for(milliseconds(20));
+            executeur.executerTout();
+        });
+    }
+    vidage.join();
+    bool destructionOk = estPret(derniere) && derniere.get().statut == TACHE_ANNULEE;
+    cout << "Destruction: tache restante en file annulee avant la fin du destructeur: "
+         << (destructionOk ? "oui" : "NON") << endl;
+
+    // 4. Exception dans une tache (allocation refusee) : rendue par le future,
+    //    la tache est terminee et le codec reste utilisable
+    bool exceptionOk;
+    {
+        cCodecAsynchrone codec(executeur, 2);
+        future<sResultatCodec> t8 = codec.decompresserAsync(fluxReference[0]);
+        gEchecAllocation = true;
+        executeur.executerTout();
+        gEchecAllocation = false;
+        bool rendue = false;
+        try {
+            t8.get();
+        } catch (const bad_alloc&) {
+            rendue = true;
+        }
+        future<sResultatCodec> t9 = codec.decompresserAsync(fluxReference[0]);
+        executeur.executerTout();
+        sResultatCodec image = t9.get();
+        exceptionOk = rendue && codec.getEnCours() == 0 && codec.getNbContextes() == 1
+                   && image.statut == TACHE_REUSSIE && image.donnees == pixelsReference[0];
+
+        // Echec avec un contexte emprunte (copie du resultat) : le contexte est detruit
+        future<sResultatCodec> t10 = codec.decompresserAsync(fluxReference[1]);
+        gEchecAllocation = true;
+        executeur.executerTout();
+        gEchecAllocation = false;
+        rendue = false;
+        try {
+            t10.get();
+        } catch (const bad_alloc&) {
+            rendue = true;
+        }
+        exceptionOk = exceptionOk && rendue && codec.getEnCours() == 0 && codec.getNbContextes() == 0;
+    }
+    cout << "bad_alloc dans une tache: rendu par le future, codec toujours utilisable: "
+         << (exceptionOk ? "oui" : "NON") << endl;
+
+    // 5. Exception de l'executeur a la soumission : la tache n'est pas comptee en cours
+    cExecuteurSature sature;
+    bool soumissionOk;
+    {
+        cCodecAsynchrone codec(sature, 2);
+        future<sResultatCodec> t11 = codec.compresserAsync(images[0], largeur, hauteur, 50);
+        bool rendue = false;
+        try {
+            t11.get();
+        } catch (const runtime_error&) {
+            rendue = true;
+        }
+        soumissionOk = rendue && codec.getEnCours() == 0;
+        if (soumissionOk) {
+            codec.attendre();
+        }
+    }
+    cout << "Executeur qui refuse la tache: erreur rendue par le future, attendre() rend la main: "
+         << (soumissionOk ? "oui" : "NON") << endl;
+
+    bool ok = identiques && refus == 0 && contextes <= 4 && controleOk && destructionOk && exceptionOk && soumissionOk;
+    cout << "Test codec asynchrone: " << (ok ? "[OK] REUSSI" : "[X] ECHEC") << endl;
+}
+
+/**
+ * @brief Fonction principale
+ */
+int main() {
+    cout << "===============================================================" << endl;
+    cout << "           PROJET JPEG - CODEC COMPRESSION/DECOMPRESSION" << endl;
+    cout << "===============================================================" << endl;
+    cout << "Auteur: [Votre Nom]" << endl;
+    cout << "Date: 2024" << endl;
+    cout << "Version: 1.0" << endl;
+    cout << "===============================================================" << endl;
+
+    // Test 1: DCT/IDCT
+    testDCT();
+
+    // Test 2: Quantification
+    testQuantification();
+
+    // Test 3: RLE
+    testRLE();
+
+    // Test 4: Huffman
+    testHuffman();
+
+    // Test 5: Compression sur Lenna avec qualite 50
+    testCompressionLenna(50);
+
+    // Test 6: Comparaison des qualites
+    testQualitesVariables();
+
+    // Test 7: Cycle complet compression/decompression
+
+    cout << "\n===============================================================" << endl;
+    cout << "TEST 7: CYCLE COMPLET COMPRESSION/DECOMPRESSION" << endl;
+    cout << "===============================================================" << endl;
+
+    cDecompression testeur;
+    if (testeur.testerCompressionDecompression("lenna.img.txt", 75)) {
+        cout << "[OK] Test cycle complet: REUSSI" << endl;
+    } else {
+        cout << "[X] Test cycle complet: ECHEC" << endl;
+    }
+
+    // Test 8: Instrumentation
+    testInstrumentation();
+
+    // Test 9: Compression multi-qualite
+    testCompressionMultiQualite();
+
+    // Test 10: Regulation de debit
+    testRegulationDebit();
+
+    // Test 11: Transcodage
+    testTranscodage();
+
+    // Test 12: Decompression d'une region
+    testDecompressionRegion();
+
+    // Test 13: Decompression a taille reduite
+    testDecompressionEchelle();
+
+    // Test 14: Apercu DC et empreinte perceptuelle
+    testApercuEmpreinte();
+
+    // Test 15: Rotations et symetries sans perte
+    testTransformationsSansPerte();
+
+    // Test 16: Recadrage sans perte
+    testRecadrage();
+
+    // Test 17: Couleur YCbCr et sous-echantillonnage
+    testCouleur();
+
+    // Test 18: Compression progressive
+    testProgressif();
+
+    // Test 19: Format en tuiles
+    testTuiles();
+
+    // Test 20: Lecture par projection memoire
+    testLectureMappee();
+
+    // Test 21: Blocs uniformes
+    testBlocsUniformes();
+
+    // Test 22: RLE par masque
+    testRLEMasque();
+
+    // Test 23: Dequantification fusionnee
+    testDequantificationFusionnee();
+
+    // Test 24: Chaine en simple precision
+    testPrecisionSimple();
+
+    // Test 25: DCT et quantification par lots
+    testDCTParLots();
+
+    // Test 26: Encodage Huffman parallele
+    testHuffmanParallele();
+
+    // Test 27: Decodage Huffman multi-symboles
+    testHuffmanMultiSymboles();
+
+    // Test 28: Decodage Huffman parallele
+    testHuffmanDecodageParallele();
+
+    // Test 29: Contexte de codage reutilisable
+    testContexteCodec();
+
+    // Test 30: Tables calculees a la compilation
+    testTablesCompilees();
+
+    // Test 31: Codec asynchrone
+    testCodecAsynchrone();
+
+    cout << "\n                  TESTS TERMINES AVEC SUCCES" << endl;
+
+    cout << "\nResume des fichiers generes:" << endl;
+    cout << "-----------------------------" << endl;
+    cout << "- lenna_compresse_q50.dat : Image Lenna compressee (qualite 50%)" << endl;
+    cout << "- lenna_q10.dat a lenna_q90.dat : Images avec differentes qualites" << endl;
+    cout << "- lenna.img.txt_compresse_q75.dat : Fichier de test compression" << endl;
+
+    return 0;
+}